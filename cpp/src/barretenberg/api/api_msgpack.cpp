@@ -1,7 +1,9 @@
 #include "barretenberg/api/api_msgpack.hpp"
 #include "barretenberg/bbapi/c_bind.hpp"
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
+#include <algorithm>
 #include <cstdint>
 #include <fstream>
 #include <iostream>
@@ -11,7 +13,12 @@
 #ifndef __wasm__
 #include "barretenberg/ipc/ipc_server.hpp"
 #include <csignal>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <string_view>
 #include <thread>
+#include <unordered_map>
 #include <unistd.h>
 #ifdef __linux__
 #include <sys/prctl.h>
@@ -145,7 +152,181 @@ static void setup_parent_death_monitoring()
 #endif
 }
 
-int execute_msgpack_ipc_server(std::unique_ptr<ipc::IpcServer> server)
+namespace {
+/**
+ * @brief Deserialize a msgpack command received over IPC, execute it and serialize the response
+ *
+ * @param client_state State the command executes against; nullptr to use the global bbapi state
+ * @return Serialized response, or an empty vector to skip sending a response
+ */
+std::vector<uint8_t> handle_ipc_request(int client_id,
+                                        std::span<const uint8_t> request,
+                                        bbapi::BBApiRequest* client_state)
+{
+    try {
+        // Deserialize msgpack command
+        // The buffer should contain a tuple of arguments (array) matching the bbapi function signature.
+        // Since bbapi(Command) takes one argument, we expect a 1-element array containing the Command.
+        auto unpacked = msgpack::unpack(reinterpret_cast<const char*>(request.data()), request.size());
+        auto obj = unpacked.get();
+
+        // First, expect an array (the tuple of arguments)
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+        if (obj.type != msgpack::type::ARRAY || obj.via.array.size != 1) {
+            std::cerr << "Error: Expected an array of size 1 (tuple of arguments) from client " << client_id << '\n';
+            return {}; // Return empty to skip response
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+        auto& tuple_arr = obj.via.array;
+        auto& command_obj = tuple_arr.ptr[0];
+
+        // Now access the Command itself, which should be an array of size 2 [command-name, payload]
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+        if (command_obj.type != msgpack::type::ARRAY || command_obj.via.array.size != 2) {
+            std::cerr << "Error: Expected Command to be an array of size 2 [command-name, payload] from client "
+                      << client_id << '\n';
+            return {};
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+        auto& command_arr = command_obj.via.array;
+        if (command_arr.ptr[0].type != msgpack::type::STR) {
+            std::cerr << "Error: Expected first element of Command to be a string (type name) from client "
+                      << client_id << '\n';
+            return {};
+        }
+
+        // Check if this is a Shutdown command
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+        std::string command_name(command_arr.ptr[0].via.str.ptr, command_arr.ptr[0].via.str.size);
+        bool is_shutdown = (command_name == "Shutdown");
+
+        // Convert to Command and execute, against the client's own state if it has one
+        bb::bbapi::Command command;
+        command_obj.convert(command);
+        auto response = client_state != nullptr ? bbapi::execute(*client_state, std::move(command))
+                                                : bbapi::bbapi(std::move(command));
+
+        // Serialize response
+        msgpack::sbuffer response_buffer;
+        msgpack::pack(response_buffer, response);
+        std::vector<uint8_t> result(response_buffer.data(), response_buffer.data() + response_buffer.size());
+
+        // If this was a shutdown command, throw exception with response
+        // This signals the server to send the response and then exit gracefully
+        if (is_shutdown) {
+            throw ipc::ShutdownRequested(std::move(result));
+        }
+
+        return result;
+    } catch (const ipc::ShutdownRequested&) {
+        // Re-throw shutdown request
+        throw;
+    } catch (const std::exception& e) {
+        // Log error to stderr for debugging (goes to log file if logger enabled)
+        std::cerr << "Error processing request from client " << client_id << ": " << e.what() << '\n';
+        std::cerr.flush();
+
+        // Create error response with exception message
+        bb::bbapi::ErrorResponse error_response{ .message = std::string(e.what()) };
+        bb::bbapi::CommandResponse response = error_response;
+
+        // Serialize and return error response to client
+        msgpack::sbuffer response_buffer;
+        msgpack::pack(response_buffer, response);
+        return std::vector<uint8_t>(response_buffer.data(), response_buffer.data() + response_buffer.size());
+    }
+}
+
+/**
+ * @brief Read the name of a command without deserializing it
+ * @details Requests are encoded as [[command-name, payload]]; returns an empty view if the request does not start that
+ * way, in which case it is left for handle_ipc_request() to reject.
+ */
+std::string_view peek_command_name(std::span<const uint8_t> request)
+{
+    constexpr uint8_t FIXARRAY_1 = 0x91;
+    constexpr uint8_t FIXARRAY_2 = 0x92;
+    constexpr uint8_t FIXSTR_MASK = 0xe0;
+    constexpr uint8_t FIXSTR = 0xa0;
+    constexpr uint8_t STR8 = 0xd9;
+    if (request.size() < 3 || request[0] != FIXARRAY_1 || request[1] != FIXARRAY_2) {
+        return {};
+    }
+    size_t offset = 3;
+    size_t length = 0;
+    if ((request[2] & FIXSTR_MASK) == FIXSTR) {
+        length = request[2] & static_cast<uint8_t>(~FIXSTR_MASK);
+    } else if (request[2] == STR8 && request.size() > 3) {
+        length = request[3];
+        offset = 4;
+    } else {
+        return {};
+    }
+    if (offset + length > request.size()) {
+        return {};
+    }
+    return { reinterpret_cast<const char*>(request.data() + offset), length };
+}
+
+/**
+ * @brief Cheap, stateless commands, served on the fast lane so they never queue behind proving commands
+ */
+bool is_fast_lane_command(std::string_view name)
+{
+    static constexpr std::string_view FAST_LANE_COMMANDS[] = {
+        bbapi::Poseidon2Hash::MSGPACK_SCHEMA_NAME,
+        bbapi::Poseidon2Permutation::MSGPACK_SCHEMA_NAME,
+        bbapi::Poseidon2HashAccumulate::MSGPACK_SCHEMA_NAME,
+        bbapi::PedersenCommit::MSGPACK_SCHEMA_NAME,
+        bbapi::PedersenHash::MSGPACK_SCHEMA_NAME,
+        bbapi::PedersenHashBuffer::MSGPACK_SCHEMA_NAME,
+        bbapi::Blake2s::MSGPACK_SCHEMA_NAME,
+        bbapi::Blake2sToField::MSGPACK_SCHEMA_NAME,
+        bbapi::AesEncrypt::MSGPACK_SCHEMA_NAME,
+        bbapi::AesDecrypt::MSGPACK_SCHEMA_NAME,
+        bbapi::GrumpkinMul::MSGPACK_SCHEMA_NAME,
+        bbapi::GrumpkinAdd::MSGPACK_SCHEMA_NAME,
+        bbapi::GrumpkinGetRandomFr::MSGPACK_SCHEMA_NAME,
+        bbapi::GrumpkinReduce512::MSGPACK_SCHEMA_NAME,
+        bbapi::Secp256k1Mul::MSGPACK_SCHEMA_NAME,
+        bbapi::Secp256k1GetRandomFr::MSGPACK_SCHEMA_NAME,
+        bbapi::Secp256k1Reduce512::MSGPACK_SCHEMA_NAME,
+        bbapi::Bn254FrSqrt::MSGPACK_SCHEMA_NAME,
+        bbapi::Bn254FqSqrt::MSGPACK_SCHEMA_NAME,
+        bbapi::Bn254G1Mul::MSGPACK_SCHEMA_NAME,
+        bbapi::Bn254G2Mul::MSGPACK_SCHEMA_NAME,
+        bbapi::Bn254G1IsOnCurve::MSGPACK_SCHEMA_NAME,
+        bbapi::Bn254G1FromCompressed::MSGPACK_SCHEMA_NAME,
+        bbapi::SchnorrComputePublicKey::MSGPACK_SCHEMA_NAME,
+        bbapi::SchnorrConstructSignature::MSGPACK_SCHEMA_NAME,
+        bbapi::SchnorrVerifySignature::MSGPACK_SCHEMA_NAME,
+        bbapi::EcdsaSecp256k1ComputePublicKey::MSGPACK_SCHEMA_NAME,
+        bbapi::EcdsaSecp256r1ComputePublicKey::MSGPACK_SCHEMA_NAME,
+        bbapi::EcdsaSecp256k1ConstructSignature::MSGPACK_SCHEMA_NAME,
+        bbapi::EcdsaSecp256r1ConstructSignature::MSGPACK_SCHEMA_NAME,
+        bbapi::EcdsaSecp256k1RecoverPublicKey::MSGPACK_SCHEMA_NAME,
+        bbapi::EcdsaSecp256r1RecoverPublicKey::MSGPACK_SCHEMA_NAME,
+        bbapi::EcdsaSecp256k1VerifySignature::MSGPACK_SCHEMA_NAME,
+        bbapi::EcdsaSecp256r1VerifySignature::MSGPACK_SCHEMA_NAME,
+        bbapi::VkAsFields::MSGPACK_SCHEMA_NAME,
+        bbapi::MegaVkAsFields::MSGPACK_SCHEMA_NAME,
+    };
+    return std::find(std::begin(FAST_LANE_COMMANDS), std::end(FAST_LANE_COMMANDS), name) !=
+           std::end(FAST_LANE_COMMANDS);
+}
+
+/**
+ * @brief Commands replacing process-wide state (the global CRS), which must not run alongside any other command
+ */
+bool modifies_global_state(std::string_view name)
+{
+    return name == bbapi::SrsInitSrs::MSGPACK_SCHEMA_NAME || name == bbapi::SrsInitGrumpkinSrs::MSGPACK_SCHEMA_NAME;
+}
+} // namespace
+
+int execute_msgpack_ipc_server(std::unique_ptr<ipc::IpcServer> server, size_t num_workers, size_t num_fast_workers)
 {
     // Store server pointer for signal handler cleanup (works for both socket and shared memory)
     // MUST be set before listen() since SIGBUS can occur during listen()
@@ -197,84 +378,64 @@ int execute_msgpack_ipc_server(std::unique_ptr<ipc::IpcServer> server)
 
     std::cerr << "IPC server ready" << '\n';
 
-    // Run server with msgpack handler
-    server->run([](int client_id, std::span<const uint8_t> request) -> std::vector<uint8_t> {
-        try {
-            // Deserialize msgpack command
-            // The buffer should contain a tuple of arguments (array) matching the bbapi function signature.
-            // Since bbapi(Command) takes one argument, we expect a 1-element array containing the Command.
-            auto unpacked = msgpack::unpack(reinterpret_cast<const char*>(request.data()), request.size());
-            auto obj = unpacked.get();
-
-            // First, expect an array (the tuple of arguments)
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-            if (obj.type != msgpack::type::ARRAY || obj.via.array.size != 1) {
-                std::cerr << "Error: Expected an array of size 1 (tuple of arguments) from client " << client_id
-                          << '\n';
-                return {}; // Return empty to skip response
+    // Payloads passed out-of-band are read in place from the transport's blob arena, if it has one
+    const std::span<const uint8_t> blob_arena = server->blob_arena();
+    bbapi::set_blob_arena(blob_arena);
+
+    if (num_workers == 0) {
+        // Execute commands one at a time, in the order they are received, against the global bbapi state
+        server->run([](int client_id, std::span<const uint8_t> request) {
+            return handle_ipc_request(client_id, request, nullptr);
+        });
+    } else {
+        // Execute commands of different clients concurrently. Each client gets its own bbapi state, so independent
+        // clients can e.g. accumulate separate IVCs; commands replacing the global CRS run exclusively.
+        std::shared_mutex global_state_mutex;
+        std::mutex client_states_mutex;
+        std::unordered_map<int, bbapi::BBApiRequest> client_states;
+        // Client IDs are reused, so a client's state is dropped once it disconnects and its ID is released. This only
+        // happens when none of its requests is executing.
+        server->set_client_released_callback([&](int client_id) {
+            std::unique_lock lock(client_states_mutex);
+            client_states.erase(client_id);
+        });
+        // parallel_for pools are per thread, and sized by get_num_cpus() when first used on it. Left alone, every
+        // worker running a prover would start a pool using all of the cores; the cores are instead shared between the
+        // workers. The fast lane workers run cheap commands and keep the same cap.
+        const size_t cpus_per_worker = std::max<size_t>(get_num_cpus() / num_workers, 1);
+        auto handler = [&](int client_id, std::span<const uint8_t> request) {
+            thread_local bool concurrency_capped = false;
+            if (!concurrency_capped) {
+                set_parallel_for_concurrency(cpus_per_worker);
+                concurrency_capped = true;
             }
-
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-            auto& tuple_arr = obj.via.array;
-            auto& command_obj = tuple_arr.ptr[0];
-
-            // Now access the Command itself, which should be an array of size 2 [command-name, payload]
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-            if (command_obj.type != msgpack::type::ARRAY || command_obj.via.array.size != 2) {
-                std::cerr << "Error: Expected Command to be an array of size 2 [command-name, payload] from client "
-                          << client_id << '\n';
-                return {};
-            }
-
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-            auto& command_arr = command_obj.via.array;
-            if (command_arr.ptr[0].type != msgpack::type::STR) {
-                std::cerr << "Error: Expected first element of Command to be a string (type name) from client "
-                          << client_id << '\n';
-                return {};
+            bbapi::BBApiRequest* client_state = nullptr;
+            {
+                std::unique_lock lock(client_states_mutex);
+                auto [it, inserted] = client_states.try_emplace(client_id);
+                if (inserted) {
+                    it->second.blob_arena = blob_arena;
+                }
+                client_state = &it->second;
             }
-
-            // Check if this is a Shutdown command
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-            std::string command_name(command_arr.ptr[0].via.str.ptr, command_arr.ptr[0].via.str.size);
-            bool is_shutdown = (command_name == "Shutdown");
-
-            // Convert to Command and execute
-            bb::bbapi::Command command;
-            command_obj.convert(command);
-            auto response = bbapi::bbapi(std::move(command));
-
-            // Serialize response
-            msgpack::sbuffer response_buffer;
-            msgpack::pack(response_buffer, response);
-            std::vector<uint8_t> result(response_buffer.data(), response_buffer.data() + response_buffer.size());
-
-            // If this was a shutdown command, throw exception with response
-            // This signals the server to send the response and then exit gracefully
-            if (is_shutdown) {
-                throw ipc::ShutdownRequested(std::move(result));
+            if (modifies_global_state(peek_command_name(request))) {
+                std::unique_lock lock(global_state_mutex);
+                return handle_ipc_request(client_id, request, client_state);
             }
+            std::shared_lock lock(global_state_mutex);
+            return handle_ipc_request(client_id, request, client_state);
+        };
+        auto select_lane = [](std::span<const uint8_t> request) {
+            return is_fast_lane_command(peek_command_name(request)) ? ipc::IpcServer::Lane::Fast
+                                                                    : ipc::IpcServer::Lane::Default;
+        };
+        std::cerr << "Executing commands concurrently with " << num_workers << " workers and " << num_fast_workers
+                  << " fast lane workers, each using up to " << cpus_per_worker << " threads" << '\n';
+        server->run_concurrent(handler, select_lane, num_workers, num_fast_workers);
+        server->set_client_released_callback({});
+    }
 
-            return result;
-        } catch (const ipc::ShutdownRequested&) {
-            // Re-throw shutdown request
-            throw;
-        } catch (const std::exception& e) {
-            // Log error to stderr for debugging (goes to log file if logger enabled)
-            std::cerr << "Error processing request from client " << client_id << ": " << e.what() << '\n';
-            std::cerr.flush();
-
-            // Create error response with exception message
-            bb::bbapi::ErrorResponse error_response{ .message = std::string(e.what()) };
-            bb::bbapi::CommandResponse response = error_response;
-
-            // Serialize and return error response to client
-            msgpack::sbuffer response_buffer;
-            msgpack::pack(response_buffer, response);
-            return std::vector<uint8_t>(response_buffer.data(), response_buffer.data() + response_buffer.size());
-        }
-    });
-
+    bbapi::set_blob_arena({});
     server->close();
     return 0;
 }
@@ -283,7 +444,10 @@ int execute_msgpack_ipc_server(std::unique_ptr<ipc::IpcServer> server)
 int execute_msgpack_run(const std::string& msgpack_input_file,
                         [[maybe_unused]] int max_clients,
                         [[maybe_unused]] size_t request_ring_size,
-                        [[maybe_unused]] size_t response_ring_size)
+                        [[maybe_unused]] size_t response_ring_size,
+                        [[maybe_unused]] size_t num_workers,
+                        [[maybe_unused]] size_t num_fast_workers,
+                        [[maybe_unused]] size_t blob_arena_size)
 {
 #ifndef __wasm__
     // Check if this is a shared memory path (ends with .shm)
@@ -291,9 +455,9 @@ int execute_msgpack_run(const std::string& msgpack_input_file,
         msgpack_input_file.substr(msgpack_input_file.size() - 4) == ".shm") {
         // Strip .shm suffix to get base name
         std::string base_name = msgpack_input_file.substr(0, msgpack_input_file.size() - 4);
-        auto server = ipc::IpcServer::create_shm(base_name, request_ring_size, response_ring_size);
+        auto server = ipc::IpcServer::create_shm(base_name, request_ring_size, response_ring_size, blob_arena_size);
         std::cerr << "Shared memory server at " << base_name << '\n';
-        return execute_msgpack_ipc_server(std::move(server));
+        return execute_msgpack_ipc_server(std::move(server), num_workers, num_fast_workers);
     }
 
     // Check if this is a Unix domain socket path (ends with .sock)
@@ -302,7 +466,7 @@ int execute_msgpack_run(const std::string& msgpack_input_file,
         // Socket server still supports max_clients (multiple clients via MPSC)
         auto server = ipc::IpcServer::create_socket(msgpack_input_file, max_clients);
         std::cerr << "Socket server at " << msgpack_input_file << '\n';
-        return execute_msgpack_ipc_server(std::move(server));
+        return execute_msgpack_ipc_server(std::move(server), num_workers, num_fast_workers);
     }
 #endif
 
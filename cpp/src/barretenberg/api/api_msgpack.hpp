@@ -35,10 +35,19 @@ int process_msgpack_commands(std::istream& input_stream);
  * Clients can send msgpack commands independently, and responses are automatically
  * routed back to the correct client.
  *
+ * With num_workers > 0, commands of different clients execute concurrently on a worker pool, each client against its
+ * own bbapi state; commands of one client still execute, and are answered, in order. Cheap crypto commands (hashes,
+ * curve operations, signatures) run on num_fast_workers reserved workers so they are not delayed by proving commands
+ * of other clients.
+ *
  * @param server IPC server instance (socket or shared memory)
+ * @param num_workers Number of workers executing commands concurrently (0 = execute commands one at a time)
+ * @param num_fast_workers Number of workers reserved for cheap commands (only used if num_workers > 0)
  * @return int Status code: 0 for success, non-zero for errors
  */
-int execute_msgpack_ipc_server(std::unique_ptr<ipc::IpcServer> server);
+int execute_msgpack_ipc_server(std::unique_ptr<ipc::IpcServer> server,
+                               size_t num_workers = 0,
+                               size_t num_fast_workers = 1);
 #endif
 
 /**
@@ -53,11 +62,17 @@ int execute_msgpack_ipc_server(std::unique_ptr<ipc::IpcServer> server);
  * @param max_clients Maximum number of concurrent clients for IPC servers (default: 1)
  * @param request_ring_size Request ring buffer size for shared memory (default: 1MB)
  * @param response_ring_size Response ring buffer size for shared memory (default: 1MB)
+ * @param num_workers Number of workers executing IPC commands concurrently (default: 0, one command at a time)
+ * @param num_fast_workers Number of workers reserved for cheap IPC commands (default: 1)
+ * @param blob_arena_size Size of the shared memory arena for out-of-band payloads (default: 0, no arena)
  * @return int Status code: 0 for success, non-zero for errors
  */
 int execute_msgpack_run(const std::string& msgpack_input_file,
                         int max_clients = 1,
                         size_t request_ring_size = 1024UL * 1024,
-                        size_t response_ring_size = 1024UL * 1024);
+                        size_t response_ring_size = 1024UL * 1024,
+                        size_t num_workers = 0,
+                        size_t num_fast_workers = 1,
+                        size_t blob_arena_size = 0);
 
 } // namespace bb
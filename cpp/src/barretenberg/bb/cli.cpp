@@ -576,12 +576,28 @@ int parse_and_run_cli_command(int argc, char* argv[])
                      response_ring_size,
                      "Response ring buffer size for shared memory IPC (default: 1MB)")
         ->check(CLI::PositiveNumber);
+    size_t blob_arena_size = 0;
+    msgpack_run_command->add_option("--blob-arena-size",
+                                    blob_arena_size,
+                                    "Size of the shared memory arena through which clients pass large payloads such as "
+                                    "bytecode and witnesses out-of-band (default: 0, disabled; only used for .shm)");
     int max_clients = 1;
     msgpack_run_command
         ->add_option("--max-clients",
                      max_clients,
                      "Maximum concurrent clients for socket IPC servers (default: 1, only used for .sock files)")
         ->check(CLI::PositiveNumber);
+    size_t num_workers = 0;
+    msgpack_run_command->add_option("--workers",
+                                    num_workers,
+                                    "Number of workers executing commands of different IPC clients concurrently "
+                                    "(default: 0, execute commands one at a time)");
+    size_t num_fast_workers = 1;
+    msgpack_run_command
+        ->add_option("--fast-workers",
+                     num_fast_workers,
+                     "Number of workers reserved for cheap crypto commands when --workers is set (default: 1)")
+        ->check(CLI::PositiveNumber);
 
     /***************************************************************************************************************
      * Build the CLI11 App
@@ -655,7 +671,13 @@ int parse_and_run_cli_command(int argc, char* argv[])
             return 0;
         }
         if (msgpack_run_command->parsed()) {
-            return execute_msgpack_run(msgpack_input_file, max_clients, request_ring_size, response_ring_size);
+            return execute_msgpack_run(msgpack_input_file,
+                                       max_clients,
+                                       request_ring_size,
+                                       response_ring_size,
+                                       num_workers,
+                                       num_fast_workers,
+                                       blob_arena_size);
         }
         if (aztec_process->parsed()) {
 #ifdef __wasm__
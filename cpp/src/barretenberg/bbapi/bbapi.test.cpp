@@ -3,7 +3,9 @@
 #include "barretenberg/common/utils.hpp"
 #include "barretenberg/serialize/test_helper.hpp"
 #include "msgpack/v3/sbuffer_decl.hpp"
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <numeric>
 
 using namespace bb;
 
@@ -42,3 +44,28 @@ TYPED_TEST(BBApiMsgpack, DefaultConstructorRoundtrip)
     EXPECT_EQ(actual_response, expected_response);
     std::cout << msgpack_schema_to_string(command) << " " << msgpack_schema_to_string(response) << std::endl;
 }
+
+/**
+ * @brief A BlobRef resolves to its bytes in the request's blob arena, and out-of-bounds references are rejected
+ */
+TEST(BBApiBlobRef, ResolvesIntoBlobArena)
+{
+    std::vector<uint8_t> arena(256);
+    std::iota(arena.begin(), arena.end(), uint8_t(0));
+    bbapi::BBApiRequest request;
+    request.blob_arena = arena;
+
+    std::vector<uint8_t> inline_bytes{ 1, 2, 3 };
+    EXPECT_TRUE(std::ranges::equal(bbapi::resolve_bytes(request, inline_bytes, std::nullopt), inline_bytes));
+
+    const bbapi::BlobRef blob{ .offset = 64, .size = 32 };
+    auto bytes = bbapi::resolve_bytes(request, inline_bytes, blob);
+    EXPECT_EQ(bytes.data(), arena.data() + 64);
+    EXPECT_EQ(bytes.size(), 32U);
+    EXPECT_EQ(bbapi::take_bytes(request, inline_bytes, blob),
+              std::vector<uint8_t>(arena.begin() + 64, arena.begin() + 96));
+    EXPECT_EQ(inline_bytes.size(), 3U);
+
+    EXPECT_THROW_OR_ABORT(bbapi::resolve_bytes(request, inline_bytes, bbapi::BlobRef{ .offset = 250, .size = 8 }),
+                          ".*out of bounds.*");
+}
@@ -30,7 +30,8 @@ ChonkLoad::Response ChonkLoad::execute(BBApiRequest& request) &&
     }
 
     request.loaded_circuit_name = circuit.name;
-    request.loaded_circuit_constraints = acir_format::circuit_buf_to_acir_format(std::move(circuit.bytecode));
+    request.loaded_circuit_constraints =
+        acir_format::circuit_buf_to_acir_format(take_bytes(request, circuit.bytecode, circuit.bytecode_blob));
     request.loaded_circuit_vk = circuit.verification_key;
 
     info("ChonkLoad - loaded circuit '", request.loaded_circuit_name, "'");
@@ -49,7 +50,8 @@ ChonkAccumulate::Response ChonkAccumulate::execute(BBApiRequest& request) &&
         throw_or_abort("No circuit loaded. Call ChonkLoad first.");
     }
 
-    acir_format::WitnessVector witness_data = acir_format::witness_buf_to_witness_vector(std::move(witness));
+    acir_format::WitnessVector witness_data =
+        acir_format::witness_buf_to_witness_vector(resolve_bytes(request, witness, witness_blob));
     acir_format::AcirProgram program{ std::move(request.loaded_circuit_constraints.value()), std::move(witness_data) };
 
     const acir_format::ProgramMetadata metadata{ .ivc = request.ivc_in_progress };
@@ -183,11 +185,13 @@ ChonkComputeIvcVk::Response ChonkComputeIvcVk::execute(BB_UNUSED const BBApiRequ
     return response;
 }
 
-ChonkCheckPrecomputedVk::Response ChonkCheckPrecomputedVk::execute([[maybe_unused]] const BBApiRequest& request) &&
+ChonkCheckPrecomputedVk::Response ChonkCheckPrecomputedVk::execute(const BBApiRequest& request) &&
 {
     BB_BENCH_NAME(MSGPACK_SCHEMA_NAME);
-    acir_format::AcirProgram program{ acir_format::circuit_buf_to_acir_format(std::move(circuit.bytecode)),
-                                      /*witness=*/{} };
+    acir_format::AcirProgram program{
+        acir_format::circuit_buf_to_acir_format(take_bytes(request, circuit.bytecode, circuit.bytecode_blob)),
+        /*witness=*/{}
+    };
 
     std::shared_ptr<Chonk::ProverInstance> prover_instance = get_acir_program_prover_instance(program);
     auto computed_vk = std::make_shared<Chonk::MegaVerificationKey>(prover_instance->get_precomputed());
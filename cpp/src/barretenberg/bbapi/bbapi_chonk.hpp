@@ -86,8 +86,10 @@ struct ChonkAccumulate {
 
     /** @brief Serialized witness data for the last loaded circuit */
     std::vector<uint8_t> witness;
+    /** @brief Location of the witness in the blob arena, set instead of `witness` to pass the witness out-of-band */
+    std::optional<BlobRef> witness_blob;
     Response execute(BBApiRequest& request) &&;
-    MSGPACK_FIELDS(witness);
+    MSGPACK_FIELDS(witness, witness_blob);
     bool operator==(const ChonkAccumulate&) const = default;
 };
 
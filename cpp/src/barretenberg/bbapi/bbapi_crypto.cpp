@@ -3,6 +3,7 @@
  * @brief Implementation of cryptographic command execution for the Barretenberg RPC API
  */
 #include "barretenberg/bbapi/bbapi_crypto.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/crypto/aes128/aes128.hpp"
 #include "barretenberg/crypto/blake2s/blake2s.hpp"
@@ -10,14 +11,32 @@
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
 #include "barretenberg/crypto/poseidon2/poseidon2.hpp"
 #include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
+#include <algorithm>
 
 namespace bb::bbapi {
 
+namespace {
+// Rough per-input costs of the batch commands, in the units of thread_heuristics, for short (few-element) inputs
+constexpr size_t POSEIDON2_HASH_COST = 2 * 300 * thread_heuristics::FF_MULTIPLICATION_COST;
+constexpr size_t PEDERSEN_HASH_COST = 4 * thread_heuristics::GE_ADDITION_COST * 256;
+constexpr size_t BLAKE2S_COST = 1000;
+} // namespace
+
 Poseidon2Hash::Response Poseidon2Hash::execute(BB_UNUSED BBApiRequest& request) &&
 {
     return { crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash(inputs) };
 }
 
+Poseidon2HashBatch::Response Poseidon2HashBatch::execute(BB_UNUSED BBApiRequest& request) &&
+{
+    std::vector<fr> hashes(inputs.size());
+    parallel_for_heuristic(
+        inputs.size(),
+        [&](size_t i) { hashes[i] = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>::hash(inputs[i]); },
+        POSEIDON2_HASH_COST);
+    return { std::move(hashes) };
+}
+
 Poseidon2Permutation::Response Poseidon2Permutation::execute(BB_UNUSED BBApiRequest& request) &&
 {
     using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
@@ -54,6 +73,26 @@ PedersenHash::Response PedersenHash::execute(BB_UNUSED BBApiRequest& request) &&
     return { crypto::pedersen_hash::hash(inputs, ctx) };
 }
 
+PedersenHashBatch::Response PedersenHashBatch::execute(BB_UNUSED BBApiRequest& request) &&
+{
+    crypto::GeneratorContext<curve::Grumpkin> ctx;
+    ctx.offset = static_cast<size_t>(hash_index);
+    // Build the fixed-base tables of the generators for the longest input up front, so that the hashes only look them
+    // up rather than all building them under the cache lock
+    size_t max_input_size = 0;
+    for (const auto& input : inputs) {
+        max_input_size = std::max(max_input_size, input.size());
+    }
+    static_cast<void>(ctx.generators->get_fixed_base_tables(max_input_size, ctx.offset, ctx.domain_separator));
+
+    std::vector<grumpkin::fq> hashes(inputs.size());
+    parallel_for_heuristic(
+        inputs.size(),
+        [&](size_t i) { hashes[i] = crypto::pedersen_hash::hash(inputs[i], ctx); },
+        PEDERSEN_HASH_COST * (max_input_size + 1));
+    return { std::move(hashes) };
+}
+
 PedersenHashBuffer::Response PedersenHashBuffer::execute(BB_UNUSED BBApiRequest& request) &&
 {
     crypto::GeneratorContext<curve::Grumpkin> ctx;
@@ -66,6 +105,13 @@ Blake2s::Response Blake2s::execute(BB_UNUSED BBApiRequest& request) &&
     return { crypto::blake2s(data) };
 }
 
+Blake2sBatch::Response Blake2sBatch::execute(BB_UNUSED BBApiRequest& request) &&
+{
+    std::vector<std::array<uint8_t, 32>> hashes(data.size());
+    parallel_for_heuristic(data.size(), [&](size_t i) { hashes[i] = crypto::blake2s(data[i]); }, BLAKE2S_COST);
+    return { std::move(hashes) };
+}
+
 Blake2sToField::Response Blake2sToField::execute(BB_UNUSED BBApiRequest& request) &&
 {
     auto hash_result = crypto::blake2s(data);
@@ -4,7 +4,8 @@
  * @brief Cryptographic primitives command definitions for the Barretenberg RPC API.
  *
  * This file contains command structures for cryptographic operations including
- * Poseidon2, Pedersen, Blake2s, and AES.
+ * Poseidon2, Pedersen, Blake2s, and AES. The *Batch commands process many independent inputs in a single call, in
+ * parallel, to amortise the per-call overhead of the API.
  */
 #include "barretenberg/bbapi/bbapi_shared.hpp"
 #include "barretenberg/common/named_union.hpp"
@@ -37,6 +38,26 @@ struct Poseidon2Hash {
     bool operator==(const Poseidon2Hash&) const = default;
 };
 
+/**
+ * @struct Poseidon2HashBatch
+ * @brief Compute the Poseidon2 hashes of several independent inputs
+ */
+struct Poseidon2HashBatch {
+    static constexpr const char MSGPACK_SCHEMA_NAME[] = "Poseidon2HashBatch";
+
+    struct Response {
+        static constexpr const char MSGPACK_SCHEMA_NAME[] = "Poseidon2HashBatchResponse";
+        std::vector<fr> hashes;
+        MSGPACK_FIELDS(hashes);
+        bool operator==(const Response&) const = default;
+    };
+
+    std::vector<std::vector<fr>> inputs;
+    Response execute(BBApiRequest& request) &&;
+    MSGPACK_FIELDS(inputs);
+    bool operator==(const Poseidon2HashBatch&) const = default;
+};
+
 /**
  * @struct Poseidon2Permutation
  * @brief Compute Poseidon2 permutation on state (4 field elements)
@@ -119,6 +140,27 @@ struct PedersenHash {
     bool operator==(const PedersenHash&) const = default;
 };
 
+/**
+ * @struct PedersenHashBatch
+ * @brief Compute the Pedersen hashes of several independent inputs, all with the same hash index
+ */
+struct PedersenHashBatch {
+    static constexpr const char MSGPACK_SCHEMA_NAME[] = "PedersenHashBatch";
+
+    struct Response {
+        static constexpr const char MSGPACK_SCHEMA_NAME[] = "PedersenHashBatchResponse";
+        std::vector<grumpkin::fq> hashes;
+        MSGPACK_FIELDS(hashes);
+        bool operator==(const Response&) const = default;
+    };
+
+    std::vector<std::vector<grumpkin::fq>> inputs;
+    uint32_t hash_index;
+    Response execute(BBApiRequest& request) &&;
+    MSGPACK_FIELDS(inputs, hash_index);
+    bool operator==(const PedersenHashBatch&) const = default;
+};
+
 /**
  * @struct PedersenHashBuffer
  * @brief Compute Pedersen hash of raw buffer
@@ -160,6 +202,26 @@ struct Blake2s {
     bool operator==(const Blake2s&) const = default;
 };
 
+/**
+ * @struct Blake2sBatch
+ * @brief Compute the Blake2s hashes of several independent inputs
+ */
+struct Blake2sBatch {
+    static constexpr const char MSGPACK_SCHEMA_NAME[] = "Blake2sBatch";
+
+    struct Response {
+        static constexpr const char MSGPACK_SCHEMA_NAME[] = "Blake2sBatchResponse";
+        std::vector<std::array<uint8_t, 32>> hashes;
+        MSGPACK_FIELDS(hashes);
+        bool operator==(const Response&) const = default;
+    };
+
+    std::vector<std::vector<uint8_t>> data;
+    Response execute(BBApiRequest& request) &&;
+    MSGPACK_FIELDS(data);
+    bool operator==(const Blake2sBatch&) const = default;
+};
+
 /**
  * @struct Blake2sToField
  * @brief Compute Blake2s hash and convert to field element
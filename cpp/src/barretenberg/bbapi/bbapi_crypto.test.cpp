@@ -0,0 +1,124 @@
+#include "barretenberg/bbapi/bbapi_crypto.hpp"
+#include "barretenberg/bbapi/bbapi_ecc.hpp"
+#include "barretenberg/bbapi/bbapi_ecdsa.hpp"
+#include "barretenberg/bbapi/bbapi_schnorr.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace bb::bbapi;
+
+namespace {
+
+constexpr size_t BATCH_SIZE = 33;
+
+std::vector<uint8_t> message(size_t i)
+{
+    std::string str = "message " + std::to_string(i);
+    return { str.begin(), str.end() };
+}
+
+} // namespace
+
+/**
+ * @brief Each batched hash equals the hash computed by the corresponding single command
+ */
+TEST(BBApiBatchCommands, HashesMatchSingleCommands)
+{
+    BBApiRequest request;
+    std::vector<std::vector<fr>> poseidon_inputs;
+    std::vector<std::vector<grumpkin::fq>> pedersen_inputs;
+    std::vector<std::vector<uint8_t>> blake_inputs;
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        poseidon_inputs.emplace_back(i % 5 + 1);
+        pedersen_inputs.emplace_back(i % 7 + 1);
+        for (auto& input : poseidon_inputs.back()) {
+            input = fr::random_element();
+        }
+        for (auto& input : pedersen_inputs.back()) {
+            input = grumpkin::fq::random_element();
+        }
+        blake_inputs.push_back(message(i));
+    }
+
+    auto poseidon = Poseidon2HashBatch{ poseidon_inputs }.execute(request);
+    auto pedersen = PedersenHashBatch{ pedersen_inputs, 3 }.execute(request);
+    auto blake = Blake2sBatch{ blake_inputs }.execute(request);
+    ASSERT_EQ(poseidon.hashes.size(), BATCH_SIZE);
+    ASSERT_EQ(pedersen.hashes.size(), BATCH_SIZE);
+    ASSERT_EQ(blake.hashes.size(), BATCH_SIZE);
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        EXPECT_EQ(poseidon.hashes[i], Poseidon2Hash{ poseidon_inputs[i] }.execute(request).hash);
+        EXPECT_EQ(pedersen.hashes[i], PedersenHash{ pedersen_inputs[i], 3 }.execute(request).hash);
+        EXPECT_EQ(blake.hashes[i], Blake2s{ blake_inputs[i] }.execute(request).hash);
+    }
+
+    EXPECT_TRUE(Poseidon2HashBatch{}.execute(request).hashes.empty());
+    EXPECT_TRUE(PedersenHashBatch{}.execute(request).hashes.empty());
+    EXPECT_TRUE(Blake2sBatch{}.execute(request).hashes.empty());
+}
+
+/**
+ * @brief Batched G1 multiplication matches single multiplications, including a product at infinity
+ */
+TEST(BBApiBatchCommands, Bn254G1MulMatchesSingleCommand)
+{
+    BBApiRequest request;
+    Bn254G1MulBatch batch;
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        batch.points.push_back(g1::affine_element::random_element());
+        batch.scalars.push_back(i == 0 ? fr::zero() : fr::random_element());
+    }
+    auto points = batch.points;
+    auto scalars = batch.scalars;
+
+    auto result = std::move(batch).execute(request);
+    ASSERT_EQ(result.points.size(), BATCH_SIZE);
+    EXPECT_TRUE(result.points[0].is_point_at_infinity());
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        EXPECT_EQ(result.points[i], Bn254G1Mul{ points[i], scalars[i] }.execute(request).point);
+    }
+
+    BBApiRequest mismatched_request;
+    Bn254G1MulBatch{ points, {} }.execute(mismatched_request);
+    EXPECT_FALSE(mismatched_request.error_message.empty());
+}
+
+/**
+ * @brief Batched signature verification reports the validity of each signature individually
+ */
+TEST(BBApiBatchCommands, SignatureVerificationReportsEachSignature)
+{
+    BBApiRequest request;
+    SchnorrVerifySignatureBatch schnorr;
+    EcdsaSecp256k1VerifySignatureBatch k1;
+    EcdsaSecp256r1VerifySignatureBatch r1;
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        auto schnorr_key = grumpkin::fr::random_element();
+        auto schnorr_signature = SchnorrConstructSignature{ message(i), schnorr_key }.execute(request);
+        schnorr.signatures.push_back({ message(i), grumpkin::g1::one * schnorr_key, schnorr_signature.s,
+                                       schnorr_signature.e });
+
+        auto k1_key = secp256k1::fr::random_element();
+        auto k1_signature = EcdsaSecp256k1ConstructSignature{ message(i), k1_key }.execute(request);
+        k1.signatures.push_back(
+            { message(i), secp256k1::g1::one * k1_key, k1_signature.r, k1_signature.s, k1_signature.v });
+
+        auto r1_key = secp256r1::fr::random_element();
+        auto r1_signature = EcdsaSecp256r1ConstructSignature{ message(i), r1_key }.execute(request);
+        r1.signatures.push_back(
+            { message(i), secp256r1::g1::one * r1_key, r1_signature.r, r1_signature.s, r1_signature.v });
+    }
+    // Sign a different message than the one being verified for a few entries
+    std::vector<bool> expected(BATCH_SIZE, true);
+    for (size_t i : { 1UL, 17UL, BATCH_SIZE - 1 }) {
+        schnorr.signatures[i].message = message(i + 1);
+        k1.signatures[i].message = message(i + 1);
+        r1.signatures[i].message = message(i + 1);
+        expected[i] = false;
+    }
+
+    EXPECT_EQ(std::move(schnorr).execute(request).verified, expected);
+    EXPECT_EQ(std::move(k1).execute(request).verified, expected);
+    EXPECT_EQ(std::move(r1).execute(request).verified, expected);
+    EXPECT_TRUE(request.error_message.empty());
+}
@@ -3,6 +3,7 @@
  * @brief Implementation of elliptic curve command execution for the Barretenberg RPC API
  */
 #include "barretenberg/bbapi/bbapi_ecc.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace bb::bbapi {
 
@@ -94,6 +95,32 @@ Bn254G1Mul::Response Bn254G1Mul::execute(BBApiRequest& request) &&
     return { result };
 }
 
+Bn254G1MulBatch::Response Bn254G1MulBatch::execute(BBApiRequest& request) &&
+{
+    if (points.size() != scalars.size()) {
+        BBAPI_ERROR(request, "Number of points must match number of scalars");
+    }
+    for (const auto& p : points) {
+        if (!p.on_curve()) {
+            BBAPI_ERROR(request, "Input point must be on the curve");
+        }
+    }
+    // Multiply in projective coordinates and normalize all results with a single shared inversion
+    std::vector<g1::element> products(points.size());
+    parallel_for_heuristic(
+        points.size(),
+        [&](size_t i) { products[i] = g1::element(points[i]) * scalars[i]; },
+        thread_heuristics::SM_COST);
+    g1::element::batch_normalize(products.data(), products.size());
+
+    std::vector<g1::affine_element> output(products.size());
+    for (size_t i = 0; i < products.size(); ++i) {
+        output[i] = products[i].is_point_at_infinity() ? g1::affine_element::infinity()
+                                                       : g1::affine_element(products[i].x, products[i].y);
+    }
+    return { std::move(output) };
+}
+
 Bn254G2Mul::Response Bn254G2Mul::execute(BBApiRequest& request) &&
 {
     if (!point.on_curve()) {
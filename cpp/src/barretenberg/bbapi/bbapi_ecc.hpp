@@ -248,6 +248,27 @@ struct Bn254G1Mul {
     bool operator==(const Bn254G1Mul&) const = default;
 };
 
+/**
+ * @struct Bn254G1MulBatch
+ * @brief Multiply several BN254 G1 points, each by its own scalar
+ */
+struct Bn254G1MulBatch {
+    static constexpr const char MSGPACK_SCHEMA_NAME[] = "Bn254G1MulBatch";
+
+    struct Response {
+        static constexpr const char MSGPACK_SCHEMA_NAME[] = "Bn254G1MulBatchResponse";
+        std::vector<bb::g1::affine_element> points;
+        MSGPACK_FIELDS(points);
+        bool operator==(const Response&) const = default;
+    };
+
+    std::vector<bb::g1::affine_element> points;
+    std::vector<bb::fr> scalars;
+    Response execute(BBApiRequest& request) &&;
+    MSGPACK_FIELDS(points, scalars);
+    bool operator==(const Bn254G1MulBatch&) const = default;
+};
+
 /**
  * @struct Bn254G2Mul
  * @brief Multiply a BN254 G2 point by a scalar
@@ -7,6 +7,28 @@
 
 namespace bb::bbapi {
 
+namespace {
+/**
+ * @brief Verify a batch of signatures with one combined multi-scalar multiplication, see ecdsa_verify_signatures
+ */
+template <typename Fq, typename Fr, typename G1, typename VerifySignature>
+std::vector<bool> verify_signatures(const std::vector<VerifySignature>& signatures)
+{
+    std::vector<std::string> messages;
+    std::vector<typename G1::affine_element> public_keys;
+    std::vector<crypto::ecdsa_signature> sigs;
+    messages.reserve(signatures.size());
+    public_keys.reserve(signatures.size());
+    sigs.reserve(signatures.size());
+    for (const auto& signature : signatures) {
+        messages.emplace_back(signature.message.begin(), signature.message.end());
+        public_keys.emplace_back(signature.public_key);
+        sigs.push_back({ signature.r, signature.s, signature.v });
+    }
+    return crypto::ecdsa_verify_signatures<crypto::Sha256Hasher, Fq, Fr, G1>(messages, public_keys, sigs);
+}
+} // namespace
+
 // Secp256k1 implementations
 EcdsaSecp256k1ComputePublicKey::Response EcdsaSecp256k1ComputePublicKey::execute(BB_UNUSED BBApiRequest& request) &&
 {
@@ -41,6 +63,12 @@ EcdsaSecp256k1VerifySignature::Response EcdsaSecp256k1VerifySignature::execute(B
         message_str, public_key, sig) };
 }
 
+EcdsaSecp256k1VerifySignatureBatch::Response EcdsaSecp256k1VerifySignatureBatch::execute(
+    BB_UNUSED BBApiRequest& request) &&
+{
+    return { verify_signatures<secp256k1::fq, secp256k1::fr, secp256k1::g1>(signatures) };
+}
+
 // Secp256r1 implementations
 EcdsaSecp256r1ComputePublicKey::Response EcdsaSecp256r1ComputePublicKey::execute(BB_UNUSED BBApiRequest& request) &&
 {
@@ -75,4 +103,10 @@ EcdsaSecp256r1VerifySignature::Response EcdsaSecp256r1VerifySignature::execute(B
         message_str, public_key, sig) };
 }
 
+EcdsaSecp256r1VerifySignatureBatch::Response EcdsaSecp256r1VerifySignatureBatch::execute(
+    BB_UNUSED BBApiRequest& request) &&
+{
+    return { verify_signatures<secp256r1::fq, secp256r1::fr, secp256r1::g1>(signatures) };
+}
+
 } // namespace bb::bbapi
@@ -175,6 +175,26 @@ struct EcdsaSecp256k1VerifySignature {
     bool operator==(const EcdsaSecp256k1VerifySignature&) const = default;
 };
 
+/**
+ * @struct EcdsaSecp256k1VerifySignatureBatch
+ * @brief Verify several independent ECDSA signatures for secp256k1
+ */
+struct EcdsaSecp256k1VerifySignatureBatch {
+    static constexpr const char MSGPACK_SCHEMA_NAME[] = "EcdsaSecp256k1VerifySignatureBatch";
+
+    struct Response {
+        static constexpr const char MSGPACK_SCHEMA_NAME[] = "EcdsaSecp256k1VerifySignatureBatchResponse";
+        std::vector<bool> verified;
+        MSGPACK_FIELDS(verified);
+        bool operator==(const Response&) const = default;
+    };
+
+    std::vector<EcdsaSecp256k1VerifySignature> signatures;
+    Response execute(BBApiRequest& request) &&;
+    MSGPACK_FIELDS(signatures);
+    bool operator==(const EcdsaSecp256k1VerifySignatureBatch&) const = default;
+};
+
 /**
  * @struct EcdsaSecp256r1VerifySignature
  * @brief Verify an ECDSA signature for secp256r1
@@ -199,4 +219,24 @@ struct EcdsaSecp256r1VerifySignature {
     bool operator==(const EcdsaSecp256r1VerifySignature&) const = default;
 };
 
+/**
+ * @struct EcdsaSecp256r1VerifySignatureBatch
+ * @brief Verify several independent ECDSA signatures for secp256r1
+ */
+struct EcdsaSecp256r1VerifySignatureBatch {
+    static constexpr const char MSGPACK_SCHEMA_NAME[] = "EcdsaSecp256r1VerifySignatureBatch";
+
+    struct Response {
+        static constexpr const char MSGPACK_SCHEMA_NAME[] = "EcdsaSecp256r1VerifySignatureBatchResponse";
+        std::vector<bool> verified;
+        MSGPACK_FIELDS(verified);
+        bool operator==(const Response&) const = default;
+    };
+
+    std::vector<EcdsaSecp256r1VerifySignature> signatures;
+    Response execute(BBApiRequest& request) &&;
+    MSGPACK_FIELDS(signatures);
+    bool operator==(const EcdsaSecp256r1VerifySignatureBatch&) const = default;
+};
+
 } // namespace bb::bbapi
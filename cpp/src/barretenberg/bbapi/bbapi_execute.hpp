@@ -30,12 +30,15 @@ using Command = NamedUnion<CircuitProve,
                            ChonkCheckPrecomputedVk,
                            ChonkStats,
                            Poseidon2Hash,
+                           Poseidon2HashBatch,
                            Poseidon2Permutation,
                            Poseidon2HashAccumulate,
                            PedersenCommit,
                            PedersenHash,
+                           PedersenHashBatch,
                            PedersenHashBuffer,
                            Blake2s,
+                           Blake2sBatch,
                            Blake2sToField,
                            AesEncrypt,
                            AesDecrypt,
@@ -50,12 +53,14 @@ using Command = NamedUnion<CircuitProve,
                            Bn254FrSqrt,
                            Bn254FqSqrt,
                            Bn254G1Mul,
+                           Bn254G1MulBatch,
                            Bn254G2Mul,
                            Bn254G1IsOnCurve,
                            Bn254G1FromCompressed,
                            SchnorrComputePublicKey,
                            SchnorrConstructSignature,
                            SchnorrVerifySignature,
+                           SchnorrVerifySignatureBatch,
                            EcdsaSecp256k1ComputePublicKey,
                            EcdsaSecp256r1ComputePublicKey,
                            EcdsaSecp256k1ConstructSignature,
@@ -63,7 +68,9 @@ using Command = NamedUnion<CircuitProve,
                            EcdsaSecp256k1RecoverPublicKey,
                            EcdsaSecp256r1RecoverPublicKey,
                            EcdsaSecp256k1VerifySignature,
+                           EcdsaSecp256k1VerifySignatureBatch,
                            EcdsaSecp256r1VerifySignature,
+                           EcdsaSecp256r1VerifySignatureBatch,
                            SrsInitSrs,
                            SrsInitGrumpkinSrs,
                            Shutdown>;
@@ -86,12 +93,15 @@ using CommandResponse = NamedUnion<ErrorResponse,
                                    ChonkCheckPrecomputedVk::Response,
                                    ChonkStats::Response,
                                    Poseidon2Hash::Response,
+                                   Poseidon2HashBatch::Response,
                                    Poseidon2Permutation::Response,
                                    Poseidon2HashAccumulate::Response,
                                    PedersenCommit::Response,
                                    PedersenHash::Response,
+                                   PedersenHashBatch::Response,
                                    PedersenHashBuffer::Response,
                                    Blake2s::Response,
+                                   Blake2sBatch::Response,
                                    Blake2sToField::Response,
                                    AesEncrypt::Response,
                                    AesDecrypt::Response,
@@ -106,12 +116,14 @@ using CommandResponse = NamedUnion<ErrorResponse,
                                    Bn254FrSqrt::Response,
                                    Bn254FqSqrt::Response,
                                    Bn254G1Mul::Response,
+                                   Bn254G1MulBatch::Response,
                                    Bn254G2Mul::Response,
                                    Bn254G1IsOnCurve::Response,
                                    Bn254G1FromCompressed::Response,
                                    SchnorrComputePublicKey::Response,
                                    SchnorrConstructSignature::Response,
                                    SchnorrVerifySignature::Response,
+                                   SchnorrVerifySignatureBatch::Response,
                                    EcdsaSecp256k1ComputePublicKey::Response,
                                    EcdsaSecp256r1ComputePublicKey::Response,
                                    EcdsaSecp256k1ConstructSignature::Response,
@@ -119,7 +131,9 @@ using CommandResponse = NamedUnion<ErrorResponse,
                                    EcdsaSecp256k1RecoverPublicKey::Response,
                                    EcdsaSecp256r1RecoverPublicKey::Response,
                                    EcdsaSecp256k1VerifySignature::Response,
+                                   EcdsaSecp256k1VerifySignatureBatch::Response,
                                    EcdsaSecp256r1VerifySignature::Response,
+                                   EcdsaSecp256r1VerifySignatureBatch::Response,
                                    SrsInitSrs::Response,
                                    SrsInitGrumpkinSrs::Response,
                                    Shutdown::Response>;
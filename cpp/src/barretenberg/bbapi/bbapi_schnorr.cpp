@@ -33,4 +33,21 @@ SchnorrVerifySignature::Response SchnorrVerifySignature::execute(BB_UNUSED BBApi
     return { result };
 }
 
+SchnorrVerifySignatureBatch::Response SchnorrVerifySignatureBatch::execute(BB_UNUSED BBApiRequest& request) &&
+{
+    std::vector<std::string> messages;
+    std::vector<grumpkin::g1::affine_element> public_keys;
+    std::vector<crypto::schnorr_signature> sigs;
+    messages.reserve(signatures.size());
+    public_keys.reserve(signatures.size());
+    sigs.reserve(signatures.size());
+    for (const auto& signature : signatures) {
+        messages.emplace_back(signature.message.begin(), signature.message.end());
+        public_keys.emplace_back(signature.public_key);
+        sigs.push_back({ signature.s, signature.e });
+    }
+    return { crypto::schnorr_verify_signatures<crypto::Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+        messages, public_keys, sigs) };
+}
+
 } // namespace bb::bbapi
@@ -82,4 +82,24 @@ struct SchnorrVerifySignature {
     bool operator==(const SchnorrVerifySignature&) const = default;
 };
 
+/**
+ * @struct SchnorrVerifySignatureBatch
+ * @brief Verify several independent Schnorr signatures
+ */
+struct SchnorrVerifySignatureBatch {
+    static constexpr const char MSGPACK_SCHEMA_NAME[] = "SchnorrVerifySignatureBatch";
+
+    struct Response {
+        static constexpr const char MSGPACK_SCHEMA_NAME[] = "SchnorrVerifySignatureBatchResponse";
+        std::vector<bool> verified;
+        MSGPACK_FIELDS(verified);
+        bool operator==(const Response&) const = default;
+    };
+
+    std::vector<SchnorrVerifySignature> signatures;
+    Response execute(BBApiRequest& request) &&;
+    MSGPACK_FIELDS(signatures);
+    bool operator==(const SchnorrVerifySignatureBatch&) const = default;
+};
+
 } // namespace bb::bbapi
@@ -8,9 +8,12 @@
  */
 
 #include "barretenberg/chonk/chonk.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/dsl/acir_format/acir_format.hpp"
 #include "barretenberg/honk/execution_trace/mega_execution_trace.hpp"
 #include <cstdint>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -27,6 +30,24 @@ enum class VkPolicy {
     REWRITE    // Check the VK and rewrite the input file with correct VK if mismatch (for check command)
 };
 
+/**
+ * @struct BlobRef
+ * @brief A payload passed out-of-band of the request, in the blob arena of the shared memory transport
+ *
+ * Large payloads (bytecode, witnesses) referenced this way are read in place instead of being copied through the
+ * transport's rings and the msgpack decoder. The client must leave the region untouched until it has received the
+ * response to the request.
+ */
+struct BlobRef {
+    /** @brief Offset of the payload from the start of the arena */
+    uint64_t offset = 0;
+    /** @brief Size of the payload in bytes */
+    uint64_t size = 0;
+
+    MSGPACK_FIELDS(offset, size);
+    bool operator==(const BlobRef& other) const = default;
+};
+
 /**
  * @struct CircuitInputNoVK
  * @brief A circuit to be used in either ultrahonk or chonk verification key derivation.
@@ -79,7 +100,12 @@ struct CircuitInput {
      */
     std::vector<uint8_t> verification_key;
 
-    MSGPACK_FIELDS(name, bytecode, verification_key);
+    /**
+     * @brief Location of the bytecode in the blob arena, set instead of `bytecode` to pass the bytecode out-of-band
+     */
+    std::optional<BlobRef> bytecode_blob;
+
+    MSGPACK_FIELDS(name, bytecode, verification_key, bytecode_blob);
     bool operator==(const CircuitInput& other) const = default;
 };
 
@@ -158,8 +184,41 @@ struct BBApiRequest {
     VkPolicy vk_policy = VkPolicy::DEFAULT;
     // Error message - empty string means no error
     std::string error_message;
+    // Shared memory holding the payloads of BlobRef fields - empty if the transport has no blob arena
+    std::span<const uint8_t> blob_arena;
 };
 
+/**
+ * @brief The payload `blob` refers to in the blob arena of `request`, or `inline_bytes` if no blob is given
+ */
+inline std::span<const uint8_t> resolve_bytes(const BBApiRequest& request,
+                                              const std::vector<uint8_t>& inline_bytes,
+                                              const std::optional<BlobRef>& blob)
+{
+    if (!blob.has_value()) {
+        return inline_bytes;
+    }
+    const std::span<const uint8_t> arena = request.blob_arena;
+    if (blob->offset > arena.size() || blob->size > arena.size() - blob->offset) {
+        throw_or_abort("Blob is out of bounds of the blob arena");
+    }
+    return arena.subspan(static_cast<size_t>(blob->offset), static_cast<size_t>(blob->size));
+}
+
+/**
+ * @brief Take `inline_bytes`, or copy the payload `blob` refers to, for consumers that need to own their buffer
+ */
+inline std::vector<uint8_t> take_bytes(const BBApiRequest& request,
+                                       std::vector<uint8_t>& inline_bytes,
+                                       const std::optional<BlobRef>& blob)
+{
+    if (!blob.has_value()) {
+        return std::move(inline_bytes);
+    }
+    const auto bytes = resolve_bytes(request, inline_bytes, blob);
+    return { bytes.begin(), bytes.end() };
+}
+
 /**
  * @brief Error response returned when a command fails
  */
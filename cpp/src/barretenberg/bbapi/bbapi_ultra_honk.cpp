@@ -19,6 +19,7 @@
 #include "barretenberg/flavor/ultra_zk_flavor.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/special_public_inputs/special_public_inputs.hpp"
+#include "barretenberg/ultra_honk/precomputed_polynomial_cache.hpp"
 #include "barretenberg/ultra_honk/prover_instance.hpp"
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 #include "barretenberg/ultra_honk/ultra_verifier.hpp"
@@ -27,7 +28,9 @@
 #include "barretenberg/flavor/ultra_starknet_flavor.hpp"
 #include "barretenberg/flavor/ultra_starknet_zk_flavor.hpp"
 #endif
+#include <cstdlib>
 #include <iomanip>
+#include <optional>
 #include <sstream>
 
 namespace bb::bbapi {
@@ -40,25 +43,45 @@ template <typename Flavor> acir_format::ProgramMetadata _create_program_metadata
 }
 
 template <typename Flavor, typename Circuit = typename Flavor::CircuitBuilder>
-Circuit _compute_circuit(std::vector<uint8_t>&& bytecode, std::vector<uint8_t>&& witness)
+Circuit _compute_circuit(std::vector<uint8_t>&& bytecode, std::span<const uint8_t> witness)
 {
     const acir_format::ProgramMetadata metadata = _create_program_metadata<Flavor>();
     acir_format::AcirProgram program{ acir_format::circuit_buf_to_acir_format(std::move(bytecode)) };
 
     if (!witness.empty()) {
-        program.witness = acir_format::witness_buf_to_witness_vector(std::move(witness));
+        program.witness = acir_format::witness_buf_to_witness_vector(witness);
     }
     return acir_format::create_circuit<Circuit>(program, metadata);
 }
 
+/**
+ * @brief The cache of precomputed polynomials to prove with, if the BB_PRECOMPUTED_CACHE_DIR environment variable
+ * names one. Entries are keyed by VK hash, so the cache is only used when the caller provides the VK.
+ */
+std::optional<PrecomputedPolynomialCache> _precomputed_polynomial_cache()
+{
+    const char* cache_dir = std::getenv("BB_PRECOMPUTED_CACHE_DIR");
+    if (cache_dir == nullptr || *cache_dir == '\0') {
+        return std::nullopt;
+    }
+    return PrecomputedPolynomialCache(cache_dir);
+}
+
 template <typename Flavor>
-std::shared_ptr<ProverInstance_<Flavor>> _compute_prover_instance(std::vector<uint8_t>&& bytecode,
-                                                                  std::vector<uint8_t>&& witness)
+std::shared_ptr<ProverInstance_<Flavor>> _compute_prover_instance(
+    std::vector<uint8_t>&& bytecode,
+    std::span<const uint8_t> witness,
+    const std::shared_ptr<typename Flavor::VerificationKey>& vk = nullptr)
 {
     // Measure function time and debug print
     auto initial_time = std::chrono::high_resolution_clock::now();
-    typename Flavor::CircuitBuilder builder = _compute_circuit<Flavor>(std::move(bytecode), std::move(witness));
-    auto prover_instance = std::make_shared<ProverInstance_<Flavor>>(builder);
+    typename Flavor::CircuitBuilder builder = _compute_circuit<Flavor>(std::move(bytecode), witness);
+    std::shared_ptr<ProverInstance_<Flavor>> prover_instance;
+    if (auto cache = _precomputed_polynomial_cache(); cache && vk) {
+        prover_instance = std::make_shared<ProverInstance_<Flavor>>(builder, *cache, vk->hash());
+    } else {
+        prover_instance = std::make_shared<ProverInstance_<Flavor>>(builder);
+    }
     auto final_time = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(final_time - initial_time);
     info("CircuitProve: Proving key computed in ", duration.count(), " ms");
@@ -66,19 +89,20 @@ std::shared_ptr<ProverInstance_<Flavor>> _compute_prover_instance(std::vector<ui
 }
 template <typename Flavor>
 CircuitProve::Response _prove(std::vector<uint8_t>&& bytecode,
-                              std::vector<uint8_t>&& witness,
+                              std::span<const uint8_t> witness,
                               std::vector<uint8_t>&& vk_bytes)
 {
     using Proof = typename Flavor::Transcript::Proof;
 
-    auto prover_instance = _compute_prover_instance<Flavor>(std::move(bytecode), std::move(witness));
     std::shared_ptr<typename Flavor::VerificationKey> vk;
+    if (!vk_bytes.empty()) {
+        vk =
+            std::make_shared<typename Flavor::VerificationKey>(from_buffer<typename Flavor::VerificationKey>(vk_bytes));
+    }
+    auto prover_instance = _compute_prover_instance<Flavor>(std::move(bytecode), witness, vk);
     if (vk_bytes.empty()) {
         info("WARNING: computing verification key while proving. Pass in a precomputed vk for better performance.");
         vk = std::make_shared<typename Flavor::VerificationKey>(prover_instance->get_precomputed());
-    } else {
-        vk =
-            std::make_shared<typename Flavor::VerificationKey>(from_buffer<typename Flavor::VerificationKey>(vk_bytes));
     }
 
     UltraProver_<Flavor> prover{ prover_instance, vk };
@@ -181,41 +205,42 @@ bool _verify(const bool ipa_accumulation,
     return verified;
 }
 
-CircuitProve::Response CircuitProve::execute(BB_UNUSED const BBApiRequest& request) &&
+CircuitProve::Response CircuitProve::execute(const BBApiRequest& request) &&
 {
     BB_BENCH_NAME(MSGPACK_SCHEMA_NAME);
+    // The witness is decoded in place, while the bytecode deserializer needs a buffer of its own
+    circuit.bytecode = take_bytes(request, circuit.bytecode, circuit.bytecode_blob);
+    const std::span<const uint8_t> witness_bytes = resolve_bytes(request, witness, witness_blob);
     // if the ipa accumulation flag is set we are using the UltraRollupFlavor
     if (settings.ipa_accumulation) {
         return _prove<UltraRollupFlavor>(
-            std::move(circuit.bytecode), std::move(witness), std::move(circuit.verification_key));
+            std::move(circuit.bytecode), witness_bytes, std::move(circuit.verification_key));
     }
     if (settings.oracle_hash_type == "poseidon2" && !settings.disable_zk) {
         // if we are not disabling ZK and the oracle hash type is poseidon2, we are using the UltraZKFlavor
-        return _prove<UltraZKFlavor>(
-            std::move(circuit.bytecode), std::move(witness), std::move(circuit.verification_key));
+        return _prove<UltraZKFlavor>(std::move(circuit.bytecode), witness_bytes, std::move(circuit.verification_key));
     }
     if (settings.oracle_hash_type == "poseidon2" && settings.disable_zk) {
         // if we are disabling ZK and the oracle hash type is poseidon2, we are using the UltraFlavor
-        return _prove<UltraFlavor>(
-            std::move(circuit.bytecode), std::move(witness), std::move(circuit.verification_key));
+        return _prove<UltraFlavor>(std::move(circuit.bytecode), witness_bytes, std::move(circuit.verification_key));
     }
     if (settings.oracle_hash_type == "keccak" && !settings.disable_zk) {
         // if we are not disabling ZK and the oracle hash type is keccak, we are using the UltraKeccakZKFlavor
         return _prove<UltraKeccakZKFlavor>(
-            std::move(circuit.bytecode), std::move(witness), std::move(circuit.verification_key));
+            std::move(circuit.bytecode), witness_bytes, std::move(circuit.verification_key));
     }
     if (settings.oracle_hash_type == "keccak" && settings.disable_zk) {
         return _prove<UltraKeccakFlavor>(
-            std::move(circuit.bytecode), std::move(witness), std::move(circuit.verification_key));
+            std::move(circuit.bytecode), witness_bytes, std::move(circuit.verification_key));
 #ifdef STARKNET_GARAGA_FLAVORS
     }
     if (settings.oracle_hash_type == "starknet" && settings.disable_zk) {
         return _prove<UltraStarknetFlavor>(
-            std::move(circuit.bytecode), std::move(witness), std::move(circuit.verification_key()));
+            std::move(circuit.bytecode), witness_bytes, std::move(circuit.verification_key()));
     }
     if (settings.oracle_hash_type == "starknet" && !settings.disable_zk) {
         return _prove<UltraStarknetZKFlavor>(
-            std::move(circuit.bytecode), std::move(witness), std::move(circuit.verification_key()));
+            std::move(circuit.bytecode), witness_bytes, std::move(circuit.verification_key()));
 #endif
     }
     throw_or_abort("Invalid proving options specified in CircuitProve!");
@@ -290,9 +315,10 @@ CircuitStats::Response _stats(std::vector<uint8_t>&& bytecode, bool include_gate
     return response;
 }
 
-CircuitStats::Response CircuitStats::execute(BB_UNUSED const BBApiRequest& request) &&
+CircuitStats::Response CircuitStats::execute(const BBApiRequest& request) &&
 {
     BB_BENCH_NAME(MSGPACK_SCHEMA_NAME);
+    circuit.bytecode = take_bytes(request, circuit.bytecode, circuit.bytecode_blob);
     // if the ipa accumulation flag is set we are using the UltraRollupFlavor
     if (settings.ipa_accumulation) {
         return _stats<UltraRollupFlavor>(std::move(circuit.bytecode), include_gates_per_opcode);
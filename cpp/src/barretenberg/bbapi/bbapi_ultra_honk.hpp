@@ -65,7 +65,9 @@ struct CircuitProve {
     CircuitInput circuit;
     std::vector<uint8_t> witness;
     ProofSystemSettings settings;
-    MSGPACK_FIELDS(circuit, witness, settings);
+    /** @brief Location of the witness in the blob arena, set instead of `witness` to pass the witness out-of-band */
+    std::optional<BlobRef> witness_blob;
+    MSGPACK_FIELDS(circuit, witness, settings, witness_blob);
     Response execute(const BBApiRequest& request = {}) &&;
     bool operator==(const CircuitProve&) const = default;
 };
@@ -35,6 +35,11 @@ CommandResponse bbapi(Command&& command)
 #endif
 }
 
+void set_blob_arena(std::span<const uint8_t> blob_arena)
+{
+    global_request.blob_arena = blob_arena;
+}
+
 } // namespace bb::bbapi
 
 // Use CBIND macro to export the bbapi function for WASM
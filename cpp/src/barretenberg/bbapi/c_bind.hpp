@@ -1,11 +1,15 @@
 #pragma once
 #include "barretenberg/bbapi/bbapi_execute.hpp"
 #include "barretenberg/serialize/cbind_fwd.hpp"
+#include <span>
 #include <vector>
 
 namespace bb::bbapi {
 // Function declaration for CLI usage
 CommandResponse bbapi(Command&& command);
+
+// Make the blob arena of the IPC transport available to the commands executed by bbapi()
+void set_blob_arena(std::span<const uint8_t> blob_arena);
 } // namespace bb::bbapi
 
 // Forward declaration for CBIND
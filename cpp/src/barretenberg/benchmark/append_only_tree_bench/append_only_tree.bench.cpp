@@ -71,6 +71,44 @@ template <typename TreeType> void append_only_tree_bench(State& state) noexcept
 
     std::filesystem::remove_all(directory);
 }
+
+/**
+ * @brief Appends a block of leaves at a time, committing each block before appending the next
+ * After a commit, the nodes of the tree are no longer in the cache, so this measures how much of the existing tree has
+ * to be read back from LMDB to append to it.
+ */
+template <typename TreeType> void append_only_tree_block_bench(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    const size_t depth = TREE_DEPTH;
+
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+    uint32_t num_threads = 16;
+
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, num_threads);
+    std::unique_ptr<StoreType> store = std::make_unique<StoreType>(name, depth, db);
+    std::shared_ptr<ThreadPool> workers = std::make_shared<ThreadPool>(num_threads);
+    TreeType tree = TreeType(std::move(store), workers);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        // Odd sizes so that appends are split into several sub-tree batches
+        std::vector<fr> values(batch_size + 1);
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = fr(random_engine.get_random_uint256());
+        }
+        state.ResumeTiming();
+        perform_batch_insert(tree, values);
+        state.PauseTiming();
+        commit_tree(tree);
+        state.ResumeTiming();
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
 BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->Unit(benchmark::kMillisecond)
     ->RangeMultiplier(2)
@@ -81,6 +119,11 @@ BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->RangeMultiplier(2)
     ->Range(512, 8192)
     ->Iterations(10);
+BENCHMARK(append_only_tree_block_bench<Poseidon2>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Iterations(100);
 
 } // namespace
 
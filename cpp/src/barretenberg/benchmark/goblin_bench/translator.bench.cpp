@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/translator_vm/translator_circuit_builder.hpp"
+#include "barretenberg/translator_vm/translator_proving_key.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+using Flavor = TranslatorFlavor;
+using Builder = TranslatorCircuitBuilder;
+
+namespace {
+
+Builder generate_trace(size_t num_ops)
+{
+    using G1 = g1::affine_element;
+    std::shared_ptr<ECCOpQueue> op_queue = std::make_shared<ECCOpQueue>();
+
+    auto P1 = G1::random_element();
+    auto P2 = G1::random_element();
+    auto z = fr::random_element();
+
+    op_queue->no_op_ultra_only();
+    for (size_t i = 0; i < Builder::NUM_RANDOM_OPS_START; i++) {
+        op_queue->random_op_ultra_only();
+    }
+    for (size_t i = 0; i < num_ops / 2; i++) {
+        op_queue->add_accumulate(P1);
+        op_queue->mul_accumulate(P2, z);
+    }
+    op_queue->eq_and_reset();
+    for (size_t i = 0; i < Builder::NUM_RANDOM_OPS_END; i++) {
+        op_queue->random_op_ultra_only();
+    }
+    op_queue->merge(MergeSettings::APPEND, ECCOpQueue::OP_QUEUE_SIZE - op_queue->get_current_subtable_size());
+
+    return Builder{ fq::random_element(), fq::random_element(), op_queue };
+}
+
+/**
+ * @brief Construction of the Translator proving key: wire population, interleaving and the sorted range constraint
+ * polynomials
+ */
+void translator_proving_key(State& state) noexcept
+{
+    size_t num_ops = 1 << static_cast<size_t>(state.range(0));
+    Builder builder = generate_trace(num_ops);
+    for (auto _ : state) {
+        TranslatorProvingKey proving_key(builder);
+        DoNotOptimize(proving_key.proving_key);
+    }
+}
+
+BENCHMARK(translator_proving_key)->Unit(kMillisecond)->DenseRange(8, 11);
+} // namespace
+
+BENCHMARK_MAIN();
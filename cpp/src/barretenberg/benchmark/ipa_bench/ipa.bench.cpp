@@ -66,6 +66,21 @@ void ipa_verify(State& state) noexcept
         BB_ASSERT(result);
     }
 }
+// A single fold of the generators, G_vec_new = G_vec_lo + u⁻¹·G_vec_hi, for a round of size 2^range
+void ipa_fold_generators(State& state) noexcept
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t round_size = 1UL << static_cast<size_t>(state.range(0));
+    std::span<const Curve::AffineElement> srs_points = ck.srs->get_monomial_points();
+    std::vector<Curve::AffineElement> G_vec(round_size * 2);
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy_n(srs_points.begin(), round_size * 2, G_vec.begin());
+        const Fr round_challenge_inv = Fr::random_element(&engine);
+        state.ResumeTiming();
+        IPA<Curve>::fold_generators(G_vec, round_size, round_challenge_inv);
+    }
+}
 } // namespace
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
@@ -75,4 +90,8 @@ BENCHMARK(ipa_verify)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
     ->Setup(DoSetup);
+BENCHMARK(ipa_fold_generators)
+    ->Unit(kMicrosecond)
+    ->DenseRange(0, MAX_POLYNOMIAL_DEGREE_LOG2 - 1)
+    ->Setup(DoSetup);
 BENCHMARK_MAIN();
@@ -0,0 +1,129 @@
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/crypto/ecdsa/ecdsa.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include <benchmark/benchmark.h>
+
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace bb;
+using namespace benchmark;
+
+namespace {
+
+/**
+ * @brief Random points and scalars of a secp curve, the points of unknown discrete logarithms relative to each other
+ */
+template <typename Curve> struct MsmInputs {
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    explicit MsmInputs(size_t num_points)
+    {
+        numeric::RNG& engine = numeric::get_debug_randomness();
+        std::vector<Element> elements(num_points);
+        scalars.resize(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            elements[i] = Curve::Group::one * Fr::random_element(&engine);
+            scalars[i] = Fr::random_element(&engine);
+        }
+        Element::batch_normalize(elements.data(), num_points);
+        for (const Element& element : elements) {
+            points.emplace_back(element.x, element.y);
+        }
+    }
+
+    std::vector<AffineElement> points;
+    std::vector<Fr> scalars;
+};
+
+template <typename Curve> void msm(State& state) noexcept
+{
+    using Fr = typename Curve::ScalarField;
+    MsmInputs<Curve> inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(
+            scalar_multiplication::MSM<Curve>::msm(inputs.points, PolynomialSpan<const Fr>(0, inputs.scalars)));
+    }
+}
+
+/**
+ * @brief The MSM computed as a sum of independent scalar multiplications, as secp curves did without a Pippenger path
+ */
+template <typename Curve> void sum_of_muls(State& state) noexcept
+{
+    using Element = typename Curve::Element;
+    MsmInputs<Curve> inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        Element result = Curve::Group::point_at_infinity;
+        for (size_t i = 0; i < inputs.points.size(); ++i) {
+            result += inputs.points[i] * inputs.scalars[i];
+        }
+        DoNotOptimize(result);
+    }
+}
+
+/**
+ * @brief Signatures of distinct messages by distinct accounts
+ */
+template <typename Fq, typename Fr, typename G1> struct EcdsaInputs {
+    explicit EcdsaInputs(size_t num_signatures)
+    {
+        for (size_t i = 0; i < num_signatures; ++i) {
+            crypto::ecdsa_key_pair<Fr, G1> account;
+            account.private_key = Fr::random_element();
+            account.public_key = G1::one * account.private_key;
+            messages.emplace_back("message " + std::to_string(i));
+            public_keys.emplace_back(account.public_key);
+            signatures.emplace_back(
+                crypto::ecdsa_construct_signature<crypto::Sha256Hasher, Fq, Fr, G1>(messages.back(), account));
+        }
+    }
+
+    std::vector<std::string> messages;
+    std::vector<typename G1::affine_element> public_keys;
+    std::vector<crypto::ecdsa_signature> signatures;
+};
+
+template <typename Fq, typename Fr, typename G1> void ecdsa_verify_each(State& state) noexcept
+{
+    EcdsaInputs<Fq, Fr, G1> inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<uint8_t> verified(inputs.signatures.size());
+        parallel_for_heuristic(
+            inputs.signatures.size(),
+            [&](size_t i) {
+                verified[i] = static_cast<uint8_t>(crypto::ecdsa_verify_signature<crypto::Sha256Hasher, Fq, Fr, G1>(
+                    inputs.messages[i], inputs.public_keys[i], inputs.signatures[i]));
+            },
+            thread_heuristics::SM_COST);
+        DoNotOptimize(verified);
+    }
+}
+
+template <typename Fq, typename Fr, typename G1> void ecdsa_verify_batch(State& state) noexcept
+{
+    EcdsaInputs<Fq, Fr, G1> inputs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(crypto::ecdsa_verify_signatures<crypto::Sha256Hasher, Fq, Fr, G1>(
+            inputs.messages, inputs.public_keys, inputs.signatures));
+    }
+}
+
+} // namespace
+
+BENCHMARK(msm<curve::SECP256K1>)->Unit(kMillisecond)->RangeMultiplier(4)->Range(1 << 8, 1 << 16);
+BENCHMARK(msm<curve::SECP256R1>)->Unit(kMillisecond)->RangeMultiplier(4)->Range(1 << 8, 1 << 16);
+BENCHMARK(sum_of_muls<curve::SECP256K1>)->Unit(kMillisecond)->RangeMultiplier(4)->Range(1 << 8, 1 << 12);
+BENCHMARK(ecdsa_verify_each<secp256k1::fq, secp256k1::fr, secp256k1::g1>)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 12);
+BENCHMARK(ecdsa_verify_batch<secp256k1::fq, secp256k1::fr, secp256k1::g1>)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 12);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,122 @@
+#include "barretenberg/benchmark/ultra_bench/mock_circuits.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_circuit_builder.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <span>
+#include <vector>
+
+using namespace bb;
+using namespace benchmark;
+
+using Curve = curve::BN254;
+using Fr = Curve::ScalarField;
+using G1 = Curve::AffineElement;
+
+namespace {
+
+/**
+ * @brief The witness polynomials committed to in the first rounds of an Ultra or Mega proof, i.e. the wires and the
+ * lookup read counts and tags, of a circuit built by test_circuit_function
+ */
+template <typename Flavor> class WitnessPolynomials {
+  public:
+    using Builder = typename Flavor::CircuitBuilder;
+
+    WitnessPolynomials(void (*test_circuit_function)(Builder&, size_t), size_t num_iterations)
+    {
+        srs::init_file_crs_factory(srs::bb_crs_path());
+        Builder builder;
+        test_circuit_function(builder, num_iterations);
+        instance = std::make_shared<ProverInstance_<Flavor>>(builder);
+        crs = srs::get_crs_factory<Curve>()->get_crs(instance->dyadic_size());
+
+        auto& polynomials = instance->polynomials;
+        for (auto& wire : polynomials.get_wires()) {
+            add(wire);
+        }
+        add(polynomials.lookup_read_counts);
+        add(polynomials.lookup_read_tags);
+    }
+
+    void add(Polynomial<Fr>& polynomial)
+    {
+        points.emplace_back(crs->get_monomial_points().subspan(polynomial.start_index()));
+        scalars.emplace_back(polynomial.coeffs());
+    }
+
+    std::shared_ptr<ProverInstance_<Flavor>> instance;
+    std::shared_ptr<srs::factories::Crs<Curve>> crs;
+    std::vector<std::span<const G1>> points;
+    std::vector<std::span<Fr>> scalars;
+};
+
+/**
+ * @brief Commit to the witness polynomials of a circuit the way CommitmentKey::batch_commit does, with and without
+ * bucketing the scalars by bit length
+ */
+template <typename Flavor, bool bucket_by_bit_length>
+void commit_to_witness(State& state,
+                       void (*test_circuit_function)(typename Flavor::CircuitBuilder&, size_t),
+                       size_t num_iterations) noexcept
+{
+    WitnessPolynomials<Flavor> witness(test_circuit_function, num_iterations);
+    for (auto _ : state) {
+        auto commitments = scalar_multiplication::MSM<Curve>::batch_multi_scalar_mul(
+            witness.points, witness.scalars, /*handle_edge_cases=*/false, bucket_by_bit_length);
+        DoNotOptimize(commitments);
+    }
+}
+
+void ultra_sha256(State& state) noexcept
+{
+    commit_to_witness<UltraFlavor, false>(state, &generate_sha256_test_circuit<UltraCircuitBuilder>, 10);
+}
+void ultra_sha256_by_bit_length(State& state) noexcept
+{
+    commit_to_witness<UltraFlavor, true>(state, &generate_sha256_test_circuit<UltraCircuitBuilder>, 10);
+}
+void ultra_ecdsa(State& state) noexcept
+{
+    commit_to_witness<UltraFlavor, false>(
+        state, &stdlib::generate_ecdsa_verification_test_circuit<UltraCircuitBuilder>, 10);
+}
+void ultra_ecdsa_by_bit_length(State& state) noexcept
+{
+    commit_to_witness<UltraFlavor, true>(
+        state, &stdlib::generate_ecdsa_verification_test_circuit<UltraCircuitBuilder>, 10);
+}
+void mega_sha256(State& state) noexcept
+{
+    commit_to_witness<MegaFlavor, false>(state, &generate_sha256_test_circuit<MegaCircuitBuilder>, 10);
+}
+void mega_sha256_by_bit_length(State& state) noexcept
+{
+    commit_to_witness<MegaFlavor, true>(state, &generate_sha256_test_circuit<MegaCircuitBuilder>, 10);
+}
+void mega_ecdsa(State& state) noexcept
+{
+    commit_to_witness<MegaFlavor, false>(
+        state, &stdlib::generate_ecdsa_verification_test_circuit<MegaCircuitBuilder>, 10);
+}
+void mega_ecdsa_by_bit_length(State& state) noexcept
+{
+    commit_to_witness<MegaFlavor, true>(
+        state, &stdlib::generate_ecdsa_verification_test_circuit<MegaCircuitBuilder>, 10);
+}
+
+} // namespace
+
+BENCHMARK(ultra_sha256)->Unit(kMillisecond);
+BENCHMARK(ultra_sha256_by_bit_length)->Unit(kMillisecond);
+BENCHMARK(ultra_ecdsa)->Unit(kMillisecond);
+BENCHMARK(ultra_ecdsa_by_bit_length)->Unit(kMillisecond);
+BENCHMARK(mega_sha256)->Unit(kMillisecond);
+BENCHMARK(mega_sha256_by_bit_length)->Unit(kMillisecond);
+BENCHMARK(mega_ecdsa)->Unit(kMillisecond);
+BENCHMARK(mega_ecdsa_by_bit_length)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,98 @@
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/vm2/common/aztec_constants.hpp"
+#include "barretenberg/world_state/types.hpp"
+#include "barretenberg/world_state/world_state.hpp"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb::crypto::merkle_tree;
+using namespace bb::world_state;
+
+namespace {
+
+const uint64_t MAP_SIZE = 1024 * 1024;
+const uint64_t NUM_THREADS = 8;
+
+const std::unordered_map<MerkleTreeId, uint32_t> TREE_HEIGHTS{
+    { MerkleTreeId::NULLIFIER_TREE, NULLIFIER_TREE_HEIGHT },
+    { MerkleTreeId::NOTE_HASH_TREE, NOTE_HASH_TREE_HEIGHT },
+    { MerkleTreeId::PUBLIC_DATA_TREE, PUBLIC_DATA_TREE_HEIGHT },
+    { MerkleTreeId::L1_TO_L2_MESSAGE_TREE, L1_TO_L2_MSG_TREE_HEIGHT },
+    { MerkleTreeId::ARCHIVE, ARCHIVE_HEIGHT },
+};
+const std::unordered_map<MerkleTreeId, index_t> TREE_PREFILL{
+    { MerkleTreeId::NULLIFIER_TREE, 128 },
+    { MerkleTreeId::PUBLIC_DATA_TREE, 128 },
+};
+const uint32_t INITIAL_HEADER_GENERATOR_POINT = 28;
+
+fr random_fr()
+{
+    return fr(random_engine.get_random_uint256());
+}
+
+/**
+ * @brief Fills every tree with a block of the given number of leaves
+ */
+void append_block(WorldState& ws, size_t num_leaves)
+{
+    std::vector<fr> note_hashes(num_leaves);
+    std::vector<fr> messages(num_leaves);
+    std::vector<NullifierLeafValue> nullifiers(num_leaves);
+    std::vector<PublicDataLeafValue> public_writes(num_leaves);
+    for (size_t i = 0; i < num_leaves; ++i) {
+        note_hashes[i] = random_fr();
+        messages[i] = random_fr();
+        nullifiers[i] = NullifierLeafValue(random_fr());
+        public_writes[i] = PublicDataLeafValue(random_fr(), random_fr());
+    }
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, note_hashes);
+    ws.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, messages);
+    ws.append_leaves<fr>(MerkleTreeId::ARCHIVE, { random_fr() });
+    ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, nullifiers, 0);
+    ws.batch_insert_indexed_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, public_writes, 0);
+}
+
+/**
+ * @brief Latency of committing a block to all five trees, with and without group commit
+ */
+template <bool group_commit> void world_state_commit_bench(State& state) noexcept
+{
+    const size_t num_leaves = size_t(state.range(0));
+    std::string directory = random_temp_directory();
+    std::filesystem::create_directories(directory);
+    {
+        WorldState ws(NUM_THREADS, directory, MAP_SIZE, TREE_HEIGHTS, TREE_PREFILL, INITIAL_HEADER_GENERATOR_POINT);
+        ws.set_group_commit(group_commit);
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            append_block(ws, num_leaves);
+            WorldStateStatusFull status;
+            state.ResumeTiming();
+            auto result = ws.commit(status);
+            DoNotOptimize(result);
+        }
+    }
+    std::filesystem::remove_all(directory);
+}
+
+} // namespace
+
+BENCHMARK(world_state_commit_bench<false>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(4, 1024)
+    ->Iterations(50);
+
+BENCHMARK(world_state_commit_bench<true>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(4, 1024)
+    ->Iterations(50);
+
+BENCHMARK_MAIN();
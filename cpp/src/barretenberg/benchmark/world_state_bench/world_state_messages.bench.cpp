@@ -0,0 +1,177 @@
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/messaging/dispatcher.hpp"
+#include "barretenberg/messaging/header.hpp"
+#include "barretenberg/nodejs_module/world_state/world_state_message.hpp"
+#include "barretenberg/vm2/common/aztec_constants.hpp"
+#include "barretenberg/world_state/types.hpp"
+#include "barretenberg/world_state/world_state.hpp"
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb::crypto::merkle_tree;
+using namespace bb::messaging;
+using namespace bb::nodejs;
+using namespace bb::world_state;
+
+namespace {
+
+const uint64_t MAP_SIZE = 1024 * 1024;
+const uint64_t NUM_THREADS = 8;
+const size_t NUM_LEAVES = 1024;
+const size_t NUM_MESSAGES = 4096;
+
+const std::unordered_map<MerkleTreeId, uint32_t> TREE_HEIGHTS{
+    { MerkleTreeId::NULLIFIER_TREE, NULLIFIER_TREE_HEIGHT },
+    { MerkleTreeId::NOTE_HASH_TREE, NOTE_HASH_TREE_HEIGHT },
+    { MerkleTreeId::PUBLIC_DATA_TREE, PUBLIC_DATA_TREE_HEIGHT },
+    { MerkleTreeId::L1_TO_L2_MESSAGE_TREE, L1_TO_L2_MSG_TREE_HEIGHT },
+    { MerkleTreeId::ARCHIVE, ARCHIVE_HEIGHT },
+};
+const std::unordered_map<MerkleTreeId, index_t> TREE_PREFILL{
+    { MerkleTreeId::NULLIFIER_TREE, 128 },
+    { MerkleTreeId::PUBLIC_DATA_TREE, 128 },
+};
+const uint32_t INITIAL_HEADER_GENERATOR_POINT = 28;
+
+/**
+ * @brief A world state with a committed block of note hashes and a dispatcher serving GET_LEAF_VALUE messages for it,
+ * the way the nodejs module does
+ */
+class MessageFixture {
+  public:
+    MessageFixture()
+        : directory(random_temp_directory())
+    {
+        std::filesystem::create_directories(directory);
+        ws = std::make_unique<WorldState>(
+            NUM_THREADS, directory, MAP_SIZE, TREE_HEIGHTS, TREE_PREFILL, INITIAL_HEADER_GENERATOR_POINT);
+        std::vector<fr> note_hashes(NUM_LEAVES);
+        for (auto& note_hash : note_hashes) {
+            note_hash = fr(random_engine.get_random_uint256());
+        }
+        ws->append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, note_hashes);
+        WorldStateStatusFull status;
+        ws->commit(status);
+
+        dispatcher.register_target(WorldStateMessageType::GET_LEAF_VALUE,
+                                   [this](msgpack::object& obj, msgpack::sbuffer& buffer) {
+                                       TypedMessage<GetLeafValueRequest> request;
+                                       obj.convert(request);
+                                       auto leaf = ws->get_leaf<fr>(
+                                           request.value.revision, request.value.treeId, request.value.leafIndex);
+                                       MsgHeader header(request.header.messageId);
+                                       TypedMessage<std::optional<fr>> resp_msg(
+                                           WorldStateMessageType::GET_LEAF_VALUE, header, leaf);
+                                       msgpack::pack(buffer, resp_msg);
+                                       return true;
+                                   });
+
+        for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+            msgpack::sbuffer request;
+            MsgHeader header(static_cast<uint32_t>(i), 0);
+            TypedMessage<GetLeafValueRequest> msg(
+                WorldStateMessageType::GET_LEAF_VALUE,
+                header,
+                { MerkleTreeId::NOTE_HASH_TREE, WorldStateRevision::committed(), i % NUM_LEAVES });
+            msgpack::pack(request, msg);
+            requests.emplace_back(request.data(), request.data() + request.size());
+        }
+    }
+    MessageFixture(const MessageFixture&) = delete;
+    MessageFixture& operator=(const MessageFixture&) = delete;
+    MessageFixture(MessageFixture&&) = delete;
+    MessageFixture& operator=(MessageFixture&&) = delete;
+    ~MessageFixture()
+    {
+        ws.reset();
+        std::filesystem::remove_all(directory);
+    }
+
+    // What the nodejs module did before: copy the request in, unpack, copy the response out
+    std::vector<char> handle_with_copies(const std::vector<char>& request) const
+    {
+        std::vector<char> data(request);
+        msgpack::object_handle obj_handle = msgpack::unpack(data.data(), data.size());
+        msgpack::object obj = obj_handle.get();
+        msgpack::sbuffer buffer;
+        dispatcher.on_new_data(obj, buffer);
+        return { buffer.data(), buffer.data() + buffer.size() };
+    }
+
+    // What it does now: unpack the borrowed request in place, hand the response memory over
+    char* handle_in_place(const std::vector<char>& request) const
+    {
+        msgpack::sbuffer buffer;
+        dispatcher.on_new_data(std::span<const char>(request), buffer);
+        return buffer.release();
+    }
+
+    std::string directory;
+    std::unique_ptr<WorldState> ws;
+    MessageDispatcher dispatcher;
+    std::vector<std::vector<char>> requests;
+};
+
+/**
+ * @brief Latency of handling one message on the calling thread, with and without the marshalling copies
+ */
+template <bool in_place> void world_state_message_bench(State& state) noexcept
+{
+    MessageFixture fixture;
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& request = fixture.requests[i++ % NUM_MESSAGES];
+        if constexpr (in_place) {
+            char* response = fixture.handle_in_place(request);
+            DoNotOptimize(response);
+            free(response);
+        } else {
+            auto response = fixture.handle_with_copies(request);
+            DoNotOptimize(response);
+        }
+    }
+}
+
+/**
+ * @brief Throughput of handling a burst of messages on a pool of the given number of worker threads
+ * 4 threads is the size of the libuv thread pool the messages used to be executed on.
+ */
+void world_state_message_throughput_bench(State& state) noexcept
+{
+    MessageFixture fixture;
+    bb::ThreadPool workers(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        std::atomic<size_t> num_handled = 0;
+        for (const auto& request : fixture.requests) {
+            workers.enqueue([&fixture, &request, &num_handled]() {
+                free(fixture.handle_in_place(request));
+                num_handled++;
+            });
+        }
+        workers.wait();
+        DoNotOptimize(num_handled.load());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUM_MESSAGES));
+}
+
+} // namespace
+
+BENCHMARK(world_state_message_bench<false>)->Unit(benchmark::kMicrosecond)->Iterations(NUM_MESSAGES);
+BENCHMARK(world_state_message_bench<true>)->Unit(benchmark::kMicrosecond)->Iterations(NUM_MESSAGES);
+BENCHMARK(world_state_message_throughput_bench)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Iterations(10);
+
+BENCHMARK_MAIN();
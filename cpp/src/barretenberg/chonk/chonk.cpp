@@ -373,7 +373,10 @@ void Chonk::accumulate(ClientCircuit& circuit, const std::shared_ptr<MegaVerific
     // If the current circuit exceeds the current size of the commitment key, reinitialize accordingly.
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1319)
     if (prover_instance->dyadic_size() > bn254_commitment_key.dyadic_size) {
+        // Commitments don't depend on the SRS size, so memoised ones carry over to the larger key
+        auto commitment_cache = bn254_commitment_key.cache;
         bn254_commitment_key = CommitmentKey<curve::BN254>(prover_instance->dyadic_size());
+        bn254_commitment_key.cache = commitment_cache;
         goblin.commitment_key = bn254_commitment_key;
     }
     prover_instance->commitment_key = bn254_commitment_key;
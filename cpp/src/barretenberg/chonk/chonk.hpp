@@ -283,6 +283,16 @@ class Chonk : public IVCBase {
 
     size_t get_num_circuits() const { return num_circuits; }
 
+    /**
+     * @brief Memoise the BN254 commitments of the IVC, so that polynomials recurring across circuits (e.g. those of a
+     * repeated app) are committed to once
+     */
+    void enable_commitment_cache(size_t max_num_entries)
+    {
+        bn254_commitment_key.enable_cache(max_num_entries);
+        goblin.commitment_key.cache = bn254_commitment_key.cache;
+    }
+
     // IVCBase interface
     Goblin& get_goblin() override { return goblin; }
     const Goblin& get_goblin() const override { return goblin; }
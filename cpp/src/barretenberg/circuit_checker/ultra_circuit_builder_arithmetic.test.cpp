@@ -466,6 +466,71 @@ TEST_F(UltraCircuitBuilderArithmetic, BigMulAddGateWithNextRowW4Failure)
     EXPECT_FALSE(CircuitChecker::check(builder));
 }
 
+// Verifies that the batched create_big_mul_add_gates lays out exactly the rows create_big_mul_add_gate would
+TEST_F(UltraCircuitBuilderArithmetic, BatchedBigMulAddGatesMatchSequential)
+{
+    constexpr size_t num_gates = 64;
+    auto populate = [](UltraCircuitBuilder& builder) {
+        std::vector<mul_quad_<fr>> gates;
+        std::vector<uint8_t> use_next_gate_w_4;
+        for (size_t i = 0; i < num_gates; ++i) {
+            auto data = create_mul_quad_data(i + 1, i + 2, i + 3);
+            uint32_t a_idx = builder.add_variable(data.a);
+            uint32_t b_idx = builder.add_variable(data.b);
+            uint32_t c_idx = builder.add_variable(data.c);
+            uint32_t d_idx = builder.add_variable(data.d);
+            // Every fourth gate chains into the next row's w_4, which holds the previous gate's d (= -next_w_4)
+            const bool chained = (i % 4 == 0) && (i + 1 < num_gates);
+            gates.push_back({ a_idx,
+                              b_idx,
+                              c_idx,
+                              d_idx,
+                              data.mul_scaling,
+                              data.a_scaling,
+                              data.b_scaling,
+                              data.c_scaling,
+                              data.d_scaling,
+                              data.const_scaling });
+            use_next_gate_w_4.push_back(static_cast<uint8_t>(chained));
+        }
+        return std::make_pair(gates, use_next_gate_w_4);
+    };
+
+    UltraCircuitBuilder sequential;
+    UltraCircuitBuilder batched;
+    auto [sequential_gates, sequential_flags] = populate(sequential);
+    auto [batched_gates, batched_flags] = populate(batched);
+    for (size_t i = 0; i < num_gates; ++i) {
+        sequential.create_big_mul_add_gate(sequential_gates[i], sequential_flags[i] != 0);
+    }
+    batched.create_big_mul_add_gates(batched_gates, batched_flags);
+
+    EXPECT_EQ(batched.num_gates(), sequential.num_gates());
+    auto& expected = sequential.blocks.arithmetic;
+    auto& actual = batched.blocks.arithmetic;
+    ASSERT_EQ(actual.size(), expected.size());
+    EXPECT_EQ(actual.wires, expected.wires);
+    auto expected_selectors = expected.get_selectors();
+    auto actual_selectors = actual.get_selectors();
+    ASSERT_EQ(actual_selectors.size(), expected_selectors.size());
+    for (size_t s = 0; s < expected_selectors.size(); ++s) {
+        ASSERT_EQ(actual_selectors[s].size(), expected_selectors[s].size());
+        for (size_t row = 0; row < expected.size(); ++row) {
+            EXPECT_EQ(actual_selectors[s][row], expected_selectors[s][row]);
+        }
+    }
+}
+
+// Verifies that an empty batch adds no gates
+TEST_F(UltraCircuitBuilderArithmetic, BatchedBigMulAddGatesEmpty)
+{
+    UltraCircuitBuilder builder;
+    const size_t num_gates_before = builder.num_gates();
+    builder.create_big_mul_add_gates({}, {});
+    EXPECT_EQ(builder.num_gates(), num_gates_before);
+    EXPECT_TRUE(CircuitChecker::check(builder));
+}
+
 // Verifies that create_bool_gate works for boolean values (0 and 1)
 TEST_F(UltraCircuitBuilderArithmetic, BoolGate)
 {
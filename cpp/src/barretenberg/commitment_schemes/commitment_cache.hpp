@@ -0,0 +1,155 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "barretenberg/common/bb_bench.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/crypto/blake2s/blake2s.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace bb {
+
+/**
+ * @brief Bounded memo of commitments to polynomials that have been committed to before
+ *
+ * @details Many polynomials committed to in an IVC run recur: the precomputed and databus columns of repeated app
+ * circuits, calldata matching an earlier return data, op queue columns. The cache maps (content hash, start index,
+ * size) to the commitment so that the MSM of a recurring polynomial is only computed once. The content is hashed with
+ * BLAKE2s, in parallel chunks whose digests are hashed together, so a hit can only come from identical coefficients.
+ * The coefficients are hashed in reduced form: the MSM leaves the polynomial it commits to with its values reduced,
+ * which must not turn the next lookup into a miss. The least recently used entry is evicted once the cache is full.
+ */
+template <class Curve> class CommitmentCache {
+    using Fr = typename Curve::ScalarField;
+    using Commitment = typename Curve::AffineElement;
+
+  public:
+    struct Key {
+        std::array<uint8_t, crypto::BLAKE2S_OUTBYTES> hash{};
+        size_t start_index = 0;
+        size_t size = 0;
+
+        bool operator==(const Key&) const = default;
+    };
+
+    explicit CommitmentCache(size_t max_num_entries)
+        : max_num_entries(max_num_entries)
+    {}
+
+    static Key get_key(PolynomialSpan<const Fr> polynomial)
+    {
+        BB_BENCH_NAME("CommitmentCache::get_key");
+        constexpr size_t CHUNK_SIZE = 1 << 12;
+        constexpr size_t BLOCK_SIZE = 64;
+        const size_t num_chunks = (polynomial.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        std::vector<std::array<uint8_t, crypto::BLAKE2S_OUTBYTES>> chunk_hashes(num_chunks);
+        parallel_for_heuristic(
+            num_chunks,
+            [&](size_t chunk) {
+                const size_t start = chunk * CHUNK_SIZE;
+                const size_t end = std::min(start + CHUNK_SIZE, polynomial.size());
+                crypto::blake2s_state state;
+                crypto::blake2s_init(&state, crypto::BLAKE2S_OUTBYTES);
+                std::array<Fr, BLOCK_SIZE> block;
+                for (size_t i = start; i < end; i += BLOCK_SIZE) {
+                    const size_t block_size = std::min(BLOCK_SIZE, end - i);
+                    for (size_t j = 0; j < block_size; ++j) {
+                        block[j] = polynomial.span[i + j].reduce_once();
+                    }
+                    crypto::blake2s_update(&state, block.data(), block_size * sizeof(Fr));
+                }
+                crypto::blake2s_final(&state, chunk_hashes[chunk].data(), crypto::BLAKE2S_OUTBYTES);
+            },
+            thread_heuristics::ALWAYS_MULTITHREAD);
+
+        Key key{ .start_index = polynomial.start_index, .size = polynomial.size() };
+        crypto::blake2s_state state;
+        crypto::blake2s_init(&state, crypto::BLAKE2S_OUTBYTES);
+        crypto::blake2s_update(&state, chunk_hashes.data(), chunk_hashes.size() * crypto::BLAKE2S_OUTBYTES);
+        crypto::blake2s_final(&state, key.hash.data(), crypto::BLAKE2S_OUTBYTES);
+        return key;
+    }
+
+    std::optional<Commitment> find(const Key& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it == entries.end()) {
+            BB_BENCH_NAME("CommitmentCache::miss");
+            num_misses++;
+            return std::nullopt;
+        }
+        BB_BENCH_NAME("CommitmentCache::hit");
+        num_hits++;
+        // Mark the entry as the most recently used one
+        recency.splice(recency.begin(), recency, it->second.recency_position);
+        return it->second.commitment;
+    }
+
+    void insert(const Key& key, const Commitment& commitment)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (max_num_entries == 0 || entries.contains(key)) {
+            return;
+        }
+        if (entries.size() == max_num_entries) {
+            entries.erase(recency.back());
+            recency.pop_back();
+        }
+        recency.push_front(key);
+        entries.emplace(key, Entry{ commitment, recency.begin() });
+    }
+
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+    size_t hits() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return num_hits;
+    }
+    size_t misses() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return num_misses;
+    }
+
+  private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const
+        {
+            // The content hash is uniformly distributed, so any bytes of it make a good bucket index
+            size_t result = 0;
+            std::memcpy(&result, key.hash.data(), sizeof(result));
+            return result ^ key.start_index;
+        }
+    };
+    struct Entry {
+        Commitment commitment;
+        typename std::list<Key>::iterator recency_position;
+    };
+
+    size_t max_num_entries;
+    size_t num_hits = 0;
+    size_t num_misses = 0;
+    // Keys from the most to the least recently used
+    std::list<Key> recency;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    mutable std::mutex mutex;
+};
+
+} // namespace bb
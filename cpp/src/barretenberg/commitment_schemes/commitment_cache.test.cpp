@@ -0,0 +1,103 @@
+#include "commitment_cache.hpp"
+#include "commitment_key.test.hpp"
+
+#include <gtest/gtest.h>
+
+namespace bb {
+
+class CommitmentCacheTest : public ::testing::Test {
+  public:
+    using Curve = curve::BN254;
+    using Fr = Curve::ScalarField;
+    using Commitment = Curve::AffineElement;
+    using CK = CommitmentKey<Curve>;
+
+    static constexpr size_t n = 1024;
+
+    static void SetUpTestSuite() { bb::srs::init_file_crs_factory(bb::srs::bb_crs_path()); }
+};
+
+TEST_F(CommitmentCacheTest, CommitHitsOnRepeatedContent)
+{
+    CK ck = create_commitment_key<CK>(n);
+    CK cached_ck = ck;
+    cached_ck.enable_cache(8);
+
+    Polynomial<Fr> poly = Polynomial<Fr>::random(n / 2, /*start_index=*/1);
+    const Commitment expected = ck.commit(poly);
+
+    EXPECT_EQ(cached_ck.commit(poly), expected);
+    EXPECT_EQ(cached_ck.cache->misses(), 1UL);
+
+    // A copy of the polynomial hits, and so does a copy of the key, which shares the cache
+    Polynomial<Fr> poly_copy(poly);
+    CK cached_ck_copy = cached_ck;
+    EXPECT_EQ(cached_ck.commit(poly_copy), expected);
+    EXPECT_EQ(cached_ck_copy.commit(poly), expected);
+    EXPECT_EQ(cached_ck.cache->hits(), 2UL);
+
+    // The same coefficients at another offset, or a change of a single coefficient, miss
+    Polynomial<Fr> shifted(poly.size(), poly.virtual_size() + 1, /*start_index=*/2);
+    for (size_t i = 0; i < poly.size(); ++i) {
+        shifted.at(i + 2) = poly.at(i + 1);
+    }
+    EXPECT_EQ(cached_ck.commit(shifted), ck.commit(shifted));
+    Polynomial<Fr> modified(poly);
+    modified.at(n / 4) += Fr(1);
+    EXPECT_EQ(cached_ck.commit(modified), ck.commit(modified));
+    EXPECT_EQ(cached_ck.cache->hits(), 2UL);
+    EXPECT_EQ(cached_ck.cache->misses(), 3UL);
+}
+
+TEST_F(CommitmentCacheTest, BatchCommitMixesCachedAndFreshCommitments)
+{
+    CK ck = create_commitment_key<CK>(n);
+    CK cached_ck = ck;
+    cached_ck.enable_cache(16);
+
+    std::vector<Polynomial<Fr>> polys;
+    for (size_t i = 0; i < 6; ++i) {
+        polys.emplace_back(Polynomial<Fr>::random(n >> i, /*start_index=*/i));
+    }
+    // Warm the cache with every other polynomial
+    for (size_t i = 0; i < polys.size(); i += 2) {
+        cached_ck.commit(polys[i]);
+    }
+
+    RefVector<Polynomial<Fr>> refs;
+    for (auto& poly : polys) {
+        refs.push_back(poly);
+    }
+    const std::vector<Commitment> expected = ck.batch_commit(refs);
+    EXPECT_EQ(cached_ck.batch_commit(refs, /*max_batch_size=*/2), expected);
+    EXPECT_EQ(cached_ck.cache->hits(), 3UL);
+
+    // Everything is cached now
+    EXPECT_EQ(cached_ck.batch_commit(refs), expected);
+    EXPECT_EQ(cached_ck.cache->hits(), 9UL);
+    EXPECT_EQ(cached_ck.cache->misses(), 6UL);
+}
+
+TEST_F(CommitmentCacheTest, EvictsLeastRecentlyUsed)
+{
+    CK ck = create_commitment_key<CK>(n);
+    ck.enable_cache(2);
+
+    Polynomial<Fr> a = Polynomial<Fr>::random(n);
+    Polynomial<Fr> b = Polynomial<Fr>::random(n);
+    Polynomial<Fr> c = Polynomial<Fr>::random(n);
+    ck.commit(a);
+    ck.commit(b);
+    ck.commit(a); // hit, b is now the least recently used
+    ck.commit(c); // evicts b
+    EXPECT_EQ(ck.cache->size(), 2UL);
+    EXPECT_EQ(ck.cache->hits(), 1UL);
+
+    ck.commit(a);
+    EXPECT_EQ(ck.cache->hits(), 2UL);
+    ck.commit(b);
+    EXPECT_EQ(ck.cache->hits(), 2UL);
+    EXPECT_EQ(ck.cache->misses(), 4UL);
+}
+
+} // namespace bb
@@ -13,6 +13,7 @@
  * simplify the codebase.
  */
 
+#include "barretenberg/commitment_schemes/commitment_cache.hpp"
 #include "barretenberg/common/bb_bench.hpp"
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/constants.hpp"
@@ -29,6 +30,8 @@
 #include <cstdlib>
 #include <limits>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <string_view>
 
 namespace bb {
@@ -58,6 +61,8 @@ template <class Curve> class CommitmentKey {
   public:
     std::shared_ptr<srs::factories::Crs<Curve>> srs;
     size_t dyadic_size;
+    // Memo of earlier commitments, shared by the copies of this key; null unless enabled with enable_cache
+    std::shared_ptr<CommitmentCache<Curve>> cache;
 
     CommitmentKey() = default;
 
@@ -79,8 +84,17 @@ template <class Curve> class CommitmentKey {
      */
     bool initialized() const { return srs != nullptr; }
 
+    /**
+     * @brief Memoise the commitments computed with this key and its copies, keeping at most max_num_entries of them
+     * @details Worth it when the same polynomials are committed to repeatedly, e.g. across the circuits of an IVC
+     * stack; otherwise the content hashing is pure overhead.
+     */
+    void enable_cache(size_t max_num_entries) { cache = std::make_shared<CommitmentCache<Curve>>(max_num_entries); }
+
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
+     * @details Witness polynomials are mostly made of small values, so the MSM buckets the scalars by bit length and
+     * only runs the Pippenger rounds the small ones need.
      *
      * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
      * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
@@ -100,13 +114,24 @@ template <class Curve> class CommitmentKey {
                                   srs->get_monomial_size()));
         }
 
-        G1 r = scalar_multiplication::pippenger_unsafe<Curve>(polynomial, point_table);
-        Commitment point(r);
-        return point;
+        std::optional<typename CommitmentCache<Curve>::Key> cache_key;
+        if (cache) {
+            cache_key = CommitmentCache<Curve>::get_key(polynomial);
+            if (std::optional<Commitment> commitment = cache->find(*cache_key)) {
+                return *commitment;
+            }
+        }
+        Commitment commitment = scalar_multiplication::MSM<Curve>::msm(
+            point_table, polynomial, /*handle_edge_cases=*/false, /*bucket_by_bit_length=*/true);
+        if (cache) {
+            cache->insert(*cache_key, commitment);
+        }
+        return commitment;
     };
     /**
      * @brief Batch commitment to multiple polynomials
-     * @details Uses batch_multi_scalar_mul for more efficient processing when committing to multiple polynomials
+     * @details Uses batch_multi_scalar_mul for more efficient processing when committing to multiple polynomials, with
+     * the scalars bucketed by bit length as in commit
      *
      * @param polynomials vector of polynomial spans to commit to
      * @return std::vector<Commitment> vector of commitments, one for each polynomial
@@ -116,21 +141,37 @@ template <class Curve> class CommitmentKey {
     {
         BB_BENCH_NAME("CommitmentKey::batch_commit");
 
+        std::vector<Commitment> commitments(polynomials.size());
+
+        // Only the polynomials the cache has no commitment for need an MSM
+        std::vector<size_t> uncached_indices(polynomials.size());
+        std::iota(uncached_indices.begin(), uncached_indices.end(), 0);
+        std::vector<typename CommitmentCache<Curve>::Key> cache_keys;
+        if (cache) {
+            uncached_indices.clear();
+            for (size_t i = 0; i < polynomials.size(); ++i) {
+                cache_keys.emplace_back(CommitmentCache<Curve>::get_key(polynomials[i]));
+                if (std::optional<Commitment> commitment = cache->find(cache_keys.back())) {
+                    commitments[i] = *commitment;
+                } else {
+                    uncached_indices.emplace_back(i);
+                }
+            }
+        }
+
         // We can only commit max_batch_size at a time
         // This is to prevent excessive memory usage in the pippenger algorithm
-        // First batch, create the commitments vector
-        std::vector<Commitment> commitments;
-
-        for (size_t i = 0; i < polynomials.size();) {
+        for (size_t i = 0; i < uncached_indices.size();) {
             // Note: have to be careful how we compute this to not overlow e.g. max_batch_size + 1 would
-            size_t batch_size = std::min(max_batch_size, polynomials.size() - i);
+            size_t batch_size = std::min(max_batch_size, uncached_indices.size() - i);
             size_t batch_end = i + batch_size;
 
             // Prepare spans for batch MSM
             std::vector<std::span<const G1>> points_spans;
             std::vector<std::span<Fr>> scalar_spans;
 
-            for (auto& polynomial : polynomials.subspan(i, batch_end - i)) {
+            for (size_t j = i; j < batch_end; ++j) {
+                auto& polynomial = polynomials[uncached_indices[j]];
                 std::span<const G1> point_table = srs->get_monomial_points().subspan(polynomial.start_index());
                 size_t consumed_srs = polynomial.start_index() + polynomial.size();
                 if (consumed_srs > srs->get_monomial_size()) {
@@ -144,9 +185,14 @@ template <class Curve> class CommitmentKey {
             }
 
             // Perform batch MSM
-            auto results = scalar_multiplication::MSM<Curve>::batch_multi_scalar_mul(points_spans, scalar_spans, false);
-            for (const auto& result : results) {
-                commitments.emplace_back(result);
+            auto results = scalar_multiplication::MSM<Curve>::batch_multi_scalar_mul(
+                points_spans, scalar_spans, /*handle_edge_cases=*/false, /*bucket_by_bit_length=*/true);
+            for (size_t j = i; j < batch_end; ++j) {
+                const size_t index = uncached_indices[j];
+                commitments[index] = results[j - i];
+                if (cache) {
+                    cache->insert(cache_keys[index], commitments[index]);
+                }
             }
             i += batch_size;
         }
@@ -162,11 +208,18 @@ template <class Curve> class CommitmentKey {
                                                             size_t max_batch_size = std::numeric_limits<size_t>::max())
         {
             std::vector<Commitment> commitments = key->batch_commit(wires, max_batch_size);
+            send_to_verifier(transcript, commitments);
+
+            return commitments;
+        }
+
+        // Send commitments to the polynomials of this batch, computed elsewhere, to the verifier
+        void send_to_verifier(auto transcript, std::span<const Commitment> commitments) const
+        {
+            BB_ASSERT_EQ(commitments.size(), labels.size());
             for (size_t i = 0; i < commitments.size(); ++i) {
                 transcript->send_to_verifier(labels[i], commitments[i]);
             }
-
-            return commitments;
         }
 
         void add_to_batch(Polynomial<Fr>& poly, const std::string& label, bool mask)
@@ -67,11 +67,16 @@ std::vector<typename GeminiProver_<Curve>::Claim> GeminiProver_<Curve>::prove(
     // Construct the d-1 Gemini foldings of A₀(X)
     std::vector<Polynomial> fold_polynomials = compute_fold_polynomials(log_n, multilinear_challenge, A_0, has_zk);
 
+    // Commit to all the folds in a single batch MSM: their sizes halve from one to the next, so committing to them one
+    // by one leaves most threads idle for all but the first few
+    const std::vector<Commitment> fold_commitments =
+        commitment_key.batch_commit(RefVector<Polynomial>(fold_polynomials));
+
     // If virtual_log_n >= log_n, pad the fold commitments with dummy group elements [1]_1.
     for (size_t l = 0; l < virtual_log_n - 1; l++) {
         std::string label = "Gemini:FOLD_" + std::to_string(l + 1);
         // When has_zk is true, we are sending commitments to 0. Seems to work, but maybe brittle.
-        transcript->send_to_verifier(label, commitment_key.commit(fold_polynomials[l]));
+        transcript->send_to_verifier(label, fold_commitments[l]);
     }
     const Fr r_challenge = transcript->template get_challenge<Fr>("Gemini:r");
 
@@ -18,8 +18,10 @@
 #include "barretenberg/stdlib/honk_verifier/ipa_accumulator.hpp"
 #include "barretenberg/stdlib/primitives/circuit_builders/circuit_builders_fwd.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <array>
 #include <cstddef>
 #include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -107,6 +109,10 @@ template <typename Curve_, size_t log_poly_length = CONST_ECCVM_LOG_N> class IPA
     // Compute the length of the vector of coefficients of a polynomial being opened.
     static constexpr size_t poly_length = 1UL << log_poly_length;
 
+    // Folding the generators with batched affine arithmetic costs a few hundred field inversions per thread on top of
+    // the scalar multiplications, which only pays off once every thread has at least this many points to fold
+    static constexpr size_t BATCHED_AFFINE_FOLD_MIN_POINTS_PER_THREAD = 64;
+
 // These allow access to internal functions so that we can never use a mock transcript unless it's fuzzing or testing of
 // IPA specifically
 #ifdef IPA_TEST
@@ -117,6 +123,39 @@ template <typename Curve_, size_t log_poly_length = CONST_ECCVM_LOG_N> class IPA
     friend class ProxyCaller;
 #endif
 
+    /**
+     * @brief Fold the generators of an IPA round in place: G_vec_new = G_vec_lo + G_vec_hi * round_challenge_inv
+     *
+     * @details Large rounds multiply G_vec_hi by the challenge with batched affine additions and add G_vec_lo the same
+     * way. Once the rounds get too small for the batch inversions of that to be amortised, every folded generator is
+     * computed in Jacobian coordinates and the round is converted back to affine with a single batch inversion. The
+     * last few rounds are too small to be worth dispatching to other threads and run on the calling one.
+     *
+     * @param G_vec The generators of the round, of size 2 * round_size. The first round_size entries are overwritten
+     * @param round_size
+     * @param round_challenge_inv
+     */
+    static void fold_generators(std::span<Commitment> G_vec, const size_t round_size, const Fr& round_challenge_inv)
+    {
+        const auto G_lo = G_vec.subspan(0, round_size);
+        const auto G_hi = G_vec.subspan(round_size, round_size);
+        if (round_size >= BATCHED_AFFINE_FOLD_MIN_POINTS_PER_THREAD * get_num_cpus()) {
+            auto G_hi_by_inverse_challenge = GroupElement::batch_mul_with_endomorphism(G_hi, round_challenge_inv);
+            GroupElement::batch_affine_add(G_lo, G_hi_by_inverse_challenge, G_lo);
+            return;
+        }
+
+        std::vector<GroupElement> G_folded(round_size);
+        parallel_for_heuristic(
+            round_size,
+            [&](size_t j) { G_folded[j] = GroupElement(G_hi[j]) * round_challenge_inv + G_lo[j]; },
+            thread_heuristics::SM_COST);
+        GroupElement::batch_normalize(G_folded.data(), round_size);
+        for (size_t j = 0; j < round_size; j++) {
+            G_lo[j] = Commitment(G_folded[j].x, G_folded[j].y);
+        }
+    }
+
     /**
      * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point.
      *
@@ -241,17 +280,20 @@ template <typename Curve_, size_t log_poly_length = CONST_ECCVM_LOG_N> class IPA
             auto [inner_prod_L, inner_prod_R] = sum_pairs(inner_prods);
             // Step 6.a (using letters, because doxygen automatically converts the sublist counters to letters :( )
             // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-
-            L_i = scalar_multiplication::pippenger_unsafe<Curve>({ 0, { &a_vec.at(0), /*size*/ round_size } },
-                                                                 { &G_vec_local[round_size], round_size });
-
-            L_i += aux_generator * inner_prod_L;
-
             // Step 6.b
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            R_i = scalar_multiplication::pippenger_unsafe<Curve>({ 0, { &a_vec.at(round_size), /*size*/ round_size } },
-                                                                 { &G_vec_local[0], /*size*/ round_size });
-            R_i += aux_generator * inner_prod_R;
+            // Both MSMs are computed in a single batch, so that the work is shared out between the threads at once
+            std::array<std::span<const Commitment>, 2> msm_points{
+                std::span<const Commitment>{ &G_vec_local[round_size], round_size },
+                std::span<const Commitment>{ &G_vec_local[0], round_size }
+            };
+            std::array<std::span<const Fr>, 2> msm_scalars{ std::span<const Fr>{ &a_vec.at(0), round_size },
+                                                            std::span<const Fr>{ &a_vec.at(round_size), round_size } };
+            auto L_R = scalar_multiplication::MSM<Curve>::batch_multi_scalar_mul(
+                msm_points, msm_scalars, /*handle_edge_cases=*/false);
+
+            L_i = aux_generator * inner_prod_L + L_R[0];
+            R_i = aux_generator * inner_prod_R + L_R[1];
 
             // Step 6.c
             // Send L_i and R_i to the verifier
@@ -270,14 +312,7 @@ template <typename Curve_, size_t log_poly_length = CONST_ECCVM_LOG_N> class IPA
 
             // Step 6.e
             // G_vec_new = G_vec_lo + G_vec_hi * round_challenge_inv
-            auto G_hi_by_inverse_challenge = GroupElement::batch_mul_with_endomorphism(
-                std::span{ G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size),
-                           G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size * 2) },
-                round_challenge_inv);
-            GroupElement::batch_affine_add(
-                std::span{ G_vec_local.begin(), G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size) },
-                G_hi_by_inverse_challenge,
-                G_vec_local);
+            fold_generators({ G_vec_local.data(), round_size * 2 }, round_size, round_challenge_inv);
 
             // Steps 6.e and 6.f
             // Update the vectors a_vec, b_vec.
@@ -163,6 +163,32 @@ TEST_F(IPATest, Open)
               result_of_prove_verify.verifier_transcript->get_manifest());
 }
 
+// Both ways of folding the generators, batched affine for large rounds and Jacobian for small ones, give G_lo + u⁻¹G_hi
+TEST_F(IPATest, FoldGenerators)
+{
+    const size_t num_cpus = get_num_cpus();
+    for (const size_t concurrency : { size_t(1), size_t(8) }) {
+        set_parallel_for_concurrency(concurrency);
+        for (size_t round_size = 1; round_size <= n / 2; round_size *= 2) {
+            std::vector<Commitment> G_vec(round_size * 2);
+            for (auto& point : G_vec) {
+                point = Commitment(GroupElement::random_element());
+            }
+            const Fr round_challenge_inv = this->random_element();
+
+            std::vector<Commitment> expected(round_size);
+            for (size_t j = 0; j < round_size; j++) {
+                expected[j] = Commitment(G_vec[j] + G_vec[round_size + j] * round_challenge_inv);
+            }
+            PCS::fold_generators(G_vec, round_size, round_challenge_inv);
+            for (size_t j = 0; j < round_size; j++) {
+                EXPECT_EQ(G_vec[j], expected[j]);
+            }
+        }
+    }
+    set_parallel_for_concurrency(num_cpus);
+}
+
 // poly and point are random, condition on the fact that the evaluation is zero.
 TEST_F(IPATest, OpeningValueZero)
 {
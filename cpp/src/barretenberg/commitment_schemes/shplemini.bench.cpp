@@ -0,0 +1,104 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "barretenberg/commitment_schemes/shplonk/shplemini.hpp"
+#include "barretenberg/commitment_schemes/utils/mock_witness_generator.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include <benchmark/benchmark.h>
+
+namespace bb {
+
+constexpr size_t MIN_LOG_N = 14;
+constexpr size_t MAX_LOG_N = 20;
+
+// Opening claims of the shape produced by Gemini for polynomials of size 2^log_n: A₀ opened at r and −r, and the fold
+// polynomials Aⱼ, each opened at ±r^{2^j}. The evaluations are random, which does not affect the cost of the division.
+template <typename Curve> std::vector<ProverOpeningClaim<Curve>> gemini_opening_claims(const size_t log_n)
+{
+    using Fr = typename Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const Fr r = Fr::random_element();
+    std::vector<ProverOpeningClaim<Curve>> claims;
+    claims.push_back({ .polynomial = Polynomial::random(1UL << log_n), .opening_pair = { r, Fr::random_element() } });
+    claims.push_back({ .polynomial = Polynomial::random(1UL << log_n), .opening_pair = { -r, Fr::random_element() } });
+    Fr r_pow = r.sqr();
+    for (size_t j = 1; j < log_n; ++j) {
+        claims.push_back({ .polynomial = Polynomial::random(1UL << (log_n - j)),
+                           .opening_pair = { -r_pow, Fr::random_element() },
+                           .gemini_fold = true });
+        r_pow = r_pow.sqr();
+    }
+    return claims;
+}
+
+// Construction of the Shplonk batched quotient Q(X) and of G(X) = Q(X) − Q_z(X) from the Gemini claims
+template <typename Curve> void bench_shplonk_batched_quotient(::benchmark::State& state)
+{
+    using ShplonkProver = ShplonkProver_<Curve>;
+    using Fr = typename Curve::ScalarField;
+
+    const size_t log_n = static_cast<size_t>(state.range(0));
+    auto claims = gemini_opening_claims<Curve>(log_n);
+    std::vector<Fr> gemini_fold_pos_evaluations(log_n - 1);
+    for (auto& evaluation : gemini_fold_pos_evaluations) {
+        evaluation = Fr::random_element();
+    }
+    const Fr nu = Fr::random_element();
+    const Fr z = Fr::random_element();
+
+    for (auto _ : state) {
+        auto quotient = ShplonkProver::compute_batched_quotient(log_n, claims, nu, gemini_fold_pos_evaluations, {}, {});
+        auto claim = ShplonkProver::compute_partially_evaluated_batched_quotient(
+            log_n, claims, quotient, nu, z, gemini_fold_pos_evaluations);
+        ::benchmark::DoNotOptimize(claim);
+    }
+}
+
+// The full Shplemini prover for a mock Ultra-like set of polynomials, up to the KZG opening claim
+void bench_shplemini_prove(::benchmark::State& state)
+{
+    using Curve = curve::BN254;
+    using Fr = Curve::ScalarField;
+    using ShpleminiProver = ShpleminiProver_<Curve>;
+
+    const size_t log_n = static_cast<size_t>(state.range(0));
+    const size_t n = 1UL << log_n;
+    bb::srs::init_file_crs_factory(bb::srs::bb_crs_path());
+    CommitmentKey<Curve> ck(n);
+
+    std::vector<Fr> mle_opening_point(log_n);
+    for (auto& challenge : mle_opening_point) {
+        challenge = Fr::random_element();
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        MockClaimGenerator<Curve> mock_claims(n,
+                                              /*num_polynomials*/ 40,
+                                              /*num_to_be_shifted*/ 8,
+                                              /*num_to_be_right_shifted_by_k*/ 0,
+                                              mle_opening_point,
+                                              ck);
+        auto transcript = NativeTranscript::prover_init_empty();
+        state.ResumeTiming();
+
+        auto claim = ShpleminiProver::prove(Fr(n), mock_claims.polynomial_batcher, mle_opening_point, ck, transcript);
+        ::benchmark::DoNotOptimize(claim);
+    }
+}
+
+BENCHMARK(bench_shplonk_batched_quotient<curve::BN254>)
+    ->DenseRange(MIN_LOG_N, MAX_LOG_N)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_shplonk_batched_quotient<curve::Grumpkin>)
+    ->DenseRange(MIN_LOG_N, MAX_LOG_N)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_shplemini_prove)->DenseRange(MIN_LOG_N, MAX_LOG_N, 2)->Unit(benchmark::kMillisecond);
+
+} // namespace bb
+
+BENCHMARK_MAIN();
@@ -9,6 +9,9 @@
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/commitment_schemes/verification_key.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/bb_bench.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/general/general.hpp"
 #include "barretenberg/stdlib/primitives/curves/bn254.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 
@@ -41,6 +44,9 @@ template <typename Curve> class ShplonkProver_ {
     /**
      * @brief Compute batched quotient polynomial Q(X) = ∑ⱼ νʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ )
      *
+     * @details The claim quotients are not materialized one at a time: they are all divided out and accumulated into
+     * Q(X) in a single blocked parallel pass, see add_batched_quotient_terms.
+     *
      * @param opening_claims list of prover opening claims {fⱼ(X), (xⱼ, vⱼ)} for a witness polynomial fⱼ(X), s.t. fⱼ(xⱼ)
      * = vⱼ.
      * @param nu batching challenge
@@ -49,17 +55,21 @@ template <typename Curve> class ShplonkProver_ {
     static Polynomial compute_batched_quotient(const size_t virtual_log_n,
                                                std::span<const ProverOpeningClaim<Curve>> opening_claims,
                                                const Fr& nu,
-                                               std::span<Fr> gemini_fold_pos_evaluations,
+                                               std::span<const Fr> gemini_fold_pos_evaluations,
                                                std::span<const ProverOpeningClaim<Curve>> libra_opening_claims,
                                                std::span<const ProverOpeningClaim<Curve>> sumcheck_round_claims)
     {
+        const std::vector<QuotientTerm> terms = get_quotient_terms(virtual_log_n,
+                                                                   opening_claims,
+                                                                   nu,
+                                                                   gemini_fold_pos_evaluations,
+                                                                   libra_opening_claims,
+                                                                   sumcheck_round_claims);
+
         // Find the maximum polynomial size among all claims to determine the dyadic size of the batched polynomial.
         size_t max_poly_size{ 0 };
-
-        for (const auto& claim_set : { opening_claims, libra_opening_claims, sumcheck_round_claims }) {
-            for (const auto& claim : claim_set) {
-                max_poly_size = std::max(max_poly_size, claim.polynomial.size());
-            }
+        for (const auto& term : terms) {
+            max_poly_size = std::max(max_poly_size, term.coefficients.size());
         }
         // The polynomials in Sumcheck Round claims and Libra opening claims are generally not dyadic,
         // so we round up to the next power of 2.
@@ -67,62 +77,7 @@ template <typename Curve> class ShplonkProver_ {
 
         // Q(X) = ∑ⱼ νʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ )
         Polynomial Q(max_poly_size);
-        Polynomial tmp(max_poly_size);
-
-        Fr current_nu = Fr::one();
-
-        size_t fold_idx = 0;
-        for (const auto& claim : opening_claims) {
-
-            // Gemini Fold Polynomials have to be opened at -r^{2^j} and r^{2^j}.
-            if (claim.gemini_fold) {
-                tmp = claim.polynomial;
-                tmp.at(0) = tmp[0] - gemini_fold_pos_evaluations[fold_idx++];
-                tmp.factor_roots(-claim.opening_pair.challenge);
-                // Add the claim quotient to the batched quotient polynomial
-                Q.add_scaled(tmp, current_nu);
-                current_nu *= nu;
-            }
-
-            // Compute individual claim quotient tmp = ( fⱼ(X) − vⱼ) / ( X − xⱼ )
-            tmp = claim.polynomial;
-            tmp.at(0) = tmp[0] - claim.opening_pair.evaluation;
-            tmp.factor_roots(claim.opening_pair.challenge);
-            // Add the claim quotient to the batched quotient polynomial
-            Q.add_scaled(tmp, current_nu);
-            current_nu *= nu;
-        }
-        // We use the same batching challenge for Gemini and Libra opening claims. The number of the claims
-        // batched before adding Libra commitments and evaluations is bounded by 2 * `virtual_log_n` + 2, where
-        // 2 * `virtual_log_n` is the number of fold claims including the dummy ones, and +2 is reserved for
-        // interleaving.
-        if (!libra_opening_claims.empty()) {
-            current_nu = nu.pow(2 * virtual_log_n + NUM_INTERLEAVING_CLAIMS);
-        }
-
-        for (const auto& claim : libra_opening_claims) {
-            // Compute individual claim quotient tmp = ( fⱼ(X) − vⱼ) / ( X − xⱼ )
-            tmp = claim.polynomial;
-            tmp.at(0) = tmp[0] - claim.opening_pair.evaluation;
-            tmp.factor_roots(claim.opening_pair.challenge);
-
-            // Add the claim quotient to the batched quotient polynomial
-            Q.add_scaled(tmp, current_nu);
-            current_nu *= nu;
-        }
-
-        for (const auto& claim : sumcheck_round_claims) {
-
-            // Compute individual claim quotient tmp = ( fⱼ(X) − vⱼ) / ( X − xⱼ )
-            tmp = claim.polynomial;
-            tmp.at(0) = tmp[0] - claim.opening_pair.evaluation;
-            tmp.factor_roots(claim.opening_pair.challenge);
-
-            // Add the claim quotient to the batched quotient polynomial
-            Q.add_scaled(tmp, current_nu);
-            current_nu *= nu;
-        }
-        // Return batched quotient polynomial Q(X)
+        add_batched_quotient_terms(Q, terms);
         return Q;
     };
 
@@ -138,94 +93,72 @@ template <typename Curve> class ShplonkProver_ {
      */
     static ProverOpeningClaim<Curve> compute_partially_evaluated_batched_quotient(
         const size_t virtual_log_n,
-        std::span<ProverOpeningClaim<Curve>> opening_claims,
+        std::span<const ProverOpeningClaim<Curve>> opening_claims,
         Polynomial& batched_quotient_Q,
         const Fr& nu_challenge,
         const Fr& z_challenge,
-        std::span<Fr> gemini_fold_pos_evaluations,
-        std::span<ProverOpeningClaim<Curve>> libra_opening_claims = {},
-        std::span<ProverOpeningClaim<Curve>> sumcheck_opening_claims = {})
+        std::span<const Fr> gemini_fold_pos_evaluations,
+        std::span<const ProverOpeningClaim<Curve>> libra_opening_claims = {},
+        std::span<const ProverOpeningClaim<Curve>> sumcheck_opening_claims = {})
     {
-        // Our main use case is the opening of Gemini fold polynomials and each Gemini fold is opened at 2 points.
-        const size_t num_gemini_opening_claims = 2 * opening_claims.size();
-        const size_t num_opening_claims =
-            num_gemini_opening_claims + libra_opening_claims.size() + sumcheck_opening_claims.size();
-
-        // {ẑⱼ(z)}ⱼ , where ẑⱼ(r) = 1/zⱼ(z) = 1/(z - xⱼ)
+        const std::vector<QuotientTerm> terms = get_quotient_terms(virtual_log_n,
+                                                                   opening_claims,
+                                                                   nu_challenge,
+                                                                   gemini_fold_pos_evaluations,
+                                                                   libra_opening_claims,
+                                                                   sumcheck_opening_claims);
+
+        // {ẑⱼ(z)}ⱼ , where ẑⱼ(r) = 1/zⱼ(z) = 1/(z - xⱼ)
         std::vector<Fr> inverse_vanishing_evals;
-        inverse_vanishing_evals.reserve(num_opening_claims);
-        for (const auto& claim : opening_claims) {
-            if (claim.gemini_fold) {
-                inverse_vanishing_evals.emplace_back(z_challenge + claim.opening_pair.challenge);
-            }
-            inverse_vanishing_evals.emplace_back(z_challenge - claim.opening_pair.challenge);
-        }
-
-        // Add the terms (z - uₖ) for k = 0, …, d−1 where d is the number of rounds in Sumcheck
-        for (const auto& claim : libra_opening_claims) {
-            inverse_vanishing_evals.emplace_back(z_challenge - claim.opening_pair.challenge);
-        }
-
-        for (const auto& claim : sumcheck_opening_claims) {
-            inverse_vanishing_evals.emplace_back(z_challenge - claim.opening_pair.challenge);
+        inverse_vanishing_evals.reserve(terms.size());
+        for (const auto& term : terms) {
+            inverse_vanishing_evals.emplace_back(z_challenge - term.root);
         }
-
         Fr::batch_invert(inverse_vanishing_evals);
 
         // G(X) = Q(X) - Q_z(X) = Q(X) - ∑ⱼ νʲ ⋅ ( fⱼ(X) − vⱼ) / ( z − xⱼ ),
         // s.t. G(r) = 0
         Polynomial G(std::move(batched_quotient_Q)); // G(X) = Q(X)
 
-        // G₀ = ∑ⱼ νʲ ⋅ vⱼ / ( z − xⱼ )
-        Fr current_nu = Fr::one();
-        Polynomial tmp(G.size());
-        size_t idx = 0;
-
-        size_t fold_idx = 0;
-        for (auto& claim : opening_claims) {
-
-            if (claim.gemini_fold) {
-                tmp = claim.polynomial;
-                tmp.at(0) = tmp[0] - gemini_fold_pos_evaluations[fold_idx++];
-                Fr scaling_factor = current_nu * inverse_vanishing_evals[idx++]; // = νʲ / (z − xⱼ )
-                // G -= νʲ ⋅ ( fⱼ(X) − vⱼ) / ( z − xⱼ )
-                G.add_scaled(tmp, -scaling_factor);
-
-                current_nu *= nu_challenge;
+        // The two claims on a Gemini fold polynomial share it, so each distinct polynomial is scaled by the sum of the
+        // factors νʲ / ( z − xⱼ ) of its claims. The evaluations only contribute to G₀ = ∑ⱼ νʲ ⋅ vⱼ / ( z − xⱼ ).
+        std::vector<std::pair<std::span<const Fr>, Fr>> scaled_polynomials;
+        scaled_polynomials.reserve(terms.size());
+        Fr constant_term = Fr::zero();
+        for (size_t idx = 0; idx < terms.size(); ++idx) {
+            const QuotientTerm& term = terms[idx];
+            const Fr scaling_factor = term.scalar * inverse_vanishing_evals[idx]; // = νʲ / (z − xⱼ )
+            constant_term += scaling_factor * term.evaluation;
+            if (!scaled_polynomials.empty() && scaled_polynomials.back().first.data() == term.coefficients.data() &&
+                scaled_polynomials.back().first.size() == term.coefficients.size()) {
+                scaled_polynomials.back().second += scaling_factor;
+            } else {
+                scaled_polynomials.emplace_back(term.coefficients, scaling_factor);
             }
-            // tmp = νʲ ⋅ ( fⱼ(X) − vⱼ) / ( z − xⱼ )
-            claim.polynomial.at(0) = claim.polynomial[0] - claim.opening_pair.evaluation;
-            Fr scaling_factor = current_nu * inverse_vanishing_evals[idx++]; // = νʲ / (z − xⱼ )
-
-            // G -= νʲ ⋅ ( fⱼ(X) − vⱼ) / ( z − xⱼ )
-            G.add_scaled(claim.polynomial, -scaling_factor);
-
-            current_nu *= nu_challenge;
-        }
-
-        // Take into account the constant proof size in Gemini
-        if (!libra_opening_claims.empty()) {
-            current_nu = nu_challenge.pow(2 * virtual_log_n + NUM_INTERLEAVING_CLAIMS);
         }
 
-        for (auto& claim : libra_opening_claims) {
-            // Compute individual claim quotient tmp = ( fⱼ(X) − vⱼ) / ( X − xⱼ )
-            claim.polynomial.at(0) = claim.polynomial[0] - claim.opening_pair.evaluation;
-            Fr scaling_factor = current_nu * inverse_vanishing_evals[idx++]; // = νʲ / (z − xⱼ )
-
-            // Add the claim quotient to the batched quotient polynomial
-            G.add_scaled(claim.polynomial, -scaling_factor);
-            current_nu *= nu_challenge;
+        // G -= ∑ⱼ νʲ ⋅ fⱼ(X) / ( z − xⱼ ), one cache-sized block of G at a time
+        BB_ASSERT_EQ(G.start_index(), 0UL);
+        Fr* G_coeffs = G.data();
+        const size_t num_blocks = (G.size() + QUOTIENT_BLOCK_SIZE - 1) / QUOTIENT_BLOCK_SIZE;
+        parallel_for_heuristic(
+            num_blocks,
+            [&](size_t block_idx) {
+                const size_t block_start = block_idx * QUOTIENT_BLOCK_SIZE;
+                const size_t block_end = std::min(block_start + QUOTIENT_BLOCK_SIZE, G.size());
+                for (const auto& [coefficients, scaling_factor] : scaled_polynomials) {
+                    BB_ASSERT_LTE(coefficients.size(), G.size());
+                    const size_t end = std::min(block_end, coefficients.size());
+                    for (size_t i = block_start; i < end; ++i) {
+                        G_coeffs[i] -= scaling_factor * coefficients[i];
+                    }
+                }
+            },
+            thread_heuristics::ALWAYS_MULTITHREAD);
+        if (!G.is_empty()) {
+            G.at(0) += constant_term;
         }
 
-        for (auto& claim : sumcheck_opening_claims) {
-            claim.polynomial.at(0) = claim.polynomial[0] - claim.opening_pair.evaluation;
-            Fr scaling_factor = current_nu * inverse_vanishing_evals[idx++]; // = νʲ / (z − xⱼ )
-
-            // Add the claim quotient to the batched quotient polynomial
-            G.add_scaled(claim.polynomial, -scaling_factor);
-            current_nu *= nu_challenge;
-        }
         // Return opening pair (z, 0) and polynomial G(X) = Q(X) - Q_z(X)
         return { .polynomial = G, .opening_pair = { .challenge = z_challenge, .evaluation = Fr::zero() } };
     };
@@ -295,6 +228,174 @@ template <typename Curve> class ShplonkProver_ {
                                                             libra_opening_claims,
                                                             sumcheck_round_claims);
     }
+
+  private:
+    // Coefficients per block of the batched quotient kernels: a block of the quotient and of a claim polynomial fit in
+    // the L2 cache together
+    static constexpr size_t QUOTIENT_BLOCK_SIZE = 1 << 12;
+
+    /**
+     * @brief A claim quotient νʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ ) of the batched quotient
+     */
+    struct QuotientTerm {
+        std::span<const Fr> coefficients; // fⱼ
+        Fr evaluation;                    // vⱼ
+        Fr root;                          // xⱼ
+        Fr scalar;                        // νʲ
+    };
+
+    /**
+     * @brief List the claims in the order in which they are batched, each with its power of the batching challenge
+     * @details A Gemini fold claim yields two terms, one for each of the points −r^{2^j} and r^{2^j} it is opened at.
+     */
+    static std::vector<QuotientTerm> get_quotient_terms(
+        const size_t virtual_log_n,
+        std::span<const ProverOpeningClaim<Curve>> opening_claims,
+        const Fr& nu,
+        std::span<const Fr> gemini_fold_pos_evaluations,
+        std::span<const ProverOpeningClaim<Curve>> libra_opening_claims,
+        std::span<const ProverOpeningClaim<Curve>> sumcheck_round_claims)
+    {
+        std::vector<QuotientTerm> terms;
+        terms.reserve(2 * opening_claims.size() + libra_opening_claims.size() + sumcheck_round_claims.size());
+
+        Fr current_nu = Fr::one();
+        const auto add_term = [&](const ProverOpeningClaim<Curve>& claim, const Fr& evaluation, const Fr& root) {
+            BB_ASSERT_EQ(claim.polynomial.start_index(), 0UL);
+            terms.push_back({ claim.polynomial.coeffs(), evaluation, root, current_nu });
+            current_nu *= nu;
+        };
+
+        size_t fold_idx = 0;
+        for (const auto& claim : opening_claims) {
+            // Gemini Fold Polynomials have to be opened at -r^{2^j} and r^{2^j}.
+            if (claim.gemini_fold) {
+                add_term(claim, gemini_fold_pos_evaluations[fold_idx++], -claim.opening_pair.challenge);
+            }
+            add_term(claim, claim.opening_pair.evaluation, claim.opening_pair.challenge);
+        }
+        // We use the same batching challenge for Gemini and Libra opening claims. The number of the claims
+        // batched before adding Libra commitments and evaluations is bounded by 2 * `virtual_log_n` + 2, where
+        // 2 * `virtual_log_n` is the number of fold claims including the dummy ones, and +2 is reserved for
+        // interleaving.
+        if (!libra_opening_claims.empty()) {
+            current_nu = nu.pow(2 * virtual_log_n + NUM_INTERLEAVING_CLAIMS);
+        }
+        for (const auto& claim : libra_opening_claims) {
+            add_term(claim, claim.opening_pair.evaluation, claim.opening_pair.challenge);
+        }
+        for (const auto& claim : sumcheck_round_claims) {
+            add_term(claim, claim.opening_pair.evaluation, claim.opening_pair.challenge);
+        }
+        return terms;
+    }
+
+    /**
+     * @brief Add ∑ⱼ νʲ ⋅ ( fⱼ(X) − vⱼ) / ( X − xⱼ ) to Q(X) in one blocked parallel pass
+     *
+     * @details Division by ( X − x ) is the recurrence bᵢ = c ⋅ ( aᵢ − bᵢ₋₁ ) with c = (−x)⁻¹, see
+     * polynomial_arithmetic::factor_roots. Writing bᵢ = c ⋅ uᵢ turns it into uᵢ = aᵢ − c ⋅ uᵢ₋₁, which is affine in
+     * uᵢ₋₁: over a range of length ℓ, the value of u is its value for a zero u carried into the range plus (−c)^ℓ times
+     * the carried u. Subtracting v from a₀ amounts to carrying u₋₁ = v / c = −v ⋅ x into the first range.
+     *
+     * The division is therefore computed as a parallel prefix. The quotient is split into one range per thread. Each
+     * thread but the last runs the recurrences over its range from zero, the carries into the ranges are chained
+     * serially, and each thread then reruns the recurrences over its range from the right carries, adding νʲ ⋅ c ⋅ uᵢ
+     * to Q. The second pass walks its range block by block and adds the quotients of all claims to a block before
+     * moving on, so the block of Q stays in cache. A division by X, for a zero opening point, is a shift instead.
+     */
+    static void add_batched_quotient_terms(Polynomial& quotient, std::span<const QuotientTerm> terms)
+    {
+        BB_BENCH_NAME("ShplonkProver::add_batched_quotient_terms");
+        BB_ASSERT_EQ(quotient.start_index(), 0UL);
+        const size_t num_terms = terms.size();
+
+        // The quotient of fⱼ has size(fⱼ) − 1 coefficients
+        std::vector<size_t> quotient_sizes(num_terms);
+        size_t max_quotient_size = 0;
+        for (size_t j = 0; j < num_terms; ++j) {
+            BB_ASSERT_LTE(terms[j].coefficients.size(), quotient.size());
+            quotient_sizes[j] = terms[j].coefficients.empty() ? 0 : terms[j].coefficients.size() - 1;
+            max_quotient_size = std::max(max_quotient_size, quotient_sizes[j]);
+        }
+        if (max_quotient_size == 0) {
+            return;
+        }
+
+        // c = (−xⱼ)⁻¹, left as zero by the batch inversion for a zero opening point
+        std::vector<Fr> inverse_neg_roots(num_terms);
+        for (size_t j = 0; j < num_terms; ++j) {
+            inverse_neg_roots[j] = -terms[j].root;
+        }
+        Fr::batch_invert(inverse_neg_roots);
+
+        const size_t num_threads = calculate_num_threads(max_quotient_size, QUOTIENT_BLOCK_SIZE);
+        const size_t range_size =
+            numeric::ceil_div((max_quotient_size + num_threads - 1) / num_threads, QUOTIENT_BLOCK_SIZE) *
+            QUOTIENT_BLOCK_SIZE;
+        const size_t num_ranges = numeric::ceil_div(max_quotient_size, range_size);
+
+        // The u carried into range r for claim j is at carries[r * num_terms + j]
+        std::vector<Fr> carries(num_ranges * num_terms);
+        for (size_t j = 0; j < num_terms; ++j) {
+            carries[j] = -terms[j].evaluation * terms[j].root;
+        }
+        if (num_ranges > 1) {
+            // u at the end of each range but the last, starting from zero
+            std::vector<Fr> range_ends((num_ranges - 1) * num_terms);
+            parallel_for(num_ranges - 1, [&](size_t range_idx) {
+                const size_t range_start = range_idx * range_size;
+                for (size_t j = 0; j < num_terms; ++j) {
+                    const size_t range_end = std::min(range_start + range_size, quotient_sizes[j]);
+                    const Fr& c = inverse_neg_roots[j];
+                    const std::span<const Fr> coefficients = terms[j].coefficients;
+                    Fr u = Fr::zero();
+                    for (size_t i = range_start; i < range_end; ++i) {
+                        u = coefficients[i] - c * u;
+                    }
+                    range_ends[range_idx * num_terms + j] = u;
+                }
+            });
+            // Chain the carries. Past the end of a claim quotient they are meaningless but also unused.
+            for (size_t j = 0; j < num_terms; ++j) {
+                const Fr carry_factor = (-inverse_neg_roots[j]).pow(range_size);
+                for (size_t range_idx = 1; range_idx < num_ranges; ++range_idx) {
+                    const size_t prev = (range_idx - 1) * num_terms + j;
+                    carries[range_idx * num_terms + j] = range_ends[prev] + carry_factor * carries[prev];
+                }
+            }
+        }
+
+        Fr* quotient_coeffs = quotient.data();
+        parallel_for(num_ranges, [&](size_t range_idx) {
+            const size_t range_start = range_idx * range_size;
+            const size_t range_end = std::min(range_start + range_size, max_quotient_size);
+            std::vector<Fr> u(carries.begin() + static_cast<std::ptrdiff_t>(range_idx * num_terms),
+                              carries.begin() + static_cast<std::ptrdiff_t>((range_idx + 1) * num_terms));
+            for (size_t block_start = range_start; block_start < range_end; block_start += QUOTIENT_BLOCK_SIZE) {
+                const size_t block_end = std::min(block_start + QUOTIENT_BLOCK_SIZE, range_end);
+                for (size_t j = 0; j < num_terms; ++j) {
+                    const size_t end = std::min(block_end, quotient_sizes[j]);
+                    const std::span<const Fr> coefficients = terms[j].coefficients;
+                    if (terms[j].root.is_zero()) {
+                        // ( f(X) − v ) / X = f₁ + f₂ ⋅ X + ⋯
+                        for (size_t i = block_start; i < end; ++i) {
+                            quotient_coeffs[i] += terms[j].scalar * coefficients[i + 1];
+                        }
+                        continue;
+                    }
+                    const Fr& c = inverse_neg_roots[j];
+                    const Fr scaled_c = terms[j].scalar * c;
+                    Fr u_j = u[j];
+                    for (size_t i = block_start; i < end; ++i) {
+                        u_j = coefficients[i] - c * u_j;
+                        quotient_coeffs[i] += scaled_c * u_j;
+                    }
+                    u[j] = u_j;
+                }
+            }
+        });
+    }
 };
 
 /**
@@ -136,4 +136,79 @@ TYPED_TEST(ShplonkTest, ExportBatchClaimAndVerify)
         EXPECT_TRUE(result);
     }
 }
+
+// The claim quotients are divided out in one blocked parallel pass; check it against claim by claim division, with
+// polynomials large enough to be split between threads
+TYPED_TEST(ShplonkTest, BatchedQuotientMatchesClaimByClaimDivision)
+{
+    using ShplonkProver = ShplonkProver_<TypeParam>;
+    using Fr = typename TypeParam::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+    using Claim = ProverOpeningClaim<TypeParam>;
+
+    const size_t original_concurrency = get_num_cpus();
+    set_parallel_for_concurrency(8);
+
+    const size_t log_n = 15;
+    const Fr r = Fr::random_element();
+    const Fr nu = Fr::random_element();
+    const Fr z = Fr::random_element();
+
+    // Gemini fold claims, opened at ±r^{2^j}
+    std::vector<Claim> opening_claims;
+    std::vector<Fr> gemini_fold_pos_evaluations;
+    Fr r_pow = r;
+    for (size_t j = 0; j < 4; ++j) {
+        Polynomial poly = Polynomial::random(1UL << (log_n - j));
+        gemini_fold_pos_evaluations.push_back(poly.evaluate(r_pow));
+        const Fr evaluation = poly.evaluate(-r_pow);
+        opening_claims.push_back(
+            { .polynomial = std::move(poly), .opening_pair = { -r_pow, evaluation }, .gemini_fold = true });
+        r_pow = r_pow.sqr();
+    }
+    // Claims on polynomials of non-dyadic sizes, one of them opened at zero
+    const auto make_claim = [](size_t size, const Fr& challenge) {
+        Polynomial poly = Polynomial::random(size);
+        const Fr evaluation = poly.evaluate(challenge);
+        return Claim{ .polynomial = std::move(poly), .opening_pair = { challenge, evaluation } };
+    };
+    std::vector<Claim> libra_opening_claims{ make_claim(5000, Fr::random_element()), make_claim(13, r) };
+    std::vector<Claim> sumcheck_round_claims{ make_claim(7, Fr::random_element()), make_claim(20000, Fr::zero()) };
+
+    // Divide claim by claim
+    Polynomial expected_Q(1UL << log_n);
+    Polynomial expected_G(1UL << log_n);
+    Fr current_nu = Fr::one();
+    const auto add_claim = [&](const Polynomial& poly, const Fr& evaluation, const Fr& challenge) {
+        Polynomial tmp(poly);
+        tmp.at(0) -= evaluation;
+        expected_G.add_scaled(tmp, -current_nu / (z - challenge));
+        tmp.factor_roots(challenge);
+        expected_Q.add_scaled(tmp, current_nu);
+        current_nu *= nu;
+    };
+    for (auto [claim, pos_evaluation] : zip_view(opening_claims, gemini_fold_pos_evaluations)) {
+        add_claim(claim.polynomial, pos_evaluation, -claim.opening_pair.challenge);
+        add_claim(claim.polynomial, claim.opening_pair.evaluation, claim.opening_pair.challenge);
+    }
+    current_nu = nu.pow(2 * log_n + NUM_INTERLEAVING_CLAIMS);
+    for (const auto& claim : libra_opening_claims) {
+        add_claim(claim.polynomial, claim.opening_pair.evaluation, claim.opening_pair.challenge);
+    }
+    for (const auto& claim : sumcheck_round_claims) {
+        add_claim(claim.polynomial, claim.opening_pair.evaluation, claim.opening_pair.challenge);
+    }
+    expected_G += expected_Q;
+
+    Polynomial Q = ShplonkProver::compute_batched_quotient(
+        log_n, opening_claims, nu, gemini_fold_pos_evaluations, libra_opening_claims, sumcheck_round_claims);
+    EXPECT_EQ(Q, expected_Q);
+
+    const Claim G = ShplonkProver::compute_partially_evaluated_batched_quotient(
+        log_n, opening_claims, Q, nu, z, gemini_fold_pos_evaluations, libra_opening_claims, sumcheck_round_claims);
+    EXPECT_EQ(G.polynomial, expected_G);
+    EXPECT_EQ(G.polynomial.evaluate(z), Fr::zero());
+
+    set_parallel_for_concurrency(original_concurrency);
+}
 } // namespace bb
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "barretenberg/common/thread.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief A 64-bit digest of the raw bytes of `elements`, used to detect truncated or damaged on-disk caches.
+ * @details This guards against accidental damage, not against tampering: anyone able to write a cache could equally
+ * replace the data it was built from. Fixed-size blocks of elements are digested in parallel and their digests are
+ * then folded in order, so the result does not depend on the number of threads.
+ */
+template <typename T> uint64_t content_digest(std::span<const T> elements)
+{
+    constexpr size_t ELEMENTS_PER_BLOCK = 1 << 12;
+    constexpr uint64_t MULTIPLIER = 0x9e3779b97f4a7c15;
+    constexpr size_t NUM_LANES = 4;
+    static_assert(sizeof(T) % (NUM_LANES * sizeof(uint64_t)) == 0);
+    auto mix = [](uint64_t state, uint64_t word) {
+        state = (state ^ word) * MULTIPLIER;
+        return state ^ (state >> 29);
+    };
+
+    const size_t num_blocks = (elements.size() + ELEMENTS_PER_BLOCK - 1) / ELEMENTS_PER_BLOCK;
+    std::vector<uint64_t> block_digests(num_blocks);
+    parallel_for([&](const ThreadChunk& chunk) {
+        for (size_t block_idx : chunk.range(num_blocks)) {
+            const size_t start = block_idx * ELEMENTS_PER_BLOCK;
+            const size_t end = std::min(start + ELEMENTS_PER_BLOCK, elements.size());
+            const auto* bytes = reinterpret_cast<const uint8_t*>(elements.data() + start);
+            const size_t num_words = (end - start) * sizeof(T) / sizeof(uint64_t);
+            // Independent lanes so that consecutive words do not wait on each other's multiplication
+            std::array<uint64_t, NUM_LANES> lanes{ 1, 2, 3, 4 };
+            for (size_t i = 0; i < num_words; i += NUM_LANES) {
+                for (size_t lane = 0; lane < NUM_LANES; lane++) {
+                    uint64_t word = 0;
+                    std::memcpy(&word, bytes + (i + lane) * sizeof(uint64_t), sizeof(uint64_t));
+                    lanes[lane] = mix(lanes[lane], word);
+                }
+            }
+            uint64_t block_digest = end - start;
+            for (uint64_t lane : lanes) {
+                block_digest = mix(block_digest, lane);
+            }
+            block_digests[block_idx] = block_digest;
+        }
+    });
+
+    uint64_t digest = elements.size();
+    for (uint64_t block_digest : block_digests) {
+        digest = mix(digest, block_digest);
+    }
+    return digest;
+}
+
+} // namespace bb
@@ -0,0 +1,65 @@
+#pragma once
+
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+#include <cpuid.h>
+#include <cstdint>
+#endif
+
+namespace bb {
+
+/**
+ * @brief The instruction set extensions of the host CPU that have hand-written back ends, detected at runtime so that a
+ * single binary can use them where available
+ *
+ * @details Everything is reported unavailable off x86-64 and when DISABLE_ASM is set (WASM, ARM, ASAN builds), in
+ * which case the callers fall back to their portable implementation.
+ */
+struct CpuFeatures {
+    bool avx2 = false;
+    bool avx512f = false;
+    bool sha = false;
+
+    static CpuFeatures detect()
+    {
+        CpuFeatures features;
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+        unsigned int eax = 0;
+        unsigned int ebx = 0;
+        unsigned int ecx = 0;
+        unsigned int edx = 0;
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+            return features;
+        }
+        // The OS has to save the extended registers on context switches before we can use them
+        const bool osxsave = (ecx & (1U << 27)) != 0;
+        uint64_t xcr0 = 0;
+        if (osxsave) {
+            uint32_t xcr0_lo = 0;
+            uint32_t xcr0_hi = 0;
+            __asm__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+            xcr0 = (static_cast<uint64_t>(xcr0_hi) << 32) | xcr0_lo;
+        }
+        const bool ymm_enabled = (xcr0 & 0x6) == 0x6;
+        const bool zmm_enabled = (xcr0 & 0xe6) == 0xe6;
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+            return features;
+        }
+        features.avx2 = ymm_enabled && (ebx & (1U << 5)) != 0;
+        features.avx512f = zmm_enabled && (ebx & (1U << 16)) != 0;
+        // SHA-NI works on xmm registers only, the SSE4.1 we use alongside it is implied by every CPU that has it
+        features.sha = (ebx & (1U << 29)) != 0;
+#endif
+        return features;
+    }
+};
+
+/**
+ * @brief The features of the host CPU, detected on first use
+ */
+inline const CpuFeatures& cpu_features()
+{
+    static const CpuFeatures features = CpuFeatures::detect();
+    return features;
+}
+
+} // namespace bb
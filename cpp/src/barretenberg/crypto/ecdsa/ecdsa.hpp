@@ -12,7 +12,9 @@
 
 #include "barretenberg/serialize/msgpack.hpp"
 #include <array>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace bb::crypto {
 template <typename Fr, typename G1> struct ecdsa_key_pair {
@@ -42,6 +44,18 @@ bool ecdsa_verify_signature(const std::string& message,
                             const typename G1::affine_element& public_key,
                             const ecdsa_signature& signature);
 
+/**
+ * @brief Verify a batch of signatures, returning the validity of each one as ecdsa_verify_signature would
+ *
+ * @details The nonce R of each signature is recovered from r and the recovery id v, and all the verification equations
+ * u1⋅G + u2⋅P - R = 0 are checked at once through a single multi-scalar multiplication weighted by random 128-bit
+ * scalars. If the combined check fails, or for signatures that cannot enter it, each signature is verified on its own.
+ */
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> ecdsa_verify_signatures(std::span<const std::string> messages,
+                                          std::span<const typename G1::affine_element> public_keys,
+                                          std::span<const ecdsa_signature> signatures);
+
 inline bool operator==(ecdsa_signature const& lhs, ecdsa_signature const& rhs)
 {
     return lhs.r == rhs.r && lhs.s == rhs.s && lhs.v == rhs.v;
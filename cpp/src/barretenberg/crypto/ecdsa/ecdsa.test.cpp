@@ -179,3 +179,58 @@ TEST(ecdsa, verify_signature_secp256r1_sha256_NIST_1)
         ecdsa_verify_signature<Sha256Hasher, secp256r1::fq, secp256r1::fr, secp256r1::g1>(message, public_key, sig);
     EXPECT_EQ(result, true);
 }
+
+template <typename Fq, typename Fr, typename G1> void test_verify_signatures_batch()
+{
+    constexpr size_t num_signatures = 20;
+    std::vector<std::string> messages;
+    std::vector<typename G1::affine_element> public_keys;
+    std::vector<ecdsa_signature> signatures;
+    // Accounts sign several messages of the batch, so the combined check sees repeated points
+    std::vector<ecdsa_key_pair<Fr, G1>> accounts(4);
+    for (auto& account : accounts) {
+        account.private_key = Fr::random_element();
+        account.public_key = G1::one * account.private_key;
+    }
+    for (size_t i = 0; i < num_signatures; ++i) {
+        const auto& account = accounts[i % accounts.size()];
+        messages.emplace_back("message " + std::to_string(i));
+        public_keys.emplace_back(account.public_key);
+        signatures.emplace_back(ecdsa_construct_signature<Sha256Hasher, Fq, Fr, G1>(messages.back(), account));
+    }
+
+    auto verify_each = [&]() {
+        std::vector<bool> expected;
+        for (size_t i = 0; i < num_signatures; ++i) {
+            expected.push_back(
+                ecdsa_verify_signature<Sha256Hasher, Fq, Fr, G1>(messages[i], public_keys[i], signatures[i]));
+        }
+        return expected;
+    };
+
+    std::vector<bool> all_valid(num_signatures, true);
+    EXPECT_EQ(verify_each(), all_valid);
+    EXPECT_EQ((ecdsa_verify_signatures<Sha256Hasher, Fq, Fr, G1>(messages, public_keys, signatures)), all_valid);
+
+    // A wrong recovery id does not invalidate the signature but makes the combined check fail
+    signatures[3].v ^= 1;
+    EXPECT_EQ((ecdsa_verify_signatures<Sha256Hasher, Fq, Fr, G1>(messages, public_keys, signatures)), all_valid);
+
+    messages[5] = "another message";
+    public_keys[7] = public_keys[8];
+    signatures[11].r = {};
+    signatures[13].v = 31;
+    std::vector<bool> expected = verify_each();
+    EXPECT_EQ(std::count(expected.begin(), expected.end(), false), 3);
+    EXPECT_EQ((ecdsa_verify_signatures<Sha256Hasher, Fq, Fr, G1>(messages, public_keys, signatures)), expected);
+}
+
+TEST(ecdsa, verify_signatures_batch_secp256k1_sha256)
+{
+    test_verify_signatures_batch<secp256k1::fq, secp256k1::fr, secp256k1::g1>();
+}
+
+TEST(ecdsa, verify_signatures_batch_secp256r1_sha256)
+{
+    test_verify_signatures_batch<secp256r1::fq, secp256r1::fr, secp256r1::g1>();
+}
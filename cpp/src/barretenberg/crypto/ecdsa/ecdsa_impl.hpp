@@ -8,6 +8,10 @@
 
 #include "../hmac/hmac.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/groups/fixed_base_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 
 namespace bb::crypto {
@@ -22,7 +26,7 @@ ecdsa_signature ecdsa_construct_signature(const std::string& message, const ecds
     write(pkey_buffer, account.private_key);
     Fr k = crypto::get_unbiased_field_from_hmac<Hash, Fr>(message, pkey_buffer);
 
-    typename G1::affine_element R(G1::one * k);
+    typename G1::affine_element R(FixedBaseTable<G1>::generator().mul(uint256_t(k)));
     Fq::serialize_to_buffer(R.x, &sig.r[0]);
 
     std::vector<uint8_t> message_buffer;
@@ -120,7 +124,7 @@ typename G1::affine_element ecdsa_recover_public_key(const std::string& message,
     Fr u1 = -(z * r_inv);
     Fr u2 = s * r_inv;
 
-    Point recovered_public_key(Point(point_R) * u2 + G1::one * u1);
+    Point recovered_public_key(Point(point_R) * u2 + FixedBaseTable<G1>::generator().mul(uint256_t(u1)));
     return recovered_public_key;
 }
 
@@ -164,11 +168,147 @@ bool ecdsa_verify_signature(const std::string& message,
     Fr u1 = z * s_inv;
     Fr u2 = r * s_inv;
 
-    typename G1::affine_element R((typename G1::element(public_key) * u2) + (G1::one * u1));
+    typename G1::affine_element R((typename G1::element(public_key) * u2) +
+                                  FixedBaseTable<G1>::generator().mul(uint256_t(u1)));
     BB_ASSERT_EQ(R.is_point_at_infinity(), false, "Result of the scalar multiplication is the point at infinity.");
 
     uint256_t Rx(R.x);
     Fr result(Rx);
     return result == r;
 }
+
+namespace detail {
+/**
+ * @brief The curve whose MSM computes the combined check of ecdsa_verify_signatures over the group G1
+ */
+template <typename G1> struct EcdsaCurve;
+template <> struct EcdsaCurve<secp256k1::g1> {
+    using type = curve::SECP256K1;
+};
+template <> struct EcdsaCurve<secp256r1::g1> {
+    using type = curve::SECP256R1;
+};
+template <> struct EcdsaCurve<grumpkin::g1> {
+    using type = curve::Grumpkin;
+};
+} // namespace detail
+
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> ecdsa_verify_signatures(std::span<const std::string> messages,
+                                          std::span<const typename G1::affine_element> public_keys,
+                                          std::span<const ecdsa_signature> signatures)
+{
+    using serialize::read;
+    using affine_element = typename G1::affine_element;
+    const size_t num_signatures = signatures.size();
+    BB_ASSERT_EQ(messages.size(), num_signatures);
+    BB_ASSERT_EQ(public_keys.size(), num_signatures);
+    const uint256_t mod = uint256_t(Fr::modulus);
+
+    // Recover the nonce R of each signature and compute u1 = z / s, u2 = r / s with one batch inversion of the s
+    // values. A signature that fails the range checks, or whose R cannot be recovered, is left out of the combined
+    // check and goes through ecdsa_verify_signature, which rejects it (or asserts on a high s) as it would on its own
+    std::vector<affine_element> nonces(num_signatures);
+    std::vector<Fr> r_values(num_signatures);
+    std::vector<Fr> s_inverses(num_signatures, Fr::one());
+    std::vector<Fr> z_values(num_signatures);
+    std::vector<uint8_t> batched(num_signatures, 0);
+    parallel_for_heuristic(
+        num_signatures,
+        [&](size_t i) {
+            const ecdsa_signature& sig = signatures[i];
+            if (!public_keys[i].on_curve() || public_keys[i].is_point_at_infinity()) {
+                return;
+            }
+            uint256_t r_uint;
+            uint256_t s_uint;
+            const auto* r_buf = &sig.r[0];
+            const auto* s_buf = &sig.s[0];
+            read(r_buf, r_uint);
+            read(s_buf, s_uint);
+            if (r_uint == 0 || s_uint == 0 || r_uint >= mod || s_uint >= (mod + 1) / 2) {
+                return;
+            }
+
+            // R.x is r for v ∈ {27, 28} and r + |Fr| for v ∈ {29, 30}, and the parity of R.y is the parity of v, as
+            // in ecdsa_recover_public_key
+            uint256_t x_uint = r_uint;
+            if (sig.v == 29 || sig.v == 30) {
+                x_uint += mod;
+            } else if (sig.v != 27 && sig.v != 28) {
+                return;
+            }
+            if (x_uint >= uint256_t(Fq::modulus)) {
+                return;
+            }
+            const Fq x(x_uint);
+            Fq y2 = x.sqr() * x + G1::curve_b;
+            if constexpr (G1::has_a) {
+                y2 += x * G1::curve_a;
+            }
+            auto [is_square, y] = y2.sqrt();
+            if (!is_square) {
+                return;
+            }
+            if (uint256_t(y).get_bit(0) != static_cast<bool>(sig.v & 1)) {
+                y = -y;
+            }
+            nonces[i] = affine_element(x, y);
+
+            std::vector<uint8_t> message_buffer(messages[i].begin(), messages[i].end());
+            auto ev = Hash::hash(message_buffer);
+            z_values[i] = Fr::serialize_from_buffer(&ev[0]);
+            r_values[i] = Fr(r_uint);
+            s_inverses[i] = Fr(s_uint);
+            batched[i] = 1;
+        },
+        thread_heuristics::FF_INVERSION_COST);
+    Fr::batch_invert(s_inverses);
+
+    // ∑ aᵢ⋅(u1ᵢ⋅G + u2ᵢ⋅Pᵢ - Rᵢ) = 0 for random aᵢ implies that every term is zero, except with probability 2⁻¹²⁸.
+    // The G terms are merged into one and the Rᵢ are negated so that their scalars stay 128 bits long, which the MSM
+    // exploits by bucketing the scalars by bit length. A public key may sign many messages of the batch, so the MSM has
+    // to handle repeated points
+    auto& engine = numeric::get_randomness();
+    Fr generator_scalar = Fr::zero();
+    std::vector<affine_element> points;
+    std::vector<Fr> scalars;
+    points.reserve((2 * num_signatures) + 1);
+    scalars.reserve((2 * num_signatures) + 1);
+    for (size_t i = 0; i < num_signatures; ++i) {
+        if (batched[i] == 0) {
+            continue;
+        }
+        const Fr weight(uint256_t::from_uint128(engine.get_random_uint128()));
+        generator_scalar += weight * z_values[i] * s_inverses[i];
+        points.emplace_back(public_keys[i]);
+        scalars.emplace_back(weight * r_values[i] * s_inverses[i]);
+        points.emplace_back(-nonces[i]);
+        scalars.emplace_back(weight);
+    }
+    bool batch_is_valid = false;
+    if (!points.empty()) {
+        points.emplace_back(G1::affine_one);
+        scalars.emplace_back(generator_scalar);
+        using MSM = scalar_multiplication::MSM<typename detail::EcdsaCurve<G1>::type>;
+        const affine_element sum = MSM::msm(points,
+                                            PolynomialSpan<const Fr>(0, scalars),
+                                            /*handle_edge_cases=*/true,
+                                            /*bucket_by_bit_length=*/true);
+        batch_is_valid = sum.is_point_at_infinity();
+    }
+
+    // Fall back to verifying each signature on its own to find out which ones are invalid
+    std::vector<uint8_t> verified(num_signatures, 1);
+    parallel_for_heuristic(
+        num_signatures,
+        [&](size_t i) {
+            if (batched[i] == 0 || !batch_is_valid) {
+                verified[i] = static_cast<uint8_t>(
+                    ecdsa_verify_signature<Hash, Fq, Fr, G1>(messages[i], public_keys[i], signatures[i]));
+            }
+        },
+        thread_heuristics::SM_COST);
+    return { verified.begin(), verified.end() };
+}
 } // namespace bb::crypto
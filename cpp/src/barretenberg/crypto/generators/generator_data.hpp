@@ -9,11 +9,15 @@
 #include "barretenberg/common/container.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/groups/fixed_base_table.hpp"
 #include "barretenberg/ecc/groups/group.hpp"
 #include "barretenberg/ecc/groups/precomputed_generators_grumpkin_impl.hpp"
 #include <array>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <vector>
 
 namespace bb::crypto {
 /**
@@ -51,6 +55,8 @@ template <typename Curve> class generator_data {
     using AffineElement = typename Curve::AffineElement;
     using GeneratorList = std::vector<AffineElement>;
     using GeneratorView = std::span<AffineElement const>;
+    using Table = FixedBaseTable<Group>;
+    using TableList = std::vector<std::shared_ptr<const Table>>;
     static inline constexpr size_t DEFAULT_NUM_GENERATORS = 8;
     static inline constexpr std::string_view DEFAULT_DOMAIN_SEPARATOR = "DEFAULT_DOMAIN_SEPARATOR";
     inline constexpr generator_data() = default;
@@ -106,6 +112,35 @@ template <typename Curve> class generator_data {
         return GeneratorView{ generators.data() + generator_offset, num_generators };
     }
 
+    /**
+     * @brief Get fixed-base tables for the generators returned by `get`, building the missing ones
+     * @details Building a table costs a handful of scalar multiplications and multiplying with it a fraction of one,
+     *          so the tables are built lazily and kept for the lifetime of the `generator_data`.
+     *          Concurrent calls to this method are serialised, but like `get` it must not race with calls to `get`.
+     */
+    [[nodiscard]] TableList get_fixed_base_tables(
+        const size_t num_generators,
+        const size_t generator_offset = 0,
+        const std::string_view domain_separator = DEFAULT_DOMAIN_SEPARATOR) const
+    {
+        std::lock_guard<std::mutex> lock(table_mutex);
+        if (!table_map.has_value()) {
+            table_map = std::map<std::string, TableList>();
+        }
+        TableList& tables = table_map.value()[std::string(domain_separator)];
+        if (num_generators + generator_offset > tables.size()) {
+            const size_t num_existing_tables = tables.size();
+            GeneratorView generators = get(num_generators + generator_offset - num_existing_tables,
+                                           num_existing_tables,
+                                           domain_separator);
+            for (const AffineElement& generator : generators) {
+                tables.emplace_back(std::make_shared<const Table>(generator));
+            }
+        }
+        return TableList(tables.begin() + static_cast<std::ptrdiff_t>(generator_offset),
+                         tables.begin() + static_cast<std::ptrdiff_t>(generator_offset + num_generators));
+    }
+
     // getter method for `default_data`. Object exists as a singleton so we don't need a smart pointer.
     // Don't call `delete` on this pointer.
     static inline generator_data* get_default_generators() { return &default_data; }
@@ -128,6 +163,10 @@ template <typename Curve> class generator_data {
     // We wrap the std::map in a `std::optional` so that we can construct `generator_data` at compile time.
     // This allows us to mark `default_data` as `constinit`, which prevents static initialization ordering fiasco
     mutable std::optional<std::map<std::string, GeneratorList>> generator_map = {};
+
+    // Fixed-base tables of the generators of each domain, guarded by `table_mutex`
+    mutable std::optional<std::map<std::string, TableList>> table_map = {};
+    mutable std::mutex table_mutex;
 };
 
 template <typename Curve> struct GeneratorContext {
@@ -42,4 +42,25 @@ TEST(GeneratorContext, DeriveDefaultGenerators)
     }
 }
 
+TEST(GeneratorContext, FixedBaseTables)
+{
+    using AffineElement = grumpkin::g1::affine_element;
+    generator_data<curve::Grumpkin> data;
+    const std::string domain_separator = "FIXED_BASE_TABLES";
+    const grumpkin::fr scalar = grumpkin::fr::random_element();
+
+    // Build the tables in two steps, with an offset
+    auto first_tables = data.get_fixed_base_tables(2, 1, domain_separator);
+    auto tables = data.get_fixed_base_tables(4, 0, domain_separator);
+    auto generators = data.get(4, 0, domain_separator);
+
+    EXPECT_EQ(first_tables.size(), 2UL);
+    EXPECT_EQ(first_tables[0], tables[1]);
+    EXPECT_EQ(first_tables[1], tables[2]);
+    ASSERT_EQ(tables.size(), generators.size());
+    for (size_t i = 0; i < tables.size(); ++i) {
+        EXPECT_EQ(AffineElement(tables[i]->mul(uint256_t(scalar))), AffineElement(generators[i] * scalar));
+    }
+}
+
 } // namespace bb::crypto
@@ -13,6 +13,10 @@
 
 #include "./hash_types.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #if _MSC_VER
 #include <string.h>
 #define __builtin_memcpy memcpy
@@ -54,29 +58,26 @@ static inline uint64_t load_le(const uint8_t* data)
     return to_le64(word);
 }
 
-static inline void keccak(uint64_t* out, size_t bits, const uint8_t* data, size_t size)
+/** XORs a full block of the message into the state. */
+static inline void absorb_block(uint64_t* state, const uint8_t* data, size_t block_size)
 {
     static const size_t word_size = sizeof(uint64_t);
-    const size_t hash_size = bits / 8;
-    const size_t block_size = (1600 - bits * 2) / 8;
-
     size_t i;
-    uint64_t* state_iter;
-    uint64_t last_word = 0;
-    uint8_t* last_word_iter = (uint8_t*)&last_word;
-
-    uint64_t state[25] = { 0 };
 
-    while (size >= block_size) {
-        for (i = 0; i < (block_size / word_size); ++i) {
-            state[i] ^= load_le(data);
-            data += word_size;
-        }
+    for (i = 0; i < (block_size / word_size); ++i) {
+        state[i] ^= load_le(data);
+        data += word_size;
+    }
+}
 
-        ethash_keccakf1600(state);
+/** XORs the last, incomplete, block of the message into the state, followed by the padding. */
+static inline void absorb_last_block(uint64_t* state, const uint8_t* data, size_t size, size_t block_size)
+{
+    static const size_t word_size = sizeof(uint64_t);
 
-        size -= block_size;
-    }
+    uint64_t* state_iter;
+    uint64_t last_word = 0;
+    uint8_t* last_word_iter = (uint8_t*)&last_word;
 
     state_iter = state;
 
@@ -97,6 +98,28 @@ static inline void keccak(uint64_t* out, size_t bits, const uint8_t* data, size_
     *state_iter ^= to_le64(last_word);
 
     state[(block_size / word_size) - 1] ^= 0x8000000000000000;
+}
+
+static inline void keccak(uint64_t* out, size_t bits, const uint8_t* data, size_t size)
+{
+    static const size_t word_size = sizeof(uint64_t);
+    const size_t hash_size = bits / 8;
+    const size_t block_size = (1600 - bits * 2) / 8;
+
+    size_t i;
+
+    uint64_t state[25] = { 0 };
+
+    while (size >= block_size) {
+        absorb_block(state, data, block_size);
+        data += block_size;
+
+        ethash_keccakf1600(state);
+
+        size -= block_size;
+    }
+
+    absorb_last_block(state, data, size, block_size);
 
     ethash_keccakf1600(state);
 
@@ -111,6 +134,52 @@ struct keccak256 ethash_keccak256(const uint8_t* data, size_t size) NOEXCEPT
     return hash;
 }
 
+void ethash_keccak256_batch(struct keccak256* hashes,
+                            const uint8_t* const* data,
+                            const size_t* sizes,
+                            size_t num_messages) NOEXCEPT
+{
+    static const size_t word_size = sizeof(uint64_t);
+    const size_t hash_size = 256 / 8;
+    const size_t block_size = (1600 - 256 * 2) / 8;
+
+    if (num_messages == 0) {
+        return;
+    }
+
+    /* Every message absorbs its full blocks, then a last one holding the padding. Absorbing the messages with the
+       most blocks first keeps the states still absorbing at the front, so that each batched permutation runs on a
+       prefix of the states and finished states are left alone. */
+    std::vector<size_t> order(num_messages);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sizes[a] > sizes[b]; });
+
+    std::vector<uint64_t> states(num_messages * 25, 0);
+    const size_t max_num_blocks = (sizes[order[0]] / block_size) + 1;
+    size_t num_active = num_messages;
+    for (size_t block = 0; block < max_num_blocks; ++block) {
+        while ((sizes[order[num_active - 1]] / block_size) < block) {
+            --num_active;
+        }
+        for (size_t k = 0; k < num_active; ++k) {
+            const size_t message = order[k];
+            const size_t offset = block * block_size;
+            if (sizes[message] - offset >= block_size) {
+                absorb_block(&states[25 * k], data[message] + offset, block_size);
+            } else {
+                absorb_last_block(&states[25 * k], data[message] + offset, sizes[message] - offset, block_size);
+            }
+        }
+        ethash_keccakf1600_batch(states.data(), num_active);
+    }
+
+    for (size_t k = 0; k < num_messages; ++k) {
+        for (size_t i = 0; i < (hash_size / word_size); ++i) {
+            hashes[order[k]].word64s[i] = to_le64(states[(25 * k) + i]);
+        }
+    }
+}
+
 struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements)
 {
     uint8_t input_buffer[num_elements * 32];
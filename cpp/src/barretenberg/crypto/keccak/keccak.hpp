@@ -38,8 +38,31 @@ extern "C" {
  */
 void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT;
 
+/**
+ * The Keccak-f[1600] function, applied to independent states.
+ *
+ * Groups of 8 and 4 states are permuted together with AVX-512 and AVX2 respectively when the CPU supports them.
+ *
+ * @param states      The num_states consecutive states of 25 64-bit words to permute.
+ * @param num_states  The number of states.
+ */
+void ethash_keccakf1600_batch(uint64_t* states, size_t num_states) NOEXCEPT;
+
 struct keccak256 ethash_keccak256(const uint8_t* data, size_t size) NOEXCEPT;
 
+/**
+ * Keccak-256 of independent messages, absorbing a block of each message per batched permutation.
+ *
+ * @param hashes        The num_messages output hashes.
+ * @param data          The messages.
+ * @param sizes         The sizes of the messages in bytes.
+ * @param num_messages  The number of messages.
+ */
+void ethash_keccak256_batch(struct keccak256* hashes,
+                            const uint8_t* const* data,
+                            const size_t* sizes,
+                            size_t num_messages) NOEXCEPT;
+
 struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements);
 
 struct keccak256 hash_field_element(const uint64_t* limb);
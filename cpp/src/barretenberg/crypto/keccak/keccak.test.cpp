@@ -0,0 +1,60 @@
+#include "keccak.hpp"
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+TEST(Keccak, EmptyMessage)
+{
+    // keccak256("") = c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470
+    keccak256 result = ethash_keccak256(nullptr, 0);
+    EXPECT_EQ(__builtin_bswap64(result.word64s[0]), 0xc5d2460186f7233cULL);
+    EXPECT_EQ(__builtin_bswap64(result.word64s[3]), 0x7bfad8045d85a470ULL);
+}
+
+TEST(Keccak, PermutationBatchMatchesSingle)
+{
+    // Enough states for the 8-way and 4-way batches and a remainder
+    const size_t num_states = 15;
+    std::vector<uint64_t> states(num_states * 25);
+    for (size_t i = 0; i < states.size(); ++i) {
+        states[i] = (i * 0x9e3779b97f4a7c15ULL) ^ (i << 32);
+    }
+    std::vector<uint64_t> expected = states;
+    for (size_t i = 0; i < num_states; ++i) {
+        ethash_keccakf1600(&expected[25 * i]);
+    }
+
+    ethash_keccakf1600_batch(states.data(), num_states);
+
+    EXPECT_EQ(states, expected);
+}
+
+TEST(Keccak, HashBatchMatchesSingle)
+{
+    // Lengths around the 136-byte rate, and enough of each to fill the batches
+    std::vector<std::vector<uint8_t>> messages;
+    for (size_t length : { 0UL, 1UL, 32UL, 64UL, 135UL, 136UL, 137UL, 272UL, 500UL }) {
+        for (size_t i = 0; i < 9; ++i) {
+            std::vector<uint8_t> message(length);
+            for (size_t j = 0; j < length; ++j) {
+                message[j] = static_cast<uint8_t>((messages.size() * 31) + j);
+            }
+            messages.emplace_back(std::move(message));
+        }
+    }
+    std::vector<const uint8_t*> data;
+    std::vector<size_t> sizes;
+    for (const auto& message : messages) {
+        data.emplace_back(message.data());
+        sizes.emplace_back(message.size());
+    }
+
+    std::vector<keccak256> results(messages.size());
+    ethash_keccak256_batch(results.data(), data.data(), sizes.data(), messages.size());
+
+    for (size_t i = 0; i < messages.size(); ++i) {
+        keccak256 expected = ethash_keccak256(messages[i].data(), messages[i].size());
+        EXPECT_EQ(std::memcmp(&results[i], &expected, sizeof(keccak256)), 0);
+    }
+}
@@ -0,0 +1,169 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "keccak.hpp"
+
+#include "barretenberg/common/cpu_features.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+#include <immintrin.h>
+
+namespace {
+
+/* Rotation offsets of the rho step, indexed by x + 5 * y. */
+constexpr unsigned rho_offsets[25] = { 0,  1,  62, 28, 27, 36, 44, 6,  55, 20, 3,  10, 43,
+                                       25, 39, 41, 45, 15, 21, 8,  18, 2,  61, 56, 14 };
+
+constexpr uint64_t round_constants[24] = {
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000, 0x000000000000808b,
+    0x0000000080000001, 0x8000000080008081, 0x8000000000008009, 0x000000000000008a, 0x0000000000000088,
+    0x0000000080008009, 0x000000008000000a, 0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+    0x8000000000008003, 0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+};
+
+/*
+ * The multi-buffer permutations below hold lane i of N states in one vector register, one state per 64-bit element,
+ * and apply the theta, rho, pi, chi and iota steps to all of them at once.
+ */
+
+__attribute__((target("avx2"))) inline __m256i rol_x4(__m256i x, unsigned s)
+{
+    return _mm256_or_si256(_mm256_slli_epi64(x, static_cast<int>(s)), _mm256_srli_epi64(x, static_cast<int>(64 - s)));
+}
+
+/* Keccak-f[1600] on the 4 consecutive states at `states`, with AVX2. */
+__attribute__((target("avx2"))) void keccakf1600_x4(uint64_t* states)
+{
+    __m256i A[25];
+    for (size_t i = 0; i < 25; ++i) {
+        A[i] = _mm256_set_epi64x(static_cast<int64_t>(states[75 + i]),
+                                 static_cast<int64_t>(states[50 + i]),
+                                 static_cast<int64_t>(states[25 + i]),
+                                 static_cast<int64_t>(states[i]));
+    }
+
+    for (size_t round = 0; round < 24; ++round) {
+        __m256i C[5];
+        for (size_t x = 0; x < 5; ++x) {
+            C[x] = _mm256_xor_si256(A[x], A[x + 5]);
+            for (size_t y = 10; y < 25; y += 5) {
+                C[x] = _mm256_xor_si256(C[x], A[y + x]);
+            }
+        }
+        for (size_t x = 0; x < 5; ++x) {
+            const __m256i D = _mm256_xor_si256(C[(x + 4) % 5], rol_x4(C[(x + 1) % 5], 1));
+            for (size_t y = 0; y < 25; y += 5) {
+                A[y + x] = _mm256_xor_si256(A[y + x], D);
+            }
+        }
+
+        __m256i B[25];
+        for (size_t x = 0; x < 5; ++x) {
+            for (size_t y = 0; y < 5; ++y) {
+                B[y + (5 * ((2 * x + 3 * y) % 5))] = rol_x4(A[x + (5 * y)], rho_offsets[x + (5 * y)]);
+            }
+        }
+
+        for (size_t y = 0; y < 25; y += 5) {
+            for (size_t x = 0; x < 5; ++x) {
+                A[y + x] = _mm256_xor_si256(B[y + x], _mm256_andnot_si256(B[y + ((x + 1) % 5)], B[y + ((x + 2) % 5)]));
+            }
+        }
+
+        A[0] = _mm256_xor_si256(A[0], _mm256_set1_epi64x(static_cast<int64_t>(round_constants[round])));
+    }
+
+    alignas(32) uint64_t lanes[4];
+    for (size_t i = 0; i < 25; ++i) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), A[i]);
+        for (size_t j = 0; j < 4; ++j) {
+            states[(25 * j) + i] = lanes[j];
+        }
+    }
+}
+
+/* Keccak-f[1600] on the 8 consecutive states at `states`, with AVX-512. */
+__attribute__((target("avx512f"))) void keccakf1600_x8(uint64_t* states)
+{
+    __m512i A[25];
+    for (size_t i = 0; i < 25; ++i) {
+        A[i] = _mm512_set_epi64(static_cast<int64_t>(states[175 + i]),
+                                static_cast<int64_t>(states[150 + i]),
+                                static_cast<int64_t>(states[125 + i]),
+                                static_cast<int64_t>(states[100 + i]),
+                                static_cast<int64_t>(states[75 + i]),
+                                static_cast<int64_t>(states[50 + i]),
+                                static_cast<int64_t>(states[25 + i]),
+                                static_cast<int64_t>(states[i]));
+    }
+
+    for (size_t round = 0; round < 24; ++round) {
+        __m512i C[5];
+        for (size_t x = 0; x < 5; ++x) {
+            C[x] = _mm512_xor_si512(A[x], A[x + 5]);
+            for (size_t y = 10; y < 25; y += 5) {
+                C[x] = _mm512_xor_si512(C[x], A[y + x]);
+            }
+        }
+        for (size_t x = 0; x < 5; ++x) {
+            const __m512i D = _mm512_xor_si512(C[(x + 4) % 5], _mm512_rol_epi64(C[(x + 1) % 5], 1));
+            for (size_t y = 0; y < 25; y += 5) {
+                A[y + x] = _mm512_xor_si512(A[y + x], D);
+            }
+        }
+
+        __m512i B[25];
+        for (size_t x = 0; x < 5; ++x) {
+            for (size_t y = 0; y < 5; ++y) {
+                B[y + (5 * ((2 * x + 3 * y) % 5))] =
+                    _mm512_rolv_epi64(A[x + (5 * y)], _mm512_set1_epi64(rho_offsets[x + (5 * y)]));
+            }
+        }
+
+        for (size_t y = 0; y < 25; y += 5) {
+            for (size_t x = 0; x < 5; ++x) {
+                A[y + x] = _mm512_xor_si512(B[y + x], _mm512_andnot_si512(B[y + ((x + 1) % 5)], B[y + ((x + 2) % 5)]));
+            }
+        }
+
+        A[0] = _mm512_xor_si512(A[0], _mm512_set1_epi64(static_cast<int64_t>(round_constants[round])));
+    }
+
+    alignas(64) uint64_t lanes[8];
+    for (size_t i = 0; i < 25; ++i) {
+        _mm512_store_si512(lanes, A[i]);
+        for (size_t j = 0; j < 8; ++j) {
+            states[(25 * j) + i] = lanes[j];
+        }
+    }
+}
+
+} // namespace
+#endif
+
+void ethash_keccakf1600_batch(uint64_t* states, size_t num_states) NOEXCEPT
+{
+    size_t i = 0;
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+    const bb::CpuFeatures& features = bb::cpu_features();
+    if (features.avx512f) {
+        for (; i + 8 <= num_states; i += 8) {
+            keccakf1600_x8(states + (25 * i));
+        }
+    }
+    if (features.avx2) {
+        for (; i + 4 <= num_states; i += 4) {
+            keccakf1600_x4(states + (25 * i));
+        }
+    }
+#endif
+    for (; i < num_states; ++i) {
+        ethash_keccakf1600(states + (25 * i));
+    }
+}
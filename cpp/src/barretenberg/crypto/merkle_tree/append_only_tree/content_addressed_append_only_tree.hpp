@@ -11,12 +11,16 @@
 #include <exception>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
 #include <ostream>
 #include <random>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -279,11 +283,40 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                                                           const RequestContext& requestContext,
                                                           ReadTransaction& tx) const;
 
+    /**
+     * @brief Sibling paths of many leaves, read level by level so that the nodes of each level are read in one batch
+     */
+    std::vector<OptionalSiblingPath> get_subtree_sibling_paths_internal(const std::vector<index_t>& leaf_indices,
+                                                                        uint32_t subtree_depth,
+                                                                        const RequestContext& requestContext,
+                                                                        ReadTransaction& tx) const;
+
     std::optional<fr> find_leaf_hash(const index_t& leaf_index,
                                      const RequestContext& requestContext,
                                      ReadTransaction& tx,
                                      bool updateNodesByIndexCache = false) const;
 
+    /**
+     * @brief As find_leaf_hash for many leaves, reading the nodes of each level in one batch
+     */
+    std::vector<std::optional<fr>> find_leaf_hashes(const std::vector<index_t>& leaf_indices,
+                                                    const RequestContext& requestContext,
+                                                    ReadTransaction& tx,
+                                                    bool updateNodesByIndexCache = false) const;
+
+    /**
+     * @brief Reads the nodes with the given hashes, reading each distinct hash once
+     */
+    std::vector<std::optional<NodePayload>> get_nodes_at_level(const std::vector<fr>& hashes,
+                                                               const RequestContext& requestContext,
+                                                               ReadTransaction& tx) const;
+
+    /**
+     * @brief The zero hashes of a tree of the given depth whose empty leaves are zero_leaf
+     * They are only computed the first time they are requested, so that constructing trees (e.g. forks) is cheap
+     */
+    static const std::vector<fr>& get_zero_hashes(uint32_t depth, const fr& zero_leaf);
+
     index_t get_batch_insertion_size(const index_t& treeSize, const index_t& remainingAppendSize);
 
     void add_batch_internal(
@@ -309,17 +342,10 @@ ContentAddressedAppendOnlyTree<Store, HashingPolicy>::ContentAddressedAppendOnly
     // start by reading the meta data from the backing store
     store_->get_meta(meta);
     depth_ = meta.depth;
-    zero_hashes_.resize(depth_ + 1);
 
     // Create the zero hashes for the tree
-    auto current = HashingPolicy::zero_hash();
-    for (size_t i = depth_; i > 0; --i) {
-        // std::cout << "Zero hash at " << i << " : " << current << std::endl;
-        zero_hashes_[i] = current;
-        current = HashingPolicy::hash_pair(current, current);
-    }
-    zero_hashes_[0] = current;
-    // std::cout << "Zero root: " << current << std::endl;
+    zero_hashes_ = get_zero_hashes(depth_, HashingPolicy::zero_hash());
+    auto current = zero_hashes_[0];
 
     max_size_ = numeric::pow64(2, depth_);
     // if root is non-zero it means the tree has already been initialized
@@ -355,6 +381,29 @@ ContentAddressedAppendOnlyTree<Store, HashingPolicy>::ContentAddressedAppendOnly
     }
 }
 
+template <typename Store, typename HashingPolicy>
+const std::vector<fr>& ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_zero_hashes(uint32_t depth,
+                                                                                            const fr& zero_leaf)
+{
+    static std::mutex mutex;
+    // Entries are never removed, so the references handed out stay valid
+    static std::map<std::pair<uint32_t, uint256_t>, std::vector<fr>> zero_hashes;
+
+    std::unique_lock lock(mutex);
+    auto [it, inserted] = zero_hashes.try_emplace({ depth, uint256_t(zero_leaf) });
+    if (inserted) {
+        std::vector<fr>& hashes = it->second;
+        hashes.resize(depth + 1);
+        auto current = zero_leaf;
+        for (size_t i = depth; i > 0; --i) {
+            hashes[i] = current;
+            current = HashingPolicy::hash_pair(current, current);
+        }
+        hashes[0] = current;
+    }
+    return it->second;
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_meta_data(bool includeUncommitted,
                                                                          const MetaDataCallback& on_completion) const
@@ -623,6 +672,128 @@ std::optional<fr> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_lea
     return std::optional<fr>(hash);
 }
 
+template <typename Store, typename HashingPolicy>
+std::vector<std::optional<NodePayload>> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_nodes_at_level(
+    const std::vector<fr>& hashes, const RequestContext& requestContext, ReadTransaction& tx) const
+{
+    // The paths of neighbouring leaves share their upper nodes, only read those once
+    std::unordered_map<fr, size_t> unique_positions;
+    std::vector<fr> unique_hashes;
+    std::vector<size_t> positions(hashes.size());
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        auto [it, inserted] = unique_positions.try_emplace(hashes[i], unique_hashes.size());
+        if (inserted) {
+            unique_hashes.push_back(hashes[i]);
+        }
+        positions[i] = it->second;
+    }
+    std::vector<std::optional<NodePayload>> unique_payloads =
+        store_->get_nodes_by_hash(unique_hashes, tx, requestContext.includeUncommitted);
+
+    std::vector<std::optional<NodePayload>> payloads(hashes.size());
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        payloads[i] = unique_payloads[positions[i]];
+    }
+    return payloads;
+}
+
+template <typename Store, typename HashingPolicy>
+std::vector<std::optional<fr>> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_hashes(
+    const std::vector<index_t>& leaf_indices,
+    const RequestContext& requestContext,
+    ReadTransaction& tx,
+    bool updateNodesByIndexCache) const
+{
+    std::vector<std::optional<fr>> leaf_hashes(leaf_indices.size());
+    // The leaves whose path has been followed down to the current level
+    std::vector<size_t> active(leaf_indices.size());
+    std::iota(active.begin(), active.end(), 0);
+    std::vector<fr> hashes(leaf_indices.size(), requestContext.root);
+    std::vector<index_t> child_indices_at_level(leaf_indices.size(), 0);
+
+    index_t mask = static_cast<index_t>(1) << (depth_ - 1);
+    for (uint32_t i = 0; i < depth_ && !active.empty(); ++i) {
+        std::vector<fr> level_hashes(active.size());
+        for (size_t j = 0; j < active.size(); ++j) {
+            level_hashes[j] = hashes[active[j]];
+        }
+        std::vector<std::optional<NodePayload>> payloads = get_nodes_at_level(level_hashes, requestContext, tx);
+
+        std::vector<size_t> still_active;
+        still_active.reserve(active.size());
+        for (size_t j = 0; j < active.size(); ++j) {
+            const size_t leaf = active[j];
+            if (!payloads[j].has_value()) {
+                continue;
+            }
+            const NodePayload& nodePayload = payloads[j].value();
+            bool is_right = static_cast<bool>(leaf_indices[leaf] & mask);
+            std::optional<fr> child = is_right ? nodePayload.right : nodePayload.left;
+            std::optional<fr> sibling = is_right ? nodePayload.left : nodePayload.right;
+
+            // Populate the cache exactly as find_leaf_hash does, including the sibling of an empty subtree
+            if (updateNodesByIndexCache) {
+                index_t& child_index_at_level = child_indices_at_level[leaf];
+                child_index_at_level = is_right ? (child_index_at_level * 2) + 1 : (child_index_at_level * 2);
+                index_t sibling_index_at_level = is_right ? child_index_at_level - 1 : child_index_at_level + 1;
+                if (child.has_value()) {
+                    store_->put_cached_node_by_index(i + 1, child_index_at_level, child.value(), false);
+                }
+                if (sibling.has_value()) {
+                    store_->put_cached_node_by_index(i + 1, sibling_index_at_level, sibling.value(), false);
+                }
+            }
+            if (!child.has_value()) {
+                continue;
+            }
+            hashes[leaf] = child.value();
+            still_active.push_back(leaf);
+        }
+        active = std::move(still_active);
+        mask >>= 1;
+    }
+
+    // The paths that have not ended early arrived at their leaf
+    for (size_t leaf : active) {
+        leaf_hashes[leaf] = hashes[leaf];
+    }
+    return leaf_hashes;
+}
+
+template <typename Store, typename HashingPolicy>
+std::vector<typename ContentAddressedAppendOnlyTree<Store, HashingPolicy>::OptionalSiblingPath>
+ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_subtree_sibling_paths_internal(
+    const std::vector<index_t>& leaf_indices,
+    uint32_t subtree_depth,
+    const RequestContext& requestContext,
+    ReadTransaction& tx) const
+{
+    std::vector<OptionalSiblingPath> paths(leaf_indices.size());
+    if (subtree_depth >= depth_) {
+        return paths;
+    }
+    const uint32_t path_length = depth_ - subtree_depth;
+    for (auto& path : paths) {
+        path.resize(path_length);
+    }
+
+    std::vector<fr> hashes(leaf_indices.size(), requestContext.root);
+    index_t mask = index_t(1) << (depth_ - 1);
+    for (uint32_t level = 0; level < path_length; ++level) {
+        std::vector<std::optional<NodePayload>> payloads = get_nodes_at_level(hashes, requestContext, tx);
+        for (size_t i = 0; i < leaf_indices.size(); ++i) {
+            NodePayload nodePayload = payloads[i].value_or(NodePayload{});
+            bool is_right = static_cast<bool>(leaf_indices[i] & mask);
+            std::optional<fr> sibling = is_right ? nodePayload.left : nodePayload.right;
+            std::optional<fr> child = is_right ? nodePayload.right : nodePayload.left;
+            hashes[i] = child.has_value() ? child.value() : zero_hashes_[level + 1];
+            paths[i][path_length - 1 - level] = sibling;
+        }
+        mask >>= 1;
+    }
+    return paths;
+}
+
 template <typename Store, typename HashingPolicy>
 ContentAddressedAppendOnlyTree<Store, HashingPolicy>::OptionalSiblingPath ContentAddressedAppendOnlyTree<
     Store,
@@ -880,16 +1051,27 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_sibling_pat
                 requestContext.includeUncommitted = includeUncommitted;
                 requestContext.root = store_->get_current_root(*tx, includeUncommitted);
 
+                std::vector<std::optional<index_t>> leaf_indices;
+                leaf_indices.reserve(leaves.size());
+                std::vector<index_t> found_indices;
                 for (const auto& leaf : leaves) {
-                    std::optional<index_t> leaf_index = store_->find_leaf_index_from(leaf, 0, requestContext, *tx);
+                    leaf_indices.push_back(store_->find_leaf_index_from(leaf, 0, requestContext, *tx));
+                    if (leaf_indices.back().has_value()) {
+                        found_indices.push_back(leaf_indices.back().value());
+                    }
+                }
+                // Walk all of the paths together, reading each level of the tree in one batch
+                std::vector<OptionalSiblingPath> optional_paths =
+                    get_subtree_sibling_paths_internal(found_indices, 0, requestContext, *tx);
+                size_t path_index = 0;
+                for (const auto& leaf_index : leaf_indices) {
                     if (!leaf_index.has_value()) {
                         response.inner.leaf_paths.emplace_back(std::nullopt);
                         continue;
                     }
-                    OptionalSiblingPath optional_path =
-                        get_subtree_sibling_path_internal(leaf_index.value(), 0, requestContext, *tx);
                     SiblingPathAndIndex sibling_path_and_index;
-                    sibling_path_and_index.path = optional_sibling_path_to_full_sibling_path(optional_path);
+                    sibling_path_and_index.path =
+                        optional_sibling_path_to_full_sibling_path(optional_paths[path_index++]);
                     sibling_path_and_index.index = leaf_index.value();
                     response.inner.leaf_paths.emplace_back(sibling_path_and_index);
                 }
@@ -926,16 +1108,27 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_sibling_pat
                 requestContext.maxIndex = blockData.size;
                 requestContext.root = blockData.root;
 
+                std::vector<std::optional<index_t>> leaf_indices;
+                leaf_indices.reserve(leaves.size());
+                std::vector<index_t> found_indices;
                 for (const auto& leaf : leaves) {
-                    std::optional<index_t> leaf_index = store_->find_leaf_index_from(leaf, 0, requestContext, *tx);
+                    leaf_indices.push_back(store_->find_leaf_index_from(leaf, 0, requestContext, *tx));
+                    if (leaf_indices.back().has_value()) {
+                        found_indices.push_back(leaf_indices.back().value());
+                    }
+                }
+                // Walk all of the paths together, reading each level of the tree in one batch
+                std::vector<OptionalSiblingPath> optional_paths =
+                    get_subtree_sibling_paths_internal(found_indices, 0, requestContext, *tx);
+                size_t path_index = 0;
+                for (const auto& leaf_index : leaf_indices) {
                     if (!leaf_index.has_value()) {
                         response.inner.leaf_paths.emplace_back(std::nullopt);
                         continue;
                     }
-                    OptionalSiblingPath optional_path =
-                        get_subtree_sibling_path_internal(leaf_index.value(), 0, requestContext, *tx);
                     SiblingPathAndIndex sibling_path_and_index;
-                    sibling_path_and_index.path = optional_sibling_path_to_full_sibling_path(optional_path);
+                    sibling_path_and_index.path =
+                        optional_sibling_path_to_full_sibling_path(optional_paths[path_index++]);
                     sibling_path_and_index.index = leaf_index.value();
                     response.inner.leaf_paths.emplace_back(sibling_path_and_index);
                 }
@@ -1143,7 +1336,8 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
 
     TreeMeta meta;
     store_->get_meta(meta);
-    index_t index = meta.size;
+    const index_t start_index = meta.size;
+    index_t index = start_index;
     new_size = meta.size + number_to_insert;
 
     // std::cout << "Appending new leaves" << std::endl;
@@ -1195,16 +1389,32 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     }
 
     fr new_hash = hashes_local[0];
-
-    // std::cout << "LEVEL: " << level << " hash " << new_hash << std::endl;
-    RequestContext requestContext;
-    requestContext.includeUncommitted = true;
-    requestContext.root = store_->get_current_root(tx, true);
-    OptionalSiblingPath optional_sibling_path_to_root =
-        get_subtree_sibling_path_internal(meta.size, depth_ - level, requestContext, tx);
+    const uint32_t subtree_level = level;
+
+    // The left siblings of the path from the sub-tree root to the root of the tree are the tree's frontier and its
+    // right siblings are empty. If the frontier is up to date we don't need to read anything from the store.
+    OptionalSiblingPath optional_sibling_path_to_root(subtree_level);
+    if (meta.frontier.is_valid_for(meta.size, meta.root, depth_)) {
+        for (uint32_t i = 0; i < subtree_level; ++i) {
+            const uint32_t sibling_level = subtree_level - i;
+            if (static_cast<bool>((start_index >> (depth_ - sibling_level)) & 0x01)) {
+                optional_sibling_path_to_root[i] = meta.frontier.nodes[sibling_level];
+            }
+        }
+    } else {
+        RequestContext requestContext;
+        requestContext.includeUncommitted = true;
+        requestContext.root = store_->get_current_root(tx, true);
+        optional_sibling_path_to_root =
+            get_subtree_sibling_path_internal(start_index, depth_ - subtree_level, requestContext, tx);
+    }
     fr_sibling_path sibling_path_to_root = optional_sibling_path_to_full_sibling_path(optional_sibling_path_to_root);
     size_t sibling_path_index = 0;
 
+    // The new hashes along the path, indexed by level
+    std::vector<fr> path_hashes(subtree_level + 1);
+    path_hashes[subtree_level] = new_hash;
+
     // Hash from the root of the sub-tree to the root of the overall tree
 
     // std::cout << "Root hash: " << new_hash << std::endl;
@@ -1225,11 +1435,27 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
         index >>= 1;
         --level;
         ++sibling_path_index;
+        path_hashes[level] = new_hash;
         store_->put_cached_node_by_index(level, index, new_hash);
         store_->put_node_by_hash(new_hash, { .left = left_op, .right = right_op, .ref = 1 });
         // std::cout << "Writing node hash " << new_hash << " level " << level << " index " << index << std::endl;
     }
 
+    // The new frontier is made of the nodes on the path that have just been completed and the previous frontier's
+    // nodes that are still left of the next leaf. The batch is aligned on its size so the levels below the sub-tree
+    // root are never part of either.
+    TreeFrontier frontier{ .size = new_size, .root = new_hash, .nodes = std::vector<fr>(depth_ + 1, fr::zero()) };
+    for (uint32_t frontier_level = 0; frontier_level <= subtree_level; ++frontier_level) {
+        const uint32_t height = depth_ - frontier_level;
+        if (!static_cast<bool>((new_size >> height) & 0x01)) {
+            continue;
+        }
+        frontier.nodes[frontier_level] = (new_size >> height) != (start_index >> height)
+                                             ? path_hashes[frontier_level]
+                                             : sibling_path_to_root[subtree_level - frontier_level];
+    }
+    meta.frontier = std::move(frontier);
+
     new_root = new_hash;
     meta.root = new_hash;
     meta.size = new_size;
@@ -946,6 +946,42 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_varying_size_blocks)
     }
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, persists_the_frontier_across_blocks_and_restarts)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    ThreadPoolPtr pool = make_thread_pool(1);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    std::vector<size_t> batchSize = { 3, 8, 20, 1, 64, 32, 7 };
+    index_t expected_size = 0;
+
+    for (uint32_t i = 0; i < batchSize.size(); i++) {
+        // Re-open the tree for every block so that appends start from the persisted meta data
+        std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+        TreeMeta meta;
+        store->get_meta(meta);
+        EXPECT_EQ(meta.frontier.is_valid_for(meta.size, meta.root, depth), i > 0);
+        TreeType tree(std::move(store), pool);
+
+        std::vector<fr> to_add;
+        for (size_t j = 0; j < batchSize[i]; ++j) {
+            size_t ind = expected_size + j;
+            memdb.update_element(ind, get_value(ind));
+            to_add.push_back(get_value(ind));
+        }
+        expected_size += batchSize[i];
+        add_values(tree, to_add);
+        commit_tree(tree);
+        check_size(tree, expected_size);
+        check_root(tree, memdb.root());
+        check_sibling_path(tree, 0, memdb.get_sibling_path(0));
+        check_sibling_path(tree, expected_size - 1, memdb.get_sibling_path(expected_size - 1));
+        check_sibling_path(tree, expected_size, memdb.get_sibling_path(expected_size));
+    }
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_retrieve_historic_sibling_paths)
 {
     constexpr size_t depth = 10;
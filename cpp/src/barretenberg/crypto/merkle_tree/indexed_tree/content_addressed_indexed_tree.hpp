@@ -225,6 +225,17 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
     };
 
     using InsertionGenerationCallback = std::function<void(const TypedResponse<InsertionGenerationResponse>&)>;
+
+    /**
+     * @brief Reads the pre-images of the low leaves of the given values before they are inserted one by one
+     * The paths to the low leaves are walked level by level and each level, then the pre-images, are read in one
+     * batch. Returns the pre-images by leaf index, for the low leaves not already in the cache.
+     */
+    std::unordered_map<index_t, IndexedLeafValueType> prefetch_low_leaves(
+        const std::vector<std::pair<LeafValueType, index_t>>& values,
+        RequestContext& requestContext,
+        ReadTransaction& tx);
+
     void generate_insertions(const std::shared_ptr<std::vector<std::pair<LeafValueType, index_t>>>& values_to_be_sorted,
                              const InsertionGenerationCallback& completion);
 
@@ -270,6 +281,7 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_values;
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_values_internal;
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_hash;
+    using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_hashes;
 
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::store_;
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::zero_hashes_;
@@ -292,15 +304,8 @@ ContentAddressedIndexedTree<Store, HashingPolicy>::ContentAddressedIndexedTree(
     if (prefilled_values.size() > initial_size) {
         throw std::runtime_error("Number of prefilled values can't be more than initial size");
     }
-    zero_hashes_.resize(depth_ + 1);
-
     // Create the zero hashes for the tree
-    auto current = fr::zero();
-    for (uint32_t i = depth_; i > 0; --i) {
-        zero_hashes_[i] = current;
-        current = HashingPolicy::hash_pair(current, current);
-    }
-    zero_hashes_[0] = current;
+    zero_hashes_ = this->get_zero_hashes(depth_, fr::zero());
 
     TreeMeta meta;
     store_->get_meta(meta);
@@ -908,6 +913,49 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_hashes_for_appe
         completion);
 }
 
+template <typename Store, typename HashingPolicy>
+std::unordered_map<index_t, typename ContentAddressedIndexedTree<Store, HashingPolicy>::IndexedLeafValueType>
+ContentAddressedIndexedTree<Store, HashingPolicy>::prefetch_low_leaves(
+    const std::vector<std::pair<LeafValueType, index_t>>& values,
+    RequestContext& requestContext,
+    ReadTransaction& tx)
+{
+    requestContext.root = store_->get_current_root(tx, true);
+    std::vector<index_t> low_leaf_indices;
+    low_leaf_indices.reserve(values.size());
+    for (const auto& value_pair : values) {
+        if (value_pair.first.is_empty()) {
+            continue;
+        }
+        index_t low_leaf_index = store_->find_low_value(value_pair.first.get_key(), requestContext, tx).second;
+        if (!store_->get_cached_leaf_by_index(low_leaf_index).has_value()) {
+            low_leaf_indices.push_back(low_leaf_index);
+        }
+    }
+    std::sort(low_leaf_indices.begin(), low_leaf_indices.end());
+    low_leaf_indices.erase(std::unique(low_leaf_indices.begin(), low_leaf_indices.end()), low_leaf_indices.end());
+
+    // Populates the nodes by index cache as the per leaf lookup would have done
+    std::vector<std::optional<fr>> leaf_hashes = find_leaf_hashes(low_leaf_indices, requestContext, tx, true);
+    std::vector<index_t> found_indices;
+    std::vector<fr> found_hashes;
+    for (size_t i = 0; i < low_leaf_indices.size(); ++i) {
+        if (leaf_hashes[i].has_value()) {
+            found_indices.push_back(low_leaf_indices[i]);
+            found_hashes.push_back(leaf_hashes[i].value());
+        }
+    }
+    std::vector<std::optional<IndexedLeafValueType>> leaves = store_->get_leaves_by_hash(found_hashes, tx, true);
+
+    std::unordered_map<index_t, IndexedLeafValueType> prefetched;
+    for (size_t i = 0; i < found_indices.size(); ++i) {
+        if (leaves[i].has_value()) {
+            prefetched.emplace(found_indices[i], leaves[i].value());
+        }
+    }
+    return prefetched;
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_insertions(
     const std::shared_ptr<std::vector<std::pair<LeafValueType, index_t>>>& values_to_be_sorted,
@@ -957,6 +1005,12 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_insertions(
                                                     " max size: ",
                                                     max_size_));
                 }
+
+                // Nothing below changes the root, so the low leaves read up front stay valid for as long as they are
+                // not updated in the cache
+                std::unordered_map<index_t, IndexedLeafValueType> prefetched_low_leaves =
+                    prefetch_low_leaves(values, requestContext, *tx);
+
                 for (size_t i = 0; i < values.size(); ++i) {
                     std::pair<LeafValueType, index_t>& value_pair = values[i];
                     index_t index_into_appended_leaves = value_pair.second;
@@ -986,10 +1040,14 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_insertions(
                         store_->get_cached_leaf_by_index(low_leaf_index);
                     IndexedLeafValueType low_leaf;
 
+                    auto prefetched_low_leaf = prefetched_low_leaves.find(low_leaf_index);
+
                     if (optional_low_leaf.has_value()) {
                         low_leaf = optional_low_leaf.value();
                         // std::cout << "Found cached low leaf at index: " << low_leaf_index << " : " << low_leaf
                         //           << std::endl;
+                    } else if (prefetched_low_leaf != prefetched_low_leaves.end()) {
+                        low_leaf = prefetched_low_leaf->second;
                     } else {
                         // std::cout << "Looking for leaf at index " << low_leaf_index << std::endl;
                         std::optional<fr> low_leaf_hash = find_leaf_hash(low_leaf_index, requestContext, *tx, true);
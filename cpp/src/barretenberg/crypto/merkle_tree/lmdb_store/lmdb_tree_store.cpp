@@ -324,6 +324,23 @@ bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTra
     return success;
 }
 
+void LMDBTreeStore::read_nodes(const std::vector<fr>& nodeHashes,
+                               std::vector<std::optional<NodePayload>>& nodeData,
+                               ReadTransaction& tx)
+{
+    std::vector<FrKeyType> keys(nodeHashes.begin(), nodeHashes.end());
+    std::vector<std::optional<std::vector<uint8_t>>> data;
+    tx.get_values<FrKeyType>(keys, data, *_nodeDatabase);
+    nodeData.assign(nodeHashes.size(), std::nullopt);
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (data[i].has_value()) {
+            NodePayload payload;
+            msgpack::unpack((const char*)data[i]->data(), data[i]->size()).get().convert(payload);
+            nodeData[i] = payload;
+        }
+    }
+}
+
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
     msgpack::sbuffer buffer;
@@ -208,6 +208,14 @@ class LMDBTreeStore : public LMDBStoreBase {
 
     bool read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx);
 
+    /**
+     * @brief Reads many nodes in a single pass over the node database, see lmdb_queries::get_values
+     * nodeData[i] is the node with hash nodeHashes[i], std::nullopt if it is not present
+     */
+    void read_nodes(const std::vector<fr>& nodeHashes,
+                    std::vector<std::optional<NodePayload>>& nodeData,
+                    ReadTransaction& tx);
+
     void write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx);
 
     void increment_node_reference_count(const fr& nodeHash, WriteTransaction& tx);
@@ -219,6 +227,14 @@ class LMDBTreeStore : public LMDBStoreBase {
     template <typename LeafType, typename TxType>
     bool read_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx);
 
+    /**
+     * @brief Reads many leaf pre-images in a single pass over the pre-image database, see lmdb_queries::get_values
+     */
+    template <typename LeafType, typename TxType>
+    void read_leaves_by_hash(const std::vector<fr>& leafHashes,
+                             std::vector<std::optional<LeafType>>& leafData,
+                             TxType& tx);
+
     template <typename LeafType>
     void write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx);
 
@@ -267,6 +283,24 @@ bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, Tx
     return success;
 }
 
+template <typename LeafType, typename TxType>
+void LMDBTreeStore::read_leaves_by_hash(const std::vector<fr>& leafHashes,
+                                        std::vector<std::optional<LeafType>>& leafData,
+                                        TxType& tx)
+{
+    std::vector<FrKeyType> keys(leafHashes.begin(), leafHashes.end());
+    std::vector<std::optional<std::vector<uint8_t>>> data;
+    tx.template get_values<FrKeyType>(keys, data, *_leafHashToPreImageDatabase);
+    leafData.assign(leafHashes.size(), std::nullopt);
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (data[i].has_value()) {
+            LeafType leaf;
+            msgpack::unpack((const char*)data[i]->data(), data[i]->size()).get().convert(leaf);
+            leafData[i] = leaf;
+        }
+    }
+}
+
 template <typename LeafType>
 void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx)
 {
@@ -300,6 +300,60 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
     }
 }
 
+TEST_F(LMDBTreeStoreTest, can_read_nodes_and_leaves_in_a_batch)
+{
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    std::vector<bb::fr> hashes;
+    std::vector<NodePayload> nodes;
+    std::vector<PublicDataLeafValue> leaves;
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        for (uint32_t i = 0; i < 20; i++) {
+            hashes.push_back(bb::fr::random_element());
+            nodes.push_back(NodePayload{ .left = get_value(i), .right = get_value(i + 1), .ref = i + 1 });
+            leaves.emplace_back(get_value(i), get_value(i + 2));
+            store.write_node(hashes[i], nodes[i], *transaction);
+            store.write_leaf_by_hash(hashes[i], leaves[i], *transaction);
+        }
+        transaction->commit();
+    }
+
+    // Request the hashes out of order, with duplicates and with hashes that are not present
+    std::vector<bb::fr> requested;
+    std::vector<std::optional<size_t>> expected;
+    for (size_t i = 0; i < hashes.size(); i++) {
+        size_t index = (i * 7) % hashes.size();
+        requested.push_back(hashes[index]);
+        expected.emplace_back(index);
+        if (i % 5 == 0) {
+            requested.push_back(bb::fr::random_element());
+            expected.emplace_back(std::nullopt);
+            requested.push_back(hashes[index]);
+            expected.emplace_back(index);
+        }
+    }
+
+    {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        std::vector<std::optional<NodePayload>> readNodes;
+        store.read_nodes(requested, readNodes, *transaction);
+        std::vector<std::optional<PublicDataLeafValue>> readLeaves;
+        store.read_leaves_by_hash(requested, readLeaves, *transaction);
+
+        ASSERT_EQ(readNodes.size(), requested.size());
+        ASSERT_EQ(readLeaves.size(), requested.size());
+        for (size_t i = 0; i < requested.size(); i++) {
+            if (!expected[i].has_value()) {
+                EXPECT_FALSE(readNodes[i].has_value());
+                EXPECT_FALSE(readLeaves[i].has_value());
+                continue;
+            }
+            EXPECT_EQ(readNodes[i], nodes[expected[i].value()]);
+            EXPECT_EQ(readLeaves[i], leaves[expected[i].value()]);
+        }
+    }
+}
+
 TEST_F(LMDBTreeStoreTest, can_write_and_retrieve_block_numbers_by_index)
 {
     struct BlockAndIndex {
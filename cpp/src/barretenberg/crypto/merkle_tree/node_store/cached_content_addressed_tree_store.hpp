@@ -23,6 +23,7 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
@@ -32,6 +33,16 @@
 
 namespace bb::crypto::merkle_tree {
 
+/**
+ * @brief The state of a store initialized from a block, before anything has been written to it
+ * Everything read from the persisted store when a fork is created, so that further forks from the same block can be
+ * created without reading it again.
+ */
+struct ForkSnapshot {
+    TreeMeta meta;
+    BlockPayload block;
+};
+
 /**
  * @brief Serves as a key-value node store for merkle trees. Caches all changes in memory before persisting them during
  * a 'commit' operation.
@@ -56,6 +67,7 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
                                     uint32_t levels,
                                     const block_number_t& referenceBlockNumber,
                                     PersistedStoreType::SharedPtr dataStore);
+    ContentAddressedCachedTreeStore(const ForkSnapshot& snapshot, PersistedStoreType::SharedPtr dataStore);
     ~ContentAddressedCachedTreeStore() = default;
 
     ContentAddressedCachedTreeStore() = delete;
@@ -101,6 +113,13 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
                           ReadTransaction& transaction,
                           bool includeUncommitted) const;
 
+    /**
+     * @brief Returns the nodes with the given hashes, the ones not in uncommitted state are read in a single batch
+     */
+    std::vector<std::optional<NodePayload>> get_nodes_by_hash(const std::vector<fr>& nodeHashes,
+                                                              ReadTransaction& transaction,
+                                                              bool includeUncommitted) const;
+
     /**
      * @brief Writes the provided data at the given node coordinates. Only writes to uncommitted data.
      */
@@ -166,6 +185,12 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
      */
     std::string get_name() const { return forkConstantData_.name_; }
 
+    /**
+     * @brief Returns the state this store was initialized with if it was initialized from a block
+     * Only meaningful until something has been written to the store.
+     */
+    std::optional<ForkSnapshot> get_fork_snapshot() const;
+
     /**
      * @brief Returns a read transaction against the underlying store.
      */
@@ -175,6 +200,10 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
                                                          ReadTransaction& tx,
                                                          bool includeUncommitted) const;
 
+    std::vector<std::optional<IndexedLeafValueType>> get_leaves_by_hash(const std::vector<fr>& leaf_hashes,
+                                                                        ReadTransaction& tx,
+                                                                        bool includeUncommitted) const;
+
     void put_leaf_by_hash(const fr& leaf_hash, const IndexedLeafValueType& leafPreImage);
 
     std::optional<IndexedLeafValueType> get_cached_leaf_by_index(const index_t& index) const;
@@ -272,6 +301,31 @@ ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
     initialize_from_block(referenceBlockNumber);
 }
 
+template <typename LeafValueType>
+ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
+    const ForkSnapshot& snapshot, PersistedStoreType::SharedPtr dataStore)
+    : forkConstantData_{ .name_ = snapshot.meta.name,
+                         .depth_ = snapshot.meta.depth,
+                         .initialized_from_block_ = snapshot.block }
+    , dataStore_(dataStore)
+    , cache_(snapshot.meta.depth)
+{
+    // The snapshot was taken from a store initialized from the same block, so it has already been validated and
+    // enriched from the fork constant data
+    cache_.put_meta(snapshot.meta);
+}
+
+template <typename LeafValueType>
+std::optional<ForkSnapshot> ContentAddressedCachedTreeStore<LeafValueType>::get_fork_snapshot() const
+{
+    if (!forkConstantData_.initialized_from_block_.has_value()) {
+        return std::nullopt;
+    }
+    // Accessing the cache under a lock
+    std::unique_lock lock(mtx_);
+    return ForkSnapshot{ .meta = cache_.get_meta(), .block = forkConstantData_.initialized_from_block_.value() };
+}
+
 // Much Like the commit/rollback/set finalized/remove historic blocks apis
 // These 3 apis (checkpoint/revert_checkpoint/commit_checkpoint) all assume they are not called
 // during the process of reading/writing uncommitted state
@@ -407,6 +461,45 @@ ContentAddressedCachedTreeStore<LeafValueType>::get_leaf_by_hash(const fr& leaf_
     return std::nullopt;
 }
 
+template <typename LeafValueType>
+std::vector<std::optional<typename ContentAddressedCachedTreeStore<LeafValueType>::IndexedLeafValueType>>
+ContentAddressedCachedTreeStore<LeafValueType>::get_leaves_by_hash(const std::vector<fr>& leaf_hashes,
+                                                                   ReadTransaction& tx,
+                                                                   bool includeUncommitted) const
+{
+    std::vector<std::optional<IndexedLeafValueType>> leaves(leaf_hashes.size());
+    std::vector<size_t> missing;
+    if (includeUncommitted) {
+        // Accessing the cache here under a lock
+        std::unique_lock lock(mtx_);
+        for (size_t i = 0; i < leaf_hashes.size(); ++i) {
+            IndexedLeafValueType leafData;
+            if (cache_.get_leaf_preimage_by_hash(leaf_hashes[i], leafData)) {
+                leaves[i] = leafData;
+            } else {
+                missing.push_back(i);
+            }
+        }
+    } else {
+        missing.resize(leaf_hashes.size());
+        std::iota(missing.begin(), missing.end(), 0);
+    }
+    if (missing.empty()) {
+        return leaves;
+    }
+
+    std::vector<fr> missing_hashes(missing.size());
+    for (size_t i = 0; i < missing.size(); ++i) {
+        missing_hashes[i] = leaf_hashes[missing[i]];
+    }
+    std::vector<std::optional<IndexedLeafValueType>> persisted;
+    dataStore_->read_leaves_by_hash(missing_hashes, persisted, tx);
+    for (size_t i = 0; i < missing.size(); ++i) {
+        leaves[missing[i]] = std::move(persisted[i]);
+    }
+    return leaves;
+}
+
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::put_leaf_by_hash(const fr& leaf_hash,
                                                                       const IndexedLeafValueType& leafPreImage)
@@ -527,6 +620,43 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr&
     return dataStore_->read_node(nodeHash, payload, transaction);
 }
 
+template <typename LeafValueType>
+std::vector<std::optional<NodePayload>> ContentAddressedCachedTreeStore<LeafValueType>::get_nodes_by_hash(
+    const std::vector<fr>& nodeHashes, ReadTransaction& transaction, bool includeUncommitted) const
+{
+    std::vector<std::optional<NodePayload>> payloads(nodeHashes.size());
+    std::vector<size_t> missing;
+    if (includeUncommitted) {
+        // Accessing nodes_ under a lock
+        std::unique_lock lock(mtx_);
+        for (size_t i = 0; i < nodeHashes.size(); ++i) {
+            NodePayload payload;
+            if (cache_.get_node(nodeHashes[i], payload)) {
+                payloads[i] = payload;
+            } else {
+                missing.push_back(i);
+            }
+        }
+    } else {
+        missing.resize(nodeHashes.size());
+        std::iota(missing.begin(), missing.end(), 0);
+    }
+    if (missing.empty()) {
+        return payloads;
+    }
+
+    std::vector<fr> missing_hashes(missing.size());
+    for (size_t i = 0; i < missing.size(); ++i) {
+        missing_hashes[i] = nodeHashes[missing[i]];
+    }
+    std::vector<std::optional<NodePayload>> persisted;
+    dataStore_->read_nodes(missing_hashes, persisted, transaction);
+    for (size_t i = 0; i < missing.size(); ++i) {
+        payloads[missing[i]] = std::move(persisted[i]);
+    }
+    return payloads;
+}
+
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::put_cached_node_by_index(uint32_t level,
                                                                               const index_t& index,
@@ -12,9 +12,33 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace bb::crypto::merkle_tree {
 
+/**
+ * @brief The roots of the complete subtrees to the left of the next leaf of an append-only tree
+ *
+ * When (size >> (depth - level)) is odd, nodes[level] is the node at that level (0 being the root) with the index just
+ * before it, i.e. the left sibling at that level of the path to the next leaf. Otherwise that sibling is empty and
+ * nodes[level] is zero. The frontier is only valid while the tree has the given size and root, so it is never used once
+ * the tree has been modified in any other way (e.g. leaves updated or blocks unwound).
+ */
+struct TreeFrontier {
+    index_t size = 0;
+    bb::fr root = bb::fr::zero();
+    std::vector<bb::fr> nodes;
+
+    MSGPACK_FIELDS(size, root, nodes)
+
+    bool is_valid_for(const index_t& treeSize, const bb::fr& treeRoot, uint32_t depth) const
+    {
+        return nodes.size() == depth + 1 && size == treeSize && root == treeRoot;
+    }
+
+    bool operator==(const TreeFrontier& other) const = default;
+};
+
 struct TreeMeta {
     std::string name;
     uint32_t depth;
@@ -26,6 +50,8 @@ struct TreeMeta {
     block_number_t oldestHistoricBlock;
     block_number_t unfinalizedBlockHeight;
     block_number_t finalizedBlockHeight;
+    // Not part of the state of the tree, only a cache making appends cheaper, so it isn't compared
+    TreeFrontier frontier;
 
     MSGPACK_FIELDS(name,
                    depth,
@@ -36,7 +62,8 @@ struct TreeMeta {
                    initialRoot,
                    oldestHistoricBlock,
                    unfinalizedBlockHeight,
-                   finalizedBlockHeight)
+                   finalizedBlockHeight,
+                   frontier)
 
     TreeMeta(std::string n,
              uint32_t d,
@@ -47,7 +74,8 @@ struct TreeMeta {
              const bb::fr& ir,
              const block_number_t& o,
              const block_number_t& u,
-             const block_number_t& f)
+             const block_number_t& f,
+             TreeFrontier t = {})
         : name(std::move(n))
         , depth(d)
         , size(s)
@@ -58,6 +86,7 @@ struct TreeMeta {
         , oldestHistoricBlock(o)
         , unfinalizedBlockHeight(u)
         , finalizedBlockHeight(f)
+        , frontier(std::move(t))
     {}
     TreeMeta() = default;
     ~TreeMeta() = default;
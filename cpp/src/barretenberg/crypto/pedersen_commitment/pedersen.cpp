@@ -16,6 +16,7 @@ namespace bb::crypto {
  *
  * @details This method uses `Curve::BaseField` members as inputs. This aligns with what we expect when creating
  * grumpkin commitments to field elements inside a BN254 SNARK circuit.
+ * The generators are fixed, so each one is multiplied using its fixed-base table, cached in `context.generators`.
  * @param inputs
  * @param context
  * @return Curve::AffineElement
@@ -24,11 +25,12 @@ template <typename Curve>
 typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(const std::vector<Fq>& inputs,
                                                                              const GeneratorContext context)
 {
-    const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
+    const auto tables =
+        context.generators->get_fixed_base_tables(inputs.size(), context.offset, context.domain_separator);
     Element result = Group::point_at_infinity;
 
     for (size_t i = 0; i < inputs.size(); ++i) {
-        result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+        result += tables[i]->mul(static_cast<uint256_t>(inputs[i]));
     }
     return result.normalize();
 }
@@ -77,7 +77,8 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash(const std::vector<Fq>& inputs, const GeneratorContext context)
 {
-    Element result = length_generator * Fr(inputs.size());
+    static const FixedBaseTable<Group> length_table(length_generator);
+    Element result = length_table.mul(uint256_t(inputs.size()));
     return (result + pedersen_commitment_base<Curve>::commit_native(inputs, context)).normalize().x;
 }
 
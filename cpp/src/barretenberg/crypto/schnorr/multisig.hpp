@@ -320,13 +320,13 @@ template <typename G1, typename HashRegNon, typename HashSig = Blake2sHasher> cl
         // TODO: securely erase `r_user`
         Fr r_user = Fr::random_element();
         // R_user ← r_user⋅G
-        affine_element R_user = G1::one * r_user;
+        affine_element R_user = FixedBaseTable<G1>::generator().mul(uint256_t(r_user));
 
         // s_user ← 𝔽
         // TODO: securely erase `s_user`
         Fr s_user = Fr::random_element();
         // S_user ← s_user⋅G
-        affine_element S_user = G1::one * s_user;
+        affine_element S_user = FixedBaseTable<G1>::generator().mul(uint256_t(s_user));
 
         RoundOnePublicOutput pubOut{ R_user, S_user };
         RoundOnePrivateOutput privOut{ r_user, s_user };
@@ -57,7 +57,7 @@ template <typename G1, typename Hash> struct SchnorrProofOfPossession {
         // TODO: securely erase `k`
         Fr k = Fr::random_element();
 
-        affine_element R = G1::one * k;
+        affine_element R = FixedBaseTable<G1>::generator().mul(uint256_t(k));
 
         auto challenge_bytes = generate_challenge(public_key, R);
         std::copy(challenge_bytes.begin(), challenge_bytes.end(), challenge.begin());
@@ -83,7 +83,8 @@ template <typename G1, typename Hash> struct SchnorrProofOfPossession {
             return false;
 
         // R = e•pk + z•G
-        affine_element R = element(public_key) * challenge_fr + G1::one * response;
+        affine_element R =
+            element(public_key) * challenge_fr + FixedBaseTable<G1>::generator().mul(uint256_t(response));
         if (R.is_point_at_infinity())
             return false;
 
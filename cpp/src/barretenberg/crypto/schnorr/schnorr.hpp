@@ -8,9 +8,12 @@
 
 #include <array>
 #include <memory.h>
+#include <span>
 #include <string>
+#include <vector>
 
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/groups/fixed_base_table.hpp"
 
 #include "barretenberg/crypto/hashers/hashers.hpp"
 
@@ -45,6 +48,18 @@ bool schnorr_verify_signature(const std::string& message,
                               const typename G1::affine_element& public_key,
                               const schnorr_signature& sig);
 
+/**
+ * @brief Verify a batch of signatures, returning the validity of each one as schnorr_verify_signature would
+ *
+ * @details Our signatures carry the challenge e instead of the nonce R, and R is needed to recompute e, so the
+ * signatures cannot be folded into a single randomised check. The batch instead normalizes all the Rᵢ = s⋅G + e⋅Pᵢ
+ * with one inversion and spreads the scalar multiplications and hashes across threads.
+ */
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> schnorr_verify_signatures(std::span<const std::string> messages,
+                                            std::span<const typename G1::affine_element> public_keys,
+                                            std::span<const schnorr_signature> signatures);
+
 template <typename Hash, typename Fq, typename Fr, typename G1>
 schnorr_signature schnorr_construct_signature(const std::string& message, const schnorr_key_pair<Fr, G1>& account);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/hmac/hmac.hpp"
 #include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
 
@@ -91,7 +92,7 @@ schnorr_signature schnorr_construct_signature(const std::string& message, const
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/895): securely erase `k`
     Fr k = Fr::random_element();
 
-    typename G1::affine_element R(G1::one * k);
+    typename G1::affine_element R(FixedBaseTable<G1>::generator().mul(uint256_t(k)));
 
     auto e_raw = schnorr_generate_challenge<Hash, G1>(message, public_key, R);
     // the conversion from e_raw results in a biased field element e
@@ -140,7 +141,7 @@ bool schnorr_verify_signature(const std::string& message,
     }
 
     // R = g^{sig.s} • pub^{sig.e}
-    affine_element R(element(public_key) * e + G1::one * s);
+    affine_element R(element(public_key) * e + FixedBaseTable<G1>::generator().mul(uint256_t(s)));
     if (R.is_point_at_infinity()) {
         // this result implies k == 0, which would be catastrophic for the prover.
         // it is a cheap check that ensures this doesn't happen.
@@ -153,4 +154,50 @@ bool schnorr_verify_signature(const std::string& message,
     auto target_e = schnorr_generate_challenge<Hash, G1>(message, public_key, R);
     return std::equal(sig.e.begin(), sig.e.end(), target_e.begin(), target_e.end());
 }
+
+template <typename Hash, typename Fq, typename Fr, typename G1>
+std::vector<bool> schnorr_verify_signatures(std::span<const std::string> messages,
+                                            std::span<const typename G1::affine_element> public_keys,
+                                            std::span<const schnorr_signature> signatures)
+{
+    using affine_element = typename G1::affine_element;
+    using element = typename G1::element;
+    const size_t num_signatures = signatures.size();
+    BB_ASSERT_EQ(messages.size(), num_signatures);
+    BB_ASSERT_EQ(public_keys.size(), num_signatures);
+
+    // R = g^{sig.s} • pub^{sig.e}, left at infinity for the signatures schnorr_verify_signature rejects up front
+    std::vector<element> nonces(num_signatures, G1::point_at_infinity);
+    parallel_for_heuristic(
+        num_signatures,
+        [&](size_t i) {
+            const affine_element& public_key = public_keys[i];
+            if (!public_key.on_curve() || public_key.is_point_at_infinity()) {
+                return;
+            }
+            Fr e = Fr::serialize_from_buffer(&signatures[i].e[0]);
+            Fr s = Fr::serialize_from_buffer(&signatures[i].s[0]);
+            if (s == 0 || e == 0) {
+                return;
+            }
+            nonces[i] = element(public_key) * e + FixedBaseTable<G1>::generator().mul(uint256_t(s));
+        },
+        thread_heuristics::SM_COST);
+    element::batch_normalize(nonces.data(), num_signatures);
+
+    std::vector<uint8_t> verified(num_signatures, 0);
+    parallel_for_heuristic(
+        num_signatures,
+        [&](size_t i) {
+            if (nonces[i].is_point_at_infinity()) {
+                return;
+            }
+            affine_element R(nonces[i].x, nonces[i].y);
+            auto target_e = schnorr_generate_challenge<Hash, G1>(messages[i], public_keys[i], R);
+            const auto& e = signatures[i].e;
+            verified[i] = static_cast<uint8_t>(std::equal(e.begin(), e.end(), target_e.begin(), target_e.end()));
+        },
+        thread_heuristics::SM_COST);
+    return { verified.begin(), verified.end() };
+}
 } // namespace bb::crypto
@@ -137,3 +137,32 @@ TEST(schnorr, hmac_signature_consistency)
         message_b, account_b.public_key, signature_h);
     EXPECT_EQ(res, true);
 }
+
+TEST(schnorr, verify_signatures_batch)
+{
+    constexpr size_t num_signatures = 10;
+    std::vector<std::string> messages;
+    std::vector<grumpkin::g1::affine_element> public_keys;
+    std::vector<schnorr_signature> signatures;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        auto account = generate_signature();
+        messages.emplace_back("message " + std::to_string(i));
+        public_keys.emplace_back(account.public_key);
+        signatures.emplace_back(schnorr_construct_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+            messages.back(), account));
+    }
+    messages[2] = "another message";
+    public_keys[4] = public_keys[5];
+    signatures[6].s = {};
+    public_keys[8] = grumpkin::g1::affine_point_at_infinity;
+
+    std::vector<bool> expected;
+    for (size_t i = 0; i < num_signatures; ++i) {
+        expected.push_back(schnorr_verify_signature<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+            messages[i], public_keys[i], signatures[i]));
+    }
+    EXPECT_EQ(std::count(expected.begin(), expected.end(), false), 4);
+    EXPECT_EQ((schnorr_verify_signatures<Blake2sHasher, grumpkin::fq, grumpkin::fr, grumpkin::g1>(
+                  messages, public_keys, signatures)),
+              expected);
+}
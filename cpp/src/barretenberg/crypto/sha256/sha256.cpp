@@ -6,9 +6,16 @@
 
 #include "./sha256.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/cpu_features.hpp"
 #include "barretenberg/common/net.hpp"
+#include <algorithm>
 #include <array>
 #include <memory.h>
+#include <numeric>
+
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+#include <immintrin.h>
+#endif
 
 namespace {
 constexpr uint32_t init_constants[8]{ 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
@@ -33,19 +40,9 @@ constexpr uint32_t ror(uint32_t val, uint32_t shift)
 } // namespace
 
 namespace bb::crypto {
-void prepare_constants(std::array<uint32_t, 8>& input)
-{
-    input[0] = init_constants[0];
-    input[1] = init_constants[1];
-    input[2] = init_constants[2];
-    input[3] = init_constants[3];
-    input[4] = init_constants[4];
-    input[5] = init_constants[5];
-    input[6] = init_constants[6];
-    input[7] = init_constants[7];
-}
 
-std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, const std::array<uint32_t, 16>& input)
+std::array<uint32_t, 8> sha256_block_portable(const std::array<uint32_t, 8>& h_init,
+                                              const std::array<uint32_t, 16>& input)
 {
     std::array<uint32_t, 64> w;
 
@@ -113,33 +110,176 @@ std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, cons
     return output;
 }
 
-Sha256Hash sha256_block(const std::vector<uint8_t>& input)
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+/**
+ * @brief The compression function with the SHA extensions
+ * @details The state is kept in the ABEF/CDGH register layout sha256rnds2 works on. Each group of 4 rounds adds the
+ * round constants to 4 words of the message schedule, which sha256msg1/sha256msg2 extend 4 words at a time.
+ */
+__attribute__((target("sha,sse4.1"))) std::array<uint32_t, 8> sha256_block_shani(const std::array<uint32_t, 8>& h_init,
+                                                                                const std::array<uint32_t, 16>& input)
 {
-    BB_ASSERT_EQ(input.size(), 64U);
-    std::array<uint32_t, 8> result;
-    prepare_constants(result);
-    std::array<uint32_t, 16> hash_input;
-    memcpy((void*)&hash_input[0], (void*)&input[0], 64);
+    __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&h_init[0]));
+    __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&h_init[4]));
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);          // CDAB
+    state1 = _mm_shuffle_epi32(state1, 0x1B);    // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8); // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0); // CDGH
+    const __m128i abef_init = state0;
+    const __m128i cdgh_init = state1;
+
+    // msg[i % 4] holds words 4i, ..., 4i + 3 of the message schedule
+    __m128i msg[4];
+    for (size_t i = 0; i < 16; ++i) {
+        if (i < 4) {
+            msg[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[4 * i]));
+        }
+        const __m128i k = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&round_constants[4 * i]));
+        __m128i words = _mm_add_epi32(msg[i % 4], k);
+        state1 = _mm_sha256rnds2_epu32(state1, state0, words);
+        if (i >= 3 && i < 15) {
+            // Finish words 4(i + 1), ..., 4(i + 1) + 3
+            const __m128i w7 = _mm_alignr_epi8(msg[i % 4], msg[(i + 3) % 4], 4);
+            msg[(i + 1) % 4] = _mm_sha256msg2_epu32(_mm_add_epi32(msg[(i + 1) % 4], w7), msg[i % 4]);
+        }
+        words = _mm_shuffle_epi32(words, 0x0E);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, words);
+        if (i >= 1 && i < 13) {
+            // Start words 4(i + 3), ..., 4(i + 3) + 3
+            msg[(i + 3) % 4] = _mm_sha256msg1_epu32(msg[(i + 3) % 4], msg[i % 4]);
+        }
+    }
+
+    state0 = _mm_add_epi32(state0, abef_init);
+    state1 = _mm_add_epi32(state1, cdgh_init);
+    tmp = _mm_shuffle_epi32(state0, 0x1B);       // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1);    // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0); // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8);    // HGFE
+
+    std::array<uint32_t, 8> output;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[0]), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[4]), state1);
+    return output;
+}
+#endif
+
+} // namespace bb::crypto
+
+namespace {
+
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+__attribute__((target("avx2"))) inline __m256i ror_x8(__m256i x, int shift)
+{
+    return _mm256_or_si256(_mm256_srli_epi32(x, shift), _mm256_slli_epi32(x, 32 - shift));
+}
+
+/**
+ * @brief The compression function applied to 8 independent states and blocks with AVX2, with word i of the 8 states or
+ * message schedules in the 32-bit elements of one register
+ */
+__attribute__((target("avx2"))) void sha256_block_x8(std::array<uint32_t, 8>* states,
+                                                     const std::array<uint32_t, 16>* inputs)
+{
+    alignas(32) uint32_t lanes[8];
+
+    __m256i w[64];
+    for (size_t i = 0; i < 16; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            lanes[j] = inputs[j][i];
+        }
+        w[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes));
+    }
+    for (size_t i = 16; i < 64; ++i) {
+        const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(ror_x8(w[i - 15], 7), ror_x8(w[i - 15], 18)),
+                                            _mm256_srli_epi32(w[i - 15], 3));
+        const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(ror_x8(w[i - 2], 17), ror_x8(w[i - 2], 19)),
+                                            _mm256_srli_epi32(w[i - 2], 10));
+        w[i] = _mm256_add_epi32(_mm256_add_epi32(w[i - 16], w[i - 7]), _mm256_add_epi32(s0, s1));
+    }
+
+    __m256i h_init[8];
+    for (size_t i = 0; i < 8; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            lanes[j] = states[j][i];
+        }
+        h_init[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes));
+    }
+    __m256i a = h_init[0];
+    __m256i b = h_init[1];
+    __m256i c = h_init[2];
+    __m256i d = h_init[3];
+    __m256i e = h_init[4];
+    __m256i f = h_init[5];
+    __m256i g = h_init[6];
+    __m256i h = h_init[7];
+
+    for (size_t i = 0; i < 64; ++i) {
+        const __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(ror_x8(e, 6), ror_x8(e, 11)), ror_x8(e, 25));
+        const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        const __m256i temp1 = _mm256_add_epi32(
+            _mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, w[i])),
+            _mm256_set1_epi32(static_cast<int32_t>(round_constants[i])));
+        const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(ror_x8(a, 2), ror_x8(a, 13)), ror_x8(a, 22));
+        const __m256i maj = _mm256_xor_si256(_mm256_xor_si256(_mm256_and_si256(a, b), _mm256_and_si256(a, c)),
+                                             _mm256_and_si256(b, c));
+        const __m256i temp2 = _mm256_add_epi32(S0, maj);
+
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, temp1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(temp1, temp2);
+    }
+
+    const __m256i output[8] = { a, b, c, d, e, f, g, h };
+    for (size_t i = 0; i < 8; ++i) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi32(output[i], h_init[i]));
+        for (size_t j = 0; j < 8; ++j) {
+            states[j][i] = lanes[j];
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Read a 64-byte block as 16 big-endian words
+ */
+std::array<uint32_t, 16> load_block(const uint8_t* data)
+{
+    std::array<uint32_t, 16> block;
+    memcpy((void*)&block[0], (const void*)data, 64);
     if (is_little_endian()) {
-        for (size_t j = 0; j < hash_input.size(); ++j) {
-            hash_input[j] = __builtin_bswap32(hash_input[j]);
+        for (size_t j = 0; j < block.size(); ++j) {
+            block[j] = __builtin_bswap32(block[j]);
         }
     }
-    result = sha256_block(result, hash_input);
+    return block;
+}
 
-    Sha256Hash output;
-    memcpy((void*)&output[0], (void*)&result[0], 32);
+/**
+ * @brief Write the state out as the big-endian hash
+ */
+bb::crypto::Sha256Hash store_hash(const std::array<uint32_t, 8>& state)
+{
+    bb::crypto::Sha256Hash output;
+    memcpy((void*)&output[0], (const void*)&state[0], 32);
     if (is_little_endian()) {
         uint32_t* output_uint32 = (uint32_t*)&output[0];
         for (size_t j = 0; j < 8; ++j) {
             output_uint32[j] = __builtin_bswap32(output_uint32[j]);
         }
     }
-
     return output;
 }
 
-template <typename ByteContainer> Sha256Hash sha256(const ByteContainer& input)
+/**
+ * @brief Append the padding to a message: a 1 bit, zeros up to 8 bytes short of a whole block, and the bit length
+ */
+template <typename ByteContainer> std::vector<uint8_t> pad_message(const ByteContainer& input)
 {
     std::vector<uint8_t> message_schedule;
 
@@ -156,30 +296,115 @@ template <typename ByteContainer> Sha256Hash sha256(const ByteContainer& input)
         uint8_t byte = static_cast<uint8_t>(l >> (uint64_t)(56 - (i * 8)));
         message_schedule.push_back(byte);
     }
+    return message_schedule;
+}
+
+} // namespace
+
+namespace bb::crypto {
+void prepare_constants(std::array<uint32_t, 8>& input)
+{
+    input[0] = init_constants[0];
+    input[1] = init_constants[1];
+    input[2] = init_constants[2];
+    input[3] = init_constants[3];
+    input[4] = init_constants[4];
+    input[5] = init_constants[5];
+    input[6] = init_constants[6];
+    input[7] = init_constants[7];
+}
+
+std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, const std::array<uint32_t, 16>& input)
+{
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+    if (bb::cpu_features().sha) {
+        return sha256_block_shani(h_init, input);
+    }
+#endif
+    return sha256_block_portable(h_init, input);
+}
+
+void sha256_block_batch(std::span<std::array<uint32_t, 8>> states, std::span<const std::array<uint32_t, 16>> inputs)
+{
+    BB_ASSERT_EQ(states.size(), inputs.size());
+    size_t i = 0;
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+    // Where we measured, an 8-way AVX2 compression costs less per block than SHA-NI, which still does the tail
+    if (bb::cpu_features().avx2) {
+        for (; i + 8 <= states.size(); i += 8) {
+            sha256_block_x8(&states[i], &inputs[i]);
+        }
+    }
+#endif
+    for (; i < states.size(); ++i) {
+        states[i] = sha256_block(states[i], inputs[i]);
+    }
+}
+
+Sha256Hash sha256_block(const std::vector<uint8_t>& input)
+{
+    BB_ASSERT_EQ(input.size(), 64U);
+    std::array<uint32_t, 8> result;
+    prepare_constants(result);
+    result = sha256_block(result, load_block(&input[0]));
+    return store_hash(result);
+}
+
+template <typename ByteContainer> Sha256Hash sha256(const ByteContainer& input)
+{
+    const std::vector<uint8_t> message_schedule = pad_message(input);
     std::array<uint32_t, 8> rolling_hash;
     prepare_constants(rolling_hash);
     const size_t num_blocks = message_schedule.size() / 64;
     for (size_t i = 0; i < num_blocks; ++i) {
-        std::array<uint32_t, 16> hash_input;
-        memcpy((void*)&hash_input[0], (void*)&message_schedule[i * 64], 64);
-        if (is_little_endian()) {
-            for (size_t j = 0; j < hash_input.size(); ++j) {
-                hash_input[j] = __builtin_bswap32(hash_input[j]);
-            }
-        }
-        rolling_hash = sha256_block(rolling_hash, hash_input);
+        rolling_hash = sha256_block(rolling_hash, load_block(&message_schedule[i * 64]));
     }
+    return store_hash(rolling_hash);
+}
 
-    Sha256Hash output;
-    memcpy((void*)&output[0], (void*)&rolling_hash[0], 32);
-    if (is_little_endian()) {
-        uint32_t* output_uint32 = (uint32_t*)&output[0];
-        for (size_t j = 0; j < 8; ++j) {
-            output_uint32[j] = __builtin_bswap32(output_uint32[j]);
+std::vector<Sha256Hash> sha256_batch(std::span<const std::vector<uint8_t>> inputs)
+{
+    const size_t num_messages = inputs.size();
+    if (num_messages == 0) {
+        return {};
+    }
+    std::vector<std::vector<uint8_t>> padded_inputs;
+    padded_inputs.reserve(num_messages);
+    for (const auto& input : inputs) {
+        padded_inputs.emplace_back(pad_message(input));
+    }
+
+    // Compressing the messages with the most blocks first keeps the states still being compressed at the front, so
+    // that each batch runs on a prefix of the states and finished states are left alone
+    std::vector<size_t> order(num_messages);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return padded_inputs[a].size() > padded_inputs[b].size();
+    });
+
+    std::vector<std::array<uint32_t, 8>> states(num_messages);
+    for (auto& state : states) {
+        prepare_constants(state);
+    }
+    std::vector<std::array<uint32_t, 16>> blocks(num_messages);
+    const size_t max_num_blocks = padded_inputs[order[0]].size() / 64;
+    size_t num_active = num_messages;
+    for (size_t block = 0; block < max_num_blocks; ++block) {
+        while (padded_inputs[order[num_active - 1]].size() / 64 <= block) {
+            --num_active;
         }
+        for (size_t k = 0; k < num_active; ++k) {
+            blocks[k] = load_block(&padded_inputs[order[k]][block * 64]);
+        }
+        sha256_block_batch(std::span(states).first(num_active),
+                           std::span<const std::array<uint32_t, 16>>(blocks).first(num_active));
     }
 
-    return output;
+    std::vector<Sha256Hash> hashes(num_messages);
+    for (size_t k = 0; k < num_messages; ++k) {
+        hashes[order[k]] = store_hash(states[k]);
+    }
+    return hashes;
 }
 
 template Sha256Hash sha256<std::vector<uint8_t>>(const std::vector<uint8_t>& input);
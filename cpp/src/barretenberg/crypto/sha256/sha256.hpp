@@ -11,6 +11,7 @@
 #include <array>
 #include <iomanip>
 #include <ostream>
+#include <span>
 #include <vector>
 
 namespace bb::crypto {
@@ -19,8 +20,37 @@ using Sha256Hash = std::array<uint8_t, 32>;
 
 Sha256Hash sha256_block(const std::vector<uint8_t>& input);
 
+/**
+ * @brief The SHA-256 compression function, applied to a state and a 64-byte block read as 16 big-endian words
+ * @details Uses the SHA extensions (SHA-NI) when the CPU supports them.
+ */
+std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, const std::array<uint32_t, 16>& input);
+
+/**
+ * @brief The back ends sha256_block dispatches to, exposed so that they can be checked against each other
+ * @details sha256_block_shani may only be called when cpu_features().sha is set.
+ */
+std::array<uint32_t, 8> sha256_block_portable(const std::array<uint32_t, 8>& h_init,
+                                              const std::array<uint32_t, 16>& input);
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+std::array<uint32_t, 8> sha256_block_shani(const std::array<uint32_t, 8>& h_init,
+                                           const std::array<uint32_t, 16>& input);
+#endif
+
+/**
+ * @brief The SHA-256 compression function, applied in place to independent states, each with its own block
+ * @details When the CPU supports AVX2, groups of 8 blocks are compressed together with it. The remaining blocks go
+ * through sha256_block.
+ */
+void sha256_block_batch(std::span<std::array<uint32_t, 8>> states, std::span<const std::array<uint32_t, 16>> inputs);
+
 template <typename T> Sha256Hash sha256(const T& input);
 
+/**
+ * @brief SHA-256 of independent messages, compressing a block of each message per call to sha256_block_batch
+ */
+std::vector<Sha256Hash> sha256_batch(std::span<const std::vector<uint8_t>> inputs);
+
 inline bb::fr sha256_to_field(std::vector<uint8_t> const& input)
 {
     auto result = sha256(input);
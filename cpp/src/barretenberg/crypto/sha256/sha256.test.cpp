@@ -1,4 +1,6 @@
 #include "sha256.hpp"
+#include "barretenberg/common/cpu_features.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
 #include <memory>
@@ -101,3 +103,70 @@ TEST(misc_sha256, test_NIST_vector_five)
         EXPECT_EQ(result[i], expected[i]);
     }
 }
+
+TEST(misc_sha256, batch_matches_single)
+{
+    // Lengths around the block boundaries, and enough of each to fill the 8-way batches
+    std::vector<std::vector<uint8_t>> inputs;
+    for (size_t length : { 0, 1, 55, 56, 63, 64, 65, 119, 120, 128, 300 }) {
+        for (size_t i = 0; i < 9; ++i) {
+            std::vector<uint8_t> input(length);
+            for (size_t j = 0; j < length; ++j) {
+                input[j] = static_cast<uint8_t>((inputs.size() * 31) + j);
+            }
+            inputs.emplace_back(std::move(input));
+        }
+    }
+
+    auto results = sha256_batch(inputs);
+
+    ASSERT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(results[i], sha256(inputs[i]));
+    }
+}
+
+TEST(misc_sha256, block_batch_matches_single)
+{
+    std::vector<std::array<uint32_t, 8>> states(19);
+    std::vector<std::array<uint32_t, 16>> inputs(19);
+    for (size_t i = 0; i < states.size(); ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            states[i][j] = static_cast<uint32_t>((i * 0x9e3779b9) ^ (j * 0x7f4a7c15));
+        }
+        for (size_t j = 0; j < 16; ++j) {
+            inputs[i][j] = static_cast<uint32_t>((i * 0x85ebca6b) + (j * 0xc2b2ae35));
+        }
+    }
+    std::vector<std::array<uint32_t, 8>> expected;
+    for (size_t i = 0; i < states.size(); ++i) {
+        expected.emplace_back(sha256_block(states[i], inputs[i]));
+    }
+
+    sha256_block_batch(states, inputs);
+
+    EXPECT_EQ(states, expected);
+}
+
+TEST(misc_sha256, shani_matches_portable)
+{
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+    if (!cpu_features().sha) {
+        GTEST_SKIP() << "the CPU has no SHA extensions";
+    }
+    auto& engine = numeric::get_debug_randomness();
+    for (size_t i = 0; i < 1000; ++i) {
+        std::array<uint32_t, 8> state;
+        std::array<uint32_t, 16> input;
+        for (auto& word : state) {
+            word = engine.get_random_uint32();
+        }
+        for (auto& word : input) {
+            word = engine.get_random_uint32();
+        }
+        EXPECT_EQ(sha256_block_shani(state, input), sha256_block_portable(state, input)) << "block " << i;
+    }
+#else
+    GTEST_SKIP() << "built without the SHA-NI back end";
+#endif
+}
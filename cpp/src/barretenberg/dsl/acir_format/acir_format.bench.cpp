@@ -0,0 +1,31 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/dsl/acir_format/acir_format.hpp"
+#include "barretenberg/dsl/acir_format/acir_format_mocks.hpp"
+
+using namespace benchmark;
+
+namespace {
+
+/**
+ * @brief Lowering of a program made mostly of width-4 arithmetic constraints, for a number of constraints given by
+ * the first argument and the number of threads used to prepare them given by the second
+ */
+void build_arithmetic_constraints(State& state)
+{
+    const size_t num_cpus = bb::get_num_cpus();
+    bb::set_parallel_for_concurrency(static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        acir_format::AcirProgram program = create_mixed_arithmetic_program(static_cast<size_t>(state.range(0)));
+        state.ResumeTiming();
+        DoNotOptimize(acir_format::create_circuit(program));
+    }
+    bb::set_parallel_for_concurrency(num_cpus);
+}
+} // namespace
+
+BENCHMARK(build_arithmetic_constraints)->Unit(kMillisecond)->ArgsProduct({ { 1 << 16, 1 << 18 }, { 1, 4, 16 } });
+
+BENCHMARK_MAIN();
@@ -10,6 +10,7 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/bb_bench.hpp"
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/dsl/acir_format/proof_surgeon.hpp"
 #include "barretenberg/flavor/flavor.hpp"
@@ -24,6 +25,7 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -49,9 +51,9 @@ template <typename Builder> void set_zero_idx(const Builder& builder, mul_quad_<
 }
 
 template <typename Builder>
-void check_mul_add_gate(Builder& builder,
-                        const mul_quad_<typename Builder::FF>& mul_quad,
-                        const typename Builder::FF next_wire_w4)
+typename Builder::FF evaluate_mul_add_gate(const Builder& builder,
+                                           const mul_quad_<typename Builder::FF>& mul_quad,
+                                           const typename Builder::FF next_wire_w4)
 {
     using FF = Builder::FF;
 
@@ -62,11 +64,57 @@ void check_mul_add_gate(Builder& builder,
     result += builder.get_variable(mul_quad.c) * mul_quad.c_scaling;
     result += builder.get_variable(mul_quad.d) * mul_quad.d_scaling;
 
-    if (result != FF::zero() && !builder.failed()) {
+    return result;
+}
+
+template <typename Builder>
+void check_mul_add_gate(Builder& builder,
+                        const mul_quad_<typename Builder::FF>& mul_quad,
+                        const typename Builder::FF next_wire_w4)
+{
+    using FF = Builder::FF;
+
+    if (evaluate_mul_add_gate(builder, mul_quad, next_wire_w4) != FF::zero() && !builder.failed()) {
         builder.failure("mul_add_gate");
     }
 }
 
+/**
+ * @brief Replace the IS_CONSTANT indices of the width-4 quad constraints and check their witness assignment, in
+ * parallel since both only read the builder.
+ *
+ * @return Whether all the quad constraints are satisfied
+ */
+template <typename Builder>
+bool prepare_quad_constraints(const Builder& builder, std::vector<mul_quad_<typename Builder::FF>>& quad_constraints)
+{
+    using FF = Builder::FF;
+
+    std::vector<uint8_t> is_satisfied(quad_constraints.size());
+    parallel_for_heuristic(
+        quad_constraints.size(),
+        [&](size_t i) {
+            set_zero_idx(builder, quad_constraints[i]);
+            is_satisfied[i] = static_cast<uint8_t>(evaluate_mul_add_gate(builder, quad_constraints[i]) == FF::zero());
+        },
+        /*heuristic_cost=*/6 * thread_heuristics::FF_MULTIPLICATION_COST + 6 * thread_heuristics::FF_ADDITION_COST);
+    return std::ranges::find(is_satisfied, 0) == is_satisfied.end();
+}
+
+/**
+ * @brief Reserve the arithmetic block for all the rows the ACIR arithmetic constraints are known to produce, so that
+ * lowering large circuits does not repeatedly reallocate the wire and selector columns.
+ */
+template <typename Builder> void reserve_arithmetic_rows(Builder& builder, const AcirFormat& constraint_system)
+{
+    size_t num_rows =
+        constraint_system.arithmetic_triple_constraints.size() + constraint_system.quad_constraints.size();
+    for (const auto& big_constraint : constraint_system.big_quad_constraints) {
+        num_rows += big_constraint.size();
+    }
+    builder.blocks.arithmetic.reserve(builder.blocks.arithmetic.size() + num_rows);
+}
+
 template <typename Builder>
 void perform_full_IPA_verification(Builder& builder,
                                    const std::vector<OpeningClaim<stdlib::grumpkin<Builder>>>& nested_ipa_claims,
@@ -127,6 +175,8 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
 
     GateCounter gate_counter{ &builder, collect_gates_per_opcode };
 
+    reserve_arithmetic_rows(builder, constraint_system);
+
     // Add arithmetic gates
 
     // AUDITTODO(federico): remove poly_triple_constraints
@@ -137,22 +187,36 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
         gate_counter.track_diff(constraint_system.gates_per_opcode, opcode_idx);
     }
 
-    // Add standard width-4 Ultra arithmetic gates
-    for (auto [constraint, opcode_idx] :
-         zip_view(constraint_system.quad_constraints, constraint_system.original_opcode_indices.quad_constraints)) {
-        set_zero_idx(builder, constraint);
-        check_mul_add_gate(builder, constraint);
-        builder.create_big_mul_add_gate(constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode, opcode_idx);
+    // Add standard width-4 Ultra arithmetic gates. They add no variables and only read the builder, so they are
+    // checked and written to their rows of the arithmetic block in parallel. The circuit (and the failure reported for
+    // an unsatisfied constraint) is identical to appending them one at a time. Counting the gates of each opcode
+    // requires appending them one at a time.
+    if (!prepare_quad_constraints(builder, constraint_system.quad_constraints) && !builder.failed()) {
+        builder.failure("mul_add_gate");
+    }
+    if (collect_gates_per_opcode) {
+        for (const auto& [constraint, opcode_idx] :
+             zip_view(constraint_system.quad_constraints, constraint_system.original_opcode_indices.quad_constraints)) {
+            builder.create_big_mul_add_gate(constraint);
+            gate_counter.track_diff(constraint_system.gates_per_opcode, opcode_idx);
+        }
+    } else {
+        builder.create_big_mul_add_gates(constraint_system.quad_constraints, /*use_next_gate_w_4=*/{});
     }
 
     // When an expression doesn't fit into a single width-4 gate, we split it across multiple gates and we leverage
     // w4_shift to use the least possible number of intermediate witnesses. See the documentation of
-    // split_into_mul_quad_gates for more information.
-    for (auto [big_constraint, opcode_idx] : zip_view(constraint_system.big_quad_constraints,
-                                                      constraint_system.original_opcode_indices.big_quad_constraints)) {
-        create_big_quad_constraint(builder, big_constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode, opcode_idx);
+    // split_into_mul_quad_gates for more information. The constraints are independent of each other, so they are
+    // lowered in parallel by create_big_quad_constraints.
+    if (collect_gates_per_opcode) {
+        for (auto [big_constraint, opcode_idx] :
+             zip_view(constraint_system.big_quad_constraints,
+                      constraint_system.original_opcode_indices.big_quad_constraints)) {
+            create_big_quad_constraint(builder, big_constraint);
+            gate_counter.track_diff(constraint_system.gates_per_opcode, opcode_idx);
+        }
+    } else {
+        create_big_quad_constraints(builder, constraint_system.big_quad_constraints);
     }
 
     // Add logic constraint
@@ -682,6 +746,16 @@ template void set_zero_idx<UltraCircuitBuilder>(const UltraCircuitBuilder&,
 
 template void set_zero_idx<MegaCircuitBuilder>(const MegaCircuitBuilder&, mul_quad_<typename MegaCircuitBuilder::FF>&);
 
+template UltraCircuitBuilder::FF evaluate_mul_add_gate<UltraCircuitBuilder>(
+    const UltraCircuitBuilder&,
+    const mul_quad_<typename UltraCircuitBuilder::FF>&,
+    const typename UltraCircuitBuilder::FF);
+
+template MegaCircuitBuilder::FF evaluate_mul_add_gate<MegaCircuitBuilder>(
+    const MegaCircuitBuilder&,
+    const mul_quad_<typename MegaCircuitBuilder::FF>&,
+    const typename MegaCircuitBuilder::FF);
+
 template void check_mul_add_gate<UltraCircuitBuilder>(UltraCircuitBuilder&,
                                                       const mul_quad_<typename UltraCircuitBuilder::FF>&,
                                                       const typename UltraCircuitBuilder::FF);
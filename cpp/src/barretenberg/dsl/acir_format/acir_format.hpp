@@ -240,6 +240,14 @@ template <typename Builder> class GateCounter {
  */
 template <typename Builder> void set_zero_idx(const Builder& builder, mul_quad_<typename Builder::FF>& mul_quad);
 
+/**
+ * @brief Evaluate a mul add gate on the builder's witness values; the gate is satisfied iff the result is zero.
+ */
+template <typename Builder>
+typename Builder::FF evaluate_mul_add_gate(const Builder& builder,
+                                           const mul_quad_<typename Builder::FF>& mul_quad,
+                                           const typename Builder::FF next_wire_w4 = Builder::FF::zero());
+
 /**
  * @brief Check if a mul add gate is valid.
  *
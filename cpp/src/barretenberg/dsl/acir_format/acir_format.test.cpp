@@ -6,8 +6,10 @@
 #include "acir_format_mocks.hpp"
 #include "acir_to_constraint_buf.hpp"
 #include "barretenberg/common/streams.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/dsl/acir_format/gate_count_constants.hpp"
 #include "barretenberg/op_queue/ecc_op_queue.hpp"
+#include "barretenberg/ultra_honk/prover_instance.hpp"
 
 #include "barretenberg/serialize/test_helper.hpp"
 
@@ -1332,3 +1334,76 @@ TYPED_TEST(OpcodeGateCountTests, BlockReturnData)
 
     EXPECT_EQ(builder.get_num_finalized_gates_inefficient(/*ensure_nonzero=*/false), BLOCK_RETURNDATA<TypeParam>);
 }
+
+/**
+ * @brief The streaming bincode witness decoder must agree with decoding through the Witnesses:: object model,
+ * including zero-filling of the holes left by ACIR in the WitnessMap
+ */
+TEST_F(AcirFormatTests, WitnessBufStreamingDecoderMatchesWitnessMap)
+{
+    Witnesses::WitnessMap witness_map;
+    witness_map.value[Witnesses::Witness{ .value = 0 }] = to_bytes_be(7);
+    witness_map.value[Witnesses::Witness{ .value = 3 }] = to_bytes_be(static_cast<uint256_t>(fr(-1)));
+    witness_map.value[Witnesses::Witness{ .value = 4 }] = to_bytes_be(42);
+    Witnesses::WitnessStack witness_stack{ .stack = { Witnesses::StackItem{ .index = 0, .witness = witness_map } } };
+
+    WitnessVector expected = witness_map_to_witness_vector(witness_map);
+    WitnessVector result = witness_buf_to_witness_vector(witness_stack.bincodeSerialize());
+
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(result, (WitnessVector{ 7, 0, 0, fr(-1), 42 }));
+}
+
+/**
+ * @brief The quad constraints are prepared in parallel before their gates are appended; lowering a program mixing
+ * them with other constraint families must give the same circuit whatever the number of threads
+ */
+TEST_F(AcirFormatTests, ParallelQuadPreparationMatchesSerialLowering)
+{
+    const size_t num_cpus = get_num_cpus();
+    auto build_with_concurrency = [](size_t concurrency) {
+        set_parallel_for_concurrency(concurrency);
+        AcirProgram program = create_mixed_arithmetic_program(1 << 12);
+        return create_circuit(program);
+    };
+    auto serial_builder = build_with_concurrency(1);
+    auto parallel_builder = build_with_concurrency(8);
+    set_parallel_for_concurrency(num_cpus);
+
+    EXPECT_TRUE(CircuitChecker::check(serial_builder));
+    EXPECT_TRUE(CircuitChecker::check(parallel_builder));
+    EXPECT_EQ(parallel_builder.get_num_finalized_gates_inefficient(),
+              serial_builder.get_num_finalized_gates_inefficient());
+    EXPECT_EQ(parallel_builder.get_num_variables(), serial_builder.get_num_variables());
+
+    auto serial_instance = std::make_shared<ProverInstance_<UltraFlavor>>(serial_builder);
+    auto parallel_instance = std::make_shared<ProverInstance_<UltraFlavor>>(parallel_builder);
+    UltraFlavor::VerificationKey serial_vk(serial_instance->get_precomputed());
+    UltraFlavor::VerificationKey parallel_vk(parallel_instance->get_precomputed());
+    EXPECT_EQ(parallel_vk, serial_vk);
+}
+
+/**
+ * @brief An unsatisfied quad constraint is reported as the first failure whatever the number of threads
+ */
+TEST_F(AcirFormatTests, ParallelQuadPreparationReportsFirstFailure)
+{
+    const size_t num_cpus = get_num_cpus();
+    auto build_with_concurrency = [](size_t concurrency) {
+        set_parallel_for_concurrency(concurrency);
+        AcirProgram program = create_mixed_arithmetic_program(1 << 10);
+        // Break the output witness of a quad constraint in the middle of the program
+        program.witness[program.constraints.quad_constraints[517].c] += 1;
+        return create_circuit(program);
+    };
+    auto serial_builder = build_with_concurrency(1);
+    auto parallel_builder = build_with_concurrency(8);
+    set_parallel_for_concurrency(num_cpus);
+
+    EXPECT_TRUE(serial_builder.failed());
+    EXPECT_TRUE(parallel_builder.failed());
+    EXPECT_EQ(serial_builder.err(), "mul_add_gate");
+    EXPECT_EQ(parallel_builder.err(), "mul_add_gate");
+    EXPECT_EQ(parallel_builder.get_num_finalized_gates_inefficient(),
+              serial_builder.get_num_finalized_gates_inefficient());
+}
@@ -102,3 +102,67 @@ void mock_opcode_indices(acir_format::AcirFormat& constraint_system)
 
     constraint_system.num_acir_opcodes = static_cast<uint32_t>(current_opcode);
 }
+
+acir_format::AcirProgram create_mixed_arithmetic_program(size_t num_quad_constraints)
+{
+    using namespace acir_format;
+
+    WitnessVector witness;
+    auto add_witness = [&](const bb::fr& value) {
+        witness.push_back(value);
+        return static_cast<uint32_t>(witness.size() - 1);
+    };
+
+    AcirFormat constraint_system{};
+    constraint_system.original_opcode_indices = create_empty_original_opcode_indices();
+    for (size_t i = 0; i < num_quad_constraints; i++) {
+        const bb::fr x(i + 2);
+        const bb::fr y(3 * i + 5);
+        const uint32_t x_idx = add_witness(x);
+        const uint32_t y_idx = add_witness(y);
+
+        // x * y + x - z = 0, the unused fourth wire is left as IS_CONSTANT
+        constraint_system.quad_constraints.push_back(bb::mul_quad_<bb::fr>{
+            .a = x_idx,
+            .b = y_idx,
+            .c = add_witness(x * y + x),
+            .d = bb::stdlib::IS_CONSTANT,
+            .mul_scaling = bb::fr(1),
+            .a_scaling = bb::fr(1),
+            .b_scaling = bb::fr(0),
+            .c_scaling = bb::fr(-1),
+            .d_scaling = bb::fr(0),
+            .const_scaling = bb::fr(0),
+        });
+
+        if (i % 16 == 0) {
+            // x + y - s = 0
+            constraint_system.arithmetic_triple_constraints.push_back(bb::arithmetic_triple{
+                .a = x_idx,
+                .b = y_idx,
+                .c = add_witness(x + y),
+                .q_m = 0,
+                .q_l = 1,
+                .q_r = 1,
+                .q_o = -1,
+                .q_c = 0,
+            });
+            constraint_system.range_constraints.push_back(RangeConstraint{ .witness = y_idx, .num_bits = 32 });
+        }
+
+        if (i % 64 == 0) {
+            const uint32_t x_xor_y = static_cast<uint32_t>(uint256_t(x)) ^ static_cast<uint32_t>(uint256_t(y));
+            constraint_system.logic_constraints.push_back(LogicConstraint{
+                .a = WitnessOrConstant<bb::fr>::from_index(x_idx),
+                .b = WitnessOrConstant<bb::fr>::from_index(y_idx),
+                .result = add_witness(bb::fr(x_xor_y)),
+                .num_bits = 32,
+                .is_xor_gate = 1,
+            });
+        }
+    }
+    constraint_system.varnum = static_cast<uint32_t>(witness.size());
+    mock_opcode_indices(constraint_system);
+
+    return AcirProgram{ constraint_system, witness };
+}
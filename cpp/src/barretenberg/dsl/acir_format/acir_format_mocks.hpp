@@ -8,4 +8,10 @@
 
 acir_format::AcirFormatOriginalOpcodeIndices create_empty_original_opcode_indices();
 
-void mock_opcode_indices(acir_format::AcirFormat& constraint_system);
\ No newline at end of file
+void mock_opcode_indices(acir_format::AcirFormat& constraint_system);
+
+/**
+ * @brief A satisfiable program made mostly of width-4 arithmetic constraints, mixed with arithmetic triples, range
+ * and XOR constraints on the same witnesses.
+ */
+acir_format::AcirProgram create_mixed_arithmetic_program(size_t num_quad_constraints);
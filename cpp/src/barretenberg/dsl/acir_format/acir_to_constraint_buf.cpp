@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <map>
+#include <span>
 #include <tuple>
 #include <utility>
 
@@ -65,10 +66,113 @@ uint32_t get_witness_from_function_input(Acir::FunctionInput input)
 
 /// ========= BYTES TO BARRETENBERG'S REPRESENTATION  ========= ///
 
-template <typename T>
-T deserialize_any_format(std::vector<uint8_t>&& buf,
+namespace {
+
+/**
+ * @brief Whether `byte` is the header of a msgpack map (fixmap, map16 or map32).
+ */
+bool is_msgpack_map_header(uint8_t byte)
+{
+    return (byte & 0xf0) == 0x80 || byte == 0xde || byte == 0xdf;
+}
+
+/**
+ * @brief Minimal little-endian reader over a bincode buffer, used by the streaming decoders below.
+ */
+class BincodeReader {
+  public:
+    explicit BincodeReader(std::span<const uint8_t> bytes)
+        : bytes_(bytes)
+    {}
+
+    uint32_t read_u32() { return static_cast<uint32_t>(read_le(sizeof(uint32_t))); }
+
+    size_t read_len()
+    {
+        uint64_t len = read_le(sizeof(uint64_t));
+        if (len > BINCODE_MAX_LENGTH) {
+            throw_or_abort("Length is too large");
+        }
+        return static_cast<size_t>(len);
+    }
+
+    std::span<const uint8_t> read_bytes(size_t len)
+    {
+        if (len > bytes_.size() - pos_) {
+            throw_or_abort("Input is not large enough");
+        }
+        auto result = bytes_.subspan(pos_, len);
+        pos_ += len;
+        return result;
+    }
+
+    bool at_end() const { return pos_ == bytes_.size(); }
+
+  private:
+    uint64_t read_le(size_t num_bytes)
+    {
+        auto bytes = read_bytes(num_bytes);
+        uint64_t value = 0;
+        for (size_t i = 0; i < num_bytes; ++i) {
+            value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+        }
+        return value;
+    }
+
+    std::span<const uint8_t> bytes_;
+    size_t pos_ = 0;
+};
+
+/**
+ * @brief Decode a bincode `Acir::Program`, handing ownership of `buf` to the deserializer instead of copying it.
+ */
+Acir::Program program_bincode_deserialize(std::vector<uint8_t> buf)
+{
+    const size_t size = buf.size();
+    auto deserializer = serde::BincodeDeserializer(std::move(buf));
+    auto program = serde::Deserializable<Acir::Program>::deserialize(deserializer);
+    if (deserializer.get_buffer_offset() < size) {
+        throw_or_abort("Some input bytes were not read");
+    }
+    return program;
+}
+
+} // namespace
+
+WitnessVector witness_stack_bincode_to_witness_vector(std::span<const uint8_t> buf)
+{
+    // Bincode layout of a WitnessStack: `len(stack): u64`, then per StackItem `index: u32`, `len(witness_map): u64`,
+    // then per entry `witness_index: u32`, `len(value): u64`, `value: [u8; len]` (a big-endian field element).
+    BincodeReader reader(buf);
+    size_t stack_size = reader.read_len();
+    BB_ASSERT_EQ(stack_size, 1U, "witness_buf_to_witness_vector: expected single WitnessMap in WitnessStack");
+    reader.read_u32(); // StackItem::index
+
+    WitnessVector witness_vector;
+    size_t num_entries = reader.read_len();
+    witness_vector.reserve(num_entries);
+    for (size_t i = 0; i < num_entries; ++i) {
+        uint32_t witness_index = reader.read_u32();
+        auto value = reader.read_bytes(reader.read_len());
+        BB_ASSERT_EQ(value.size(), sizeof(fr), "witness_buf_to_witness_vector: witness value must be 32 bytes");
+        // The WitnessMap is serialized from an ordered map so indices are increasing, but we do not rely on it: holes
+        // are zero-filled exactly as in witness_map_to_witness_vector.
+        if (witness_index >= witness_vector.size()) {
+            witness_vector.resize(static_cast<size_t>(witness_index) + 1, fr(0));
+        }
+        witness_vector[witness_index] = fr::serialize_from_buffer(value.data());
+    }
+    if (!reader.at_end()) {
+        throw_or_abort("Some input bytes were not read");
+    }
+
+    return witness_vector;
+}
+
+template <typename T, typename Buffer>
+T deserialize_any_format(Buffer&& buf,
                          std::function<T(msgpack::object const&)> decode_msgpack,
-                         std::function<T(std::vector<uint8_t>)> decode_bincode)
+                         std::function<T(Buffer)> decode_bincode)
 {
     // We can't rely on exceptions to try to deserialize binpack, falling back to
     // msgpack if it fails, because exceptions are (or were) not supported in Wasm
@@ -86,7 +190,10 @@ T deserialize_any_format(std::vector<uint8_t>&& buf,
         // Once we remove support for legacy bincode format, we should expect to always
         // have a format marker corresponding to acir::serialization::Format::Msgpack,
         // but until then a match could be pure coincidence.
-        if (buf[0] == 2) {
+        //
+        // All the top level formats we look for are MAP types, so we only run the (full-buffer) msgpack probe if the
+        // byte following the marker is a msgpack map header. This keeps the common bincode path to a single pass.
+        if (buf[0] == 2 && buf.size() > 1 && is_msgpack_map_header(buf[1])) {
             // Skip the format marker to get the data.
             const char* buffer = &reinterpret_cast<const char*>(buf.data())[1];
             size_t size = buf.size() - 1;
@@ -109,7 +216,7 @@ T deserialize_any_format(std::vector<uint8_t>&& buf,
         // from it, so let's just acknowledge that for now we don't want to
         // exercise this code path and treat the whole data as bincode.
     }
-    return decode_bincode(std::move(buf));
+    return decode_bincode(std::forward<Buffer>(buf));
 }
 
 AcirFormat circuit_serde_to_acir_format(Acir::Circuit const& circuit)
@@ -166,7 +273,7 @@ AcirFormat circuit_serde_to_acir_format(Acir::Circuit const& circuit)
 AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t>&& buf)
 {
     // We need to deserialize into Acir::Program first because the buffer returned by Noir has this structure
-    auto program = deserialize_any_format<Acir::Program>(
+    auto program = deserialize_any_format<Acir::Program, std::vector<uint8_t>>(
         std::move(buf),
         [](auto o) -> Acir::Program {
             Acir::Program program;
@@ -182,7 +289,7 @@ AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t>&& buf)
             }
             return program;
         },
-        &Acir::Program::bincodeDeserialize);
+        &program_bincode_deserialize);
     BB_ASSERT_EQ(program.functions.size(), 1U, "circuit_buf_to_acir_format: expected single function in ACIR program");
 
     return circuit_serde_to_acir_format(program.functions[0]);
@@ -190,9 +297,15 @@ AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t>&& buf)
 
 WitnessVector witness_buf_to_witness_vector(std::vector<uint8_t>&& buf)
 {
-    // We need to deserialize into WitnessStack first because the buffer returned by Noir has this structure
-    auto witness_stack = deserialize_any_format<Witnesses::WitnessStack>(
-        std::move(buf),
+    return witness_buf_to_witness_vector(std::span<const uint8_t>(buf));
+}
+
+WitnessVector witness_buf_to_witness_vector(std::span<const uint8_t> buf)
+{
+    // Bincode is decoded in a single pass straight into the WitnessVector. The msgpack path deserializes into a
+    // WitnessStack first because the buffer returned by Noir has this structure.
+    return deserialize_any_format<WitnessVector, std::span<const uint8_t>>(
+        buf,
         [](auto o) {
             Witnesses::WitnessStack witness_stack;
             try {
@@ -201,13 +314,12 @@ WitnessVector witness_buf_to_witness_vector(std::vector<uint8_t>&& buf)
                 std::cerr << o << std::endl;
                 throw_or_abort("failed to convert msgpack data to WitnessStack");
             }
-            return witness_stack;
+            BB_ASSERT_EQ(witness_stack.stack.size(),
+                         1U,
+                         "witness_buf_to_witness_vector: expected single WitnessMap in WitnessStack");
+            return witness_map_to_witness_vector(witness_stack.stack[0].witness);
         },
-        &Witnesses::WitnessStack::bincodeDeserialize);
-    BB_ASSERT_EQ(
-        witness_stack.stack.size(), 1U, "witness_buf_to_witness_vector: expected single WitnessMap in WitnessStack");
-
-    return witness_map_to_witness_vector(witness_stack.stack[0].witness);
+        &witness_stack_bincode_to_witness_vector);
 }
 
 WitnessVector witness_map_to_witness_vector(Witnesses::WitnessMap const& witness_map)
@@ -8,6 +8,8 @@
 #include "acir_format.hpp"
 #include "serde/index.hpp"
 
+#include <span>
+
 namespace acir_format {
 
 /// ========= HELPERS ========= ///
@@ -74,6 +76,14 @@ AcirFormat circuit_serde_to_acir_format(Acir::Circuit const& circuit);
  */
 WitnessVector witness_map_to_witness_vector(Witnesses::WitnessMap const& witness_map);
 
+/**
+ * @brief Decode a bincode-serialized `WitnessStack` directly into a `WitnessVector` in a single pass.
+ *
+ * @details Equivalent to `witness_map_to_witness_vector(WitnessStack::bincodeDeserialize(buf).stack[0].witness)`, but
+ * without materialising the intermediate `std::map` and per-witness byte vectors.
+ */
+WitnessVector witness_stack_bincode_to_witness_vector(std::span<const uint8_t> buf);
+
 /**
  * @brief Convert a buffer representing a circuit into Barretenberg's internal `AcirFormat` representation.
  */
@@ -84,6 +94,11 @@ AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t>&& buf);
  */
 WitnessVector witness_buf_to_witness_vector(std::vector<uint8_t>&& buf);
 
+/**
+ * @brief Convert a witness buffer that is not owned by the caller (e.g. shared memory) into a `WitnessVector`.
+ */
+WitnessVector witness_buf_to_witness_vector(std::span<const uint8_t> buf);
+
 /// ========= ACIR OPCODE HANDLERS ========= ///
 /// AUDITTODO(federico): Restructure the functions below so that it is clear how they are used
 
@@ -5,6 +5,9 @@
 // =====================
 
 #include "big_quad_constraints.hpp"
+#include "barretenberg/common/thread.hpp"
+
+#include <algorithm>
 
 namespace acir_format {
 
@@ -81,10 +84,89 @@ void create_big_quad_constraint(Builder& builder, std::vector<mul_quad_<typename
     check_mul_add_gate(builder, big_constraint.back());
 }
 
+/**
+ * @brief Create all the big quad constraints of a circuit; the circuit is identical to calling
+ * create_big_quad_constraint on each of them in order.
+ *
+ * @details A big quad constraint only reads existing witnesses and the intermediate witnesses it adds itself, so the
+ * constraints are lowered in parallel, each into its own range of intermediate witness values and of gates. As the
+ * gates add no variables, the intermediate witnesses of all the constraints end up numbered consecutively from the
+ * current number of variables, in constraint order: the gates refer to them by these final indices, and the witnesses
+ * are then added in that order before all the gates are appended at once.
+ */
+template <typename Builder>
+void create_big_quad_constraints(Builder& builder,
+                                 std::vector<std::vector<mul_quad_<typename Builder::FF>>>& big_constraints)
+{
+    using FF = typename Builder::FF;
+
+    // Where the gates, and the intermediate witnesses, of each constraint start
+    std::vector<size_t> gate_offsets(big_constraints.size() + 1, 0);
+    std::vector<size_t> witness_offsets(big_constraints.size() + 1, 0);
+    for (size_t k = 0; k < big_constraints.size(); ++k) {
+        BB_ASSERT(!big_constraints[k].empty());
+        gate_offsets[k + 1] = gate_offsets[k] + big_constraints[k].size();
+        witness_offsets[k + 1] = witness_offsets[k] + big_constraints[k].size() - 1;
+    }
+    const auto first_witness_idx = static_cast<uint32_t>(builder.get_num_variables());
+
+    std::vector<mul_quad_<FF>> gates(gate_offsets.back());
+    std::vector<uint8_t> include_next_gate_w_4(gates.size());
+    std::vector<FF> witness_values(witness_offsets.back());
+    std::vector<uint8_t> is_satisfied(big_constraints.size());
+    // Big quad constraints have at least two gates
+    const size_t heuristic_cost =
+        2 * (6 * thread_heuristics::FF_MULTIPLICATION_COST + 6 * thread_heuristics::FF_ADDITION_COST);
+    parallel_for_heuristic(
+        big_constraints.size(),
+        [&](size_t k) {
+            auto& big_constraint = big_constraints[k];
+            for (size_t j = 0; j < big_constraint.size(); ++j) {
+                auto& gate = big_constraint[j];
+                set_zero_idx(builder, gate);
+                // The 4-th wire of the gates after the first one is the intermediate witness added by the previous
+                // gate, which is not in the builder yet
+                const FF d_value = j == 0 ? builder.get_variable(gate.d) : witness_values[witness_offsets[k] + j - 1];
+                const FF result = builder.get_variable(gate.a) * builder.get_variable(gate.b) * gate.mul_scaling +
+                                  builder.get_variable(gate.a) * gate.a_scaling +
+                                  builder.get_variable(gate.b) * gate.b_scaling +
+                                  builder.get_variable(gate.c) * gate.c_scaling + d_value * gate.d_scaling +
+                                  gate.const_scaling;
+                const size_t gate_idx = gate_offsets[k] + j;
+                if (j + 1 < big_constraint.size()) {
+                    // Gates other than the last one are satisfied by construction of the next 4-th wire
+                    const size_t witness_idx = witness_offsets[k] + j;
+                    witness_values[witness_idx] = -result;
+                    big_constraint[j + 1].d = first_witness_idx + static_cast<uint32_t>(witness_idx);
+                    big_constraint[j + 1].d_scaling = fr(-1);
+                    include_next_gate_w_4[gate_idx] = 1;
+                } else {
+                    is_satisfied[k] = static_cast<uint8_t>(result == FF::zero());
+                }
+                gates[gate_idx] = gate;
+            }
+        },
+        heuristic_cost);
+
+    for (const FF& value : witness_values) {
+        builder.add_variable(value);
+    }
+    if (std::ranges::find(is_satisfied, 0) != is_satisfied.end() && !builder.failed()) {
+        builder.failure("mul_add_gate");
+    }
+    builder.create_big_mul_add_gates(gates, include_next_gate_w_4);
+}
+
 template void create_big_quad_constraint<UltraCircuitBuilder>(
     UltraCircuitBuilder& builder, std::vector<mul_quad_<UltraCircuitBuilder::FF>>& big_constraint);
 
 template void create_big_quad_constraint<MegaCircuitBuilder>(
     MegaCircuitBuilder& builder, std::vector<mul_quad_<MegaCircuitBuilder::FF>>& big_constraint);
 
+template void create_big_quad_constraints<UltraCircuitBuilder>(
+    UltraCircuitBuilder& builder, std::vector<std::vector<mul_quad_<UltraCircuitBuilder::FF>>>& big_constraints);
+
+template void create_big_quad_constraints<MegaCircuitBuilder>(
+    MegaCircuitBuilder& builder, std::vector<std::vector<mul_quad_<MegaCircuitBuilder::FF>>>& big_constraints);
+
 } // namespace acir_format
@@ -18,4 +18,8 @@ namespace acir_format {
 template <typename Builder>
 void create_big_quad_constraint(Builder& builder, std::vector<bb::mul_quad_<typename Builder::FF>>& big_constraint);
 
+template <typename Builder>
+void create_big_quad_constraints(Builder& builder,
+                                 std::vector<std::vector<bb::mul_quad_<typename Builder::FF>>>& big_constraints);
+
 } // namespace acir_format
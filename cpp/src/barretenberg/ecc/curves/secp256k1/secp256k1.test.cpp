@@ -307,6 +307,12 @@ TEST(secp256k1, MixedAddExceptionTestInfinity)
     rhs_c = secp256k1::g1::element(rhs);
 
     EXPECT_EQ(rhs_c == result, true);
+
+    lhs = secp256k1::g1::element::random_element();
+    rhs.self_set_infinity();
+    result = lhs + rhs;
+
+    EXPECT_EQ(result == lhs, true);
 }
 
 TEST(secp256k1, MixedAddExceptionTestDbl)
@@ -256,6 +256,9 @@ constexpr element<Fq, Fr, T> element<Fq, Fr, T>::operator+=(const affine_element
             *this = { other.x, other.y, Fq::one() };
             return *this;
         }
+        if (other.is_point_at_infinity()) {
+            return *this;
+        }
     } else {
         const bool edge_case_trigger = x.is_msb_set() || other.x.is_msb_set();
         if (edge_case_trigger) {
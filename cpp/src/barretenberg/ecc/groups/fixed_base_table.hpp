@@ -0,0 +1,88 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Precomputed multiples of a fixed base point, to multiply it by scalars without doublings
+ *
+ * @details The scalar is split into NUM_WINDOWS windows of WINDOW_BITS bits. For the i-th window, the table holds the
+ * affine points j⋅2^(WINDOW_BITS⋅i)⋅[P] for j = 1, ..., 2^WINDOW_BITS - 1, so that
+ *
+ *      k⋅[P] = ∑ᵢ table[i][kᵢ]
+ *
+ * where kᵢ is the i-th window of k. A multiplication costs one mixed addition per nonzero window of the scalar, against
+ * ~256 doublings and ~128 additions for double-and-add. A table holds 960 affine points, so it is only worth building
+ * for points multiplied by many scalars, such as group and Pedersen generators.
+ *
+ * Like the variable-base multiplication it replaces, this is not constant time.
+ *
+ * @tparam Group
+ */
+template <typename Group> class FixedBaseTable {
+  public:
+    using Element = typename Group::element;
+    using AffineElement = typename Group::affine_element;
+    static constexpr size_t WINDOW_BITS = 4;
+    static constexpr size_t NUM_WINDOWS = 256 / WINDOW_BITS;
+    static constexpr size_t POINTS_PER_WINDOW = (1UL << WINDOW_BITS) - 1;
+
+    explicit FixedBaseTable(const AffineElement& base)
+    {
+        std::vector<Element> points(NUM_WINDOWS * POINTS_PER_WINDOW);
+        Element window_base(base);
+        for (size_t i = 0; i < NUM_WINDOWS; ++i) {
+            Element* window = &points[i * POINTS_PER_WINDOW];
+            window[0] = window_base;
+            for (size_t j = 1; j < POINTS_PER_WINDOW; ++j) {
+                window[j] = window[j - 1] + window_base;
+            }
+            // 2^WINDOW_BITS times the base of this window
+            window_base = window[POINTS_PER_WINDOW - 1] + window_base;
+        }
+        Element::batch_normalize(points.data(), points.size());
+        table.reserve(points.size());
+        for (const Element& point : points) {
+            table.emplace_back(point.x, point.y);
+        }
+    }
+
+    /**
+     * @brief Compute scalar⋅[P]
+     */
+    Element mul(const uint256_t& scalar) const
+    {
+        Element result = Group::point_at_infinity;
+        const size_t num_windows = (scalar == 0) ? 0 : (static_cast<size_t>(scalar.get_msb()) / WINDOW_BITS) + 1;
+        for (size_t i = 0; i < num_windows; ++i) {
+            const auto slice = static_cast<size_t>(scalar.slice(i * WINDOW_BITS, (i + 1) * WINDOW_BITS).data[0]);
+            if (slice != 0) {
+                result += table[(i * POINTS_PER_WINDOW) + slice - 1];
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief The table of the generator of the group, built on first use
+     */
+    static const FixedBaseTable& generator()
+    {
+        static const FixedBaseTable generator_table(Group::affine_one);
+        return generator_table;
+    }
+
+  private:
+    std::vector<AffineElement> table;
+};
+
+} // namespace bb
@@ -0,0 +1,50 @@
+#include "fixed_base_table.hpp"
+#include "barretenberg/ecc/curves/bn254/g1.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/curves/secp256k1/secp256k1.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+} // namespace
+
+template <typename Group> class FixedBaseTableTest : public ::testing::Test {};
+
+using GroupTypes = ::testing::Types<bb::g1, grumpkin::g1, secp256k1::g1>;
+TYPED_TEST_SUITE(FixedBaseTableTest, GroupTypes);
+
+TYPED_TEST(FixedBaseTableTest, MatchesVariableBaseMultiplication)
+{
+    using Group = TypeParam;
+    using Element = typename Group::element;
+    using AffineElement = typename Group::affine_element;
+    using Fr = typename Group::Fr;
+
+    const AffineElement base(Group::one * Fr::random_element(&engine));
+    const FixedBaseTable<Group> table(base);
+
+    std::vector<uint256_t> scalars{ 1, 2, 15, 16, 17, 0xffff, uint256_t(Fr::modulus) - 1, uint256_t(0) - 1 };
+    for (size_t i = 0; i < 16; ++i) {
+        scalars.emplace_back(uint256_t(Fr::random_element(&engine)));
+    }
+    for (const uint256_t& scalar : scalars) {
+        Element expected = Element(base) * Fr(scalar);
+        EXPECT_EQ(AffineElement(table.mul(scalar)), AffineElement(expected));
+    }
+    EXPECT_TRUE(table.mul(0).is_point_at_infinity());
+}
+
+TYPED_TEST(FixedBaseTableTest, Generator)
+{
+    using Group = TypeParam;
+    using AffineElement = typename Group::affine_element;
+    using Fr = typename Group::Fr;
+
+    const Fr scalar = Fr::random_element(&engine);
+    EXPECT_EQ(AffineElement(FixedBaseTable<Group>::generator().mul(uint256_t(scalar))),
+              AffineElement(Group::one * scalar));
+    EXPECT_EQ(&FixedBaseTable<Group>::generator(), &FixedBaseTable<Group>::generator());
+}
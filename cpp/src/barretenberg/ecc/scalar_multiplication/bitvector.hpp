@@ -48,6 +48,13 @@ class BitVector {
         std::memset(data_.data(), 0, data_.size() * sizeof(uint64_t));
     }
 
+    // Resize to num_bits cleared bits, reusing the allocated words where possible
+    void resize(size_t num_bits)
+    {
+        num_bits_ = num_bits;
+        data_.assign((num_bits + 63) / 64, 0);
+    }
+
     size_t size() const { return num_bits_; }
 
     // Optional: access raw pointer for performance
@@ -19,6 +19,9 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
+#include <array>
+#include <optional>
+
 namespace bb::scalar_multiplication {
 
 /**
@@ -45,16 +48,20 @@ typename Curve::Element small_mul(std::span<const typename Curve::ScalarField>&
 }
 
 /**
- * @brief Convert scalar out of Montgomery form. Populate `consolidated_indices` with nonzero scalar indices
+ * @brief Write `scalars` converted out of Montgomery form to `transformed_scalars`, which may alias them. Populate
+ * `consolidated_indices` with nonzero scalar indices
  *
  * @tparam Curve
  * @param scalars
+ * @param transformed_scalars
  * @param consolidated_indices
  */
 template <typename Curve>
-void MSM<Curve>::transform_scalar_and_get_nonzero_scalar_indices(std::span<typename Curve::ScalarField> scalars,
+void MSM<Curve>::transform_scalar_and_get_nonzero_scalar_indices(std::span<const ScalarField> scalars,
+                                                                 std::span<ScalarField> transformed_scalars,
                                                                  std::vector<uint32_t>& consolidated_indices) noexcept
 {
+    BB_ASSERT_EQ(scalars.size(), transformed_scalars.size());
     const size_t num_cpus = get_num_cpus();
 
     const size_t scalars_per_thread = numeric::ceil_div(scalars.size(), num_cpus);
@@ -70,8 +77,8 @@ void MSM<Curve>::transform_scalar_and_get_nonzero_scalar_indices(std::span<typen
             thread_scalar_indices.reserve(end - start);
             for (size_t i = start; i < end; ++i) {
                 BB_ASSERT_DEBUG(i < scalars.size());
-                auto& scalar = scalars[i];
-                scalar.self_from_montgomery_form();
+                auto& scalar = transformed_scalars[i];
+                scalar = scalars[i].from_montgomery_form();
 
                 bool is_zero =
                     (scalar.data[0] == 0) && (scalar.data[1] == 0) && (scalar.data[2] == 0) && (scalar.data[3] == 0);
@@ -102,83 +109,223 @@ void MSM<Curve>::transform_scalar_and_get_nonzero_scalar_indices(std::span<typen
     });
 }
 
+/**
+ * @brief Number of significant bits of a scalar that is *NOT* in Montgomery form (0 for zero)
+ *
+ * @tparam Curve
+ * @param scalar
+ * @return size_t
+ */
+template <typename Curve> size_t MSM<Curve>::get_scalar_bit_length(const ScalarField& scalar) noexcept
+{
+    for (size_t limb = 4; limb-- > 0;) {
+        if (scalar.data[limb] != 0) {
+            return (limb * 64) + static_cast<size_t>(numeric::get_msb(scalar.data[limb])) + 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Bucket the nonzero scalars of an MSM by bit length, moving the indices of the small ones to the front
+ * @details Witness polynomials are full of small values (booleans, range constrained limbs, lookup read counts...),
+ *          for which most of the rounds of a full-width Pippenger only add into bucket zero. We compute a histogram of
+ *          the bit lengths of the scalars and pick the bit length `b` that minimises the estimated cost of running a
+ *          Pippenger over the scalars of at most `b` bits with `b` bits' worth of rounds, plus one over the rest with
+ *          as many rounds as the largest scalar needs. When the small scalars fit in a single Pippenger window, their
+ *          MSM is a single round that buckets the points by scalar value.
+ *          If no split is worthwhile, `num_small_scalars` is 0 and the indices are left untouched.
+ *
+ * @tparam Curve
+ * @param scalars scalars *NOT* in Montgomery form
+ * @param scalar_indices indices of the nonzero scalars, reordered in place
+ * @return MSM<Curve>::BitLengthPartition
+ */
+template <typename Curve>
+typename MSM<Curve>::BitLengthPartition MSM<Curve>::partition_scalar_indices_by_bit_length(
+    std::span<const ScalarField> scalars, std::vector<uint32_t>& scalar_indices) noexcept
+{
+    using Histogram = std::array<size_t, NUM_BITS_IN_FIELD + 1>;
+    const size_t num_scalars = scalar_indices.size();
+    const size_t num_cpus = get_num_cpus();
+    const size_t scalars_per_thread = numeric::ceil_div(num_scalars, num_cpus);
+    auto get_thread_range = [&](size_t thread_idx) {
+        const size_t start = std::min(thread_idx * scalars_per_thread, num_scalars);
+        const size_t end = std::min(start + scalars_per_thread, num_scalars);
+        return std::make_pair(start, end);
+    };
+
+    std::vector<Histogram> thread_histograms(num_cpus, Histogram{});
+    parallel_for(num_cpus, [&](size_t thread_idx) {
+        auto [start, end] = get_thread_range(thread_idx);
+        Histogram& histogram = thread_histograms[thread_idx];
+        for (size_t i = start; i < end; ++i) {
+            BB_ASSERT_DEBUG(scalar_indices[i] < scalars.size());
+            histogram[get_scalar_bit_length(scalars[scalar_indices[i]])]++;
+        }
+    });
+    Histogram histogram{};
+    for (const Histogram& thread_histogram : thread_histograms) {
+        for (size_t bits = 0; bits <= NUM_BITS_IN_FIELD; ++bits) {
+            histogram[bits] += thread_histogram[bits];
+        }
+    }
+
+    size_t num_bits = NUM_BITS_IN_FIELD;
+    while (num_bits > 1 && histogram[num_bits] == 0) {
+        num_bits--;
+    }
+
+    // Each thread runs its own Pippenger over its share of the points, so that is what the cost model is applied to
+    auto get_cost = [&](size_t num_points, size_t bits) {
+        return get_msm_cost(numeric::ceil_div(num_points, num_cpus), bits);
+    };
+    size_t best_cost = get_cost(num_scalars, num_bits);
+    size_t small_num_bits = num_bits;
+    size_t num_small_scalars = 0;
+    for (size_t bits = 1; bits < num_bits; ++bits) {
+        num_small_scalars += histogram[bits];
+        if (histogram[bits] == 0) {
+            continue;
+        }
+        const size_t cost = get_cost(num_small_scalars, bits) + get_cost(num_scalars - num_small_scalars, num_bits);
+        if (cost < best_cost) {
+            best_cost = cost;
+            small_num_bits = bits;
+        }
+    }
+    if (small_num_bits == num_bits) {
+        return BitLengthPartition{ .num_small_scalars = 0, .small_num_bits = 0, .num_bits = num_bits };
+    }
+
+    // Stable partition of the indices: each thread scatters its range to its offsets in both halves
+    std::vector<size_t> thread_num_small(num_cpus, 0);
+    for (size_t thread_idx = 0; thread_idx < num_cpus; ++thread_idx) {
+        for (size_t bits = 0; bits <= small_num_bits; ++bits) {
+            thread_num_small[thread_idx] += thread_histograms[thread_idx][bits];
+        }
+    }
+    num_small_scalars = 0;
+    for (size_t bits = 0; bits <= small_num_bits; ++bits) {
+        num_small_scalars += histogram[bits];
+    }
+    std::vector<uint32_t> partitioned_indices(num_scalars);
+    parallel_for(num_cpus, [&](size_t thread_idx) {
+        auto [start, end] = get_thread_range(thread_idx);
+        size_t small_offset = 0;
+        for (size_t i = 0; i < thread_idx; ++i) {
+            small_offset += thread_num_small[i];
+        }
+        size_t large_offset = num_small_scalars + start - small_offset;
+        for (size_t i = start; i < end; ++i) {
+            const uint32_t index = scalar_indices[i];
+            if (get_scalar_bit_length(scalars[index]) <= small_num_bits) {
+                partitioned_indices[small_offset++] = index;
+            } else {
+                partitioned_indices[large_offset++] = index;
+            }
+        }
+    });
+    scalar_indices.swap(partitioned_indices);
+
+    return BitLengthPartition{
+        .num_small_scalars = num_small_scalars, .small_num_bits = small_num_bits, .num_bits = num_bits
+    };
+}
+
 /**
  * @brief Split a multiple multi-scalar-multiplication into equal units of work that can be processed by threads
  * @details The goal is to compute the total number of multiplications needed, and assign each thread a set of MSMs
  *          such that each thread performs equivalent work.
  *          We will split up an MSM into multiple MSMs if this is required.
+ *          If `bucket_by_bit_length` is set, each MSM is first split into its small and its full-width scalars (see
+ *          `partition_scalar_indices_by_bit_length`). The work of a point is then weighted by the number of bits
+ *          Pippenger processes for it.
  *
  * @tparam Curve
  * @param scalars
+ * @param transformed_scalars destination of the scalars converted out of Montgomery form, may alias `scalars`
  * @param msm_scalar_indices
+ * @param bucket_by_bit_length
  * @return std::vector<typename MSM<Curve>::ThreadWorkUnits>
  */
 template <typename Curve>
 std::vector<typename MSM<Curve>::ThreadWorkUnits> MSM<Curve>::get_work_units(
-    std::span<std::span<ScalarField>> scalars, std::vector<std::vector<uint32_t>>& msm_scalar_indices) noexcept
+    std::span<const std::span<const ScalarField>> scalars,
+    std::span<const std::span<ScalarField>> transformed_scalars,
+    std::vector<std::vector<uint32_t>>& msm_scalar_indices,
+    bool bucket_by_bit_length) noexcept
 {
 
     const size_t num_msms = scalars.size();
     msm_scalar_indices.resize(num_msms);
+    // Ranges of the nonzero scalar indices of each MSM with a common bound on the scalar bit length
+    std::vector<MSMWorkUnit> segments;
     for (size_t i = 0; i < num_msms; ++i) {
         BB_ASSERT_LT(i, scalars.size());
-        transform_scalar_and_get_nonzero_scalar_indices(scalars[i], msm_scalar_indices[i]);
+        transform_scalar_and_get_nonzero_scalar_indices(scalars[i], transformed_scalars[i], msm_scalar_indices[i]);
+        const size_t msm_size = msm_scalar_indices[i].size();
+        if (!bucket_by_bit_length) {
+            segments.push_back(MSMWorkUnit{ .batch_msm_index = i, .start_index = 0, .size = msm_size });
+            continue;
+        }
+        const BitLengthPartition partition =
+            partition_scalar_indices_by_bit_length(transformed_scalars[i], msm_scalar_indices[i]);
+        if (partition.num_small_scalars > 0) {
+            segments.push_back(MSMWorkUnit{ .batch_msm_index = i,
+                                            .start_index = 0,
+                                            .size = partition.num_small_scalars,
+                                            .num_bits = partition.small_num_bits });
+        }
+        segments.push_back(MSMWorkUnit{ .batch_msm_index = i,
+                                        .start_index = partition.num_small_scalars,
+                                        .size = msm_size - partition.num_small_scalars,
+                                        .num_bits = partition.num_bits });
     }
 
+    size_t total_points = 0;
     size_t total_work = 0;
-    for (const auto& indices : msm_scalar_indices) {
-        total_work += indices.size();
+    for (const MSMWorkUnit& segment : segments) {
+        total_points += segment.size;
+        total_work += segment.size * segment.num_bits;
     }
 
     const size_t num_threads = get_num_cpus();
     std::vector<ThreadWorkUnits> work_units(num_threads);
 
-    const size_t work_per_thread = numeric::ceil_div(total_work, num_threads);
-    size_t work_of_last_thread = total_work - (work_per_thread * (num_threads - 1));
-
-    // [(MSMs + T - 1) / T] * [T - 1] > MSMs
-    // T = 192
-    // ([M + 191] / 192) * 193 > M
     // only use a single work unit if we don't have enough work for every thread
-    if (num_threads > total_work) {
-        for (size_t i = 0; i < num_msms; ++i) {
-            work_units[0].push_back(MSMWorkUnit{
-                .batch_msm_index = i,
-                .start_index = 0,
-                .size = msm_scalar_indices[i].size(),
-            });
+    if (num_threads > total_points) {
+        for (const MSMWorkUnit& segment : segments) {
+            work_units[0].push_back(segment);
         }
         return work_units;
     }
 
+    // When all points have the same weight, every thread but the last gets ceil(total_points / num_threads) points
+    const size_t work_per_thread = numeric::ceil_div(total_work, num_threads);
     size_t thread_accumulated_work = 0;
     size_t current_thread_idx = 0;
-    for (size_t i = 0; i < num_msms; ++i) {
-        BB_ASSERT_DEBUG(i < msm_scalar_indices.size());
-        size_t msm_work = msm_scalar_indices[i].size();
-        size_t msm_size = msm_work;
-        while (msm_work > 0) {
-            const size_t total_thread_work =
-                (current_thread_idx == num_threads - 1) ? work_of_last_thread : work_per_thread;
-            const size_t available_thread_work = total_thread_work - thread_accumulated_work;
-
-            if (available_thread_work >= msm_work) {
-                BB_ASSERT_LT(current_thread_idx, work_units.size());
-                work_units[current_thread_idx].push_back(MSMWorkUnit{
-                    .batch_msm_index = i,
-                    .start_index = msm_size - msm_work,
-                    .size = msm_work,
-                });
-                thread_accumulated_work += msm_work;
-                msm_work = 0;
-            } else {
-                BB_ASSERT_LT(current_thread_idx, work_units.size());
+    for (const MSMWorkUnit& segment : segments) {
+        size_t segment_work = segment.size;
+        while (segment_work > 0) {
+            BB_ASSERT_LT(current_thread_idx, work_units.size());
+            // The last thread takes whatever work is left
+            const bool last_thread = current_thread_idx == num_threads - 1;
+            const size_t available_thread_work =
+                (thread_accumulated_work < work_per_thread) ? work_per_thread - thread_accumulated_work : 0;
+            const size_t num_points_available = numeric::ceil_div(available_thread_work, segment.num_bits);
+            const size_t num_points = last_thread ? segment_work : std::min(segment_work, num_points_available);
+            if (num_points > 0) {
                 work_units[current_thread_idx].push_back(MSMWorkUnit{
-                    .batch_msm_index = i,
-                    .start_index = msm_size - msm_work,
-                    .size = available_thread_work,
+                    .batch_msm_index = segment.batch_msm_index,
+                    .start_index = segment.start_index + segment.size - segment_work,
+                    .size = num_points,
+                    .num_bits = segment.num_bits,
                 });
-                msm_work -= available_thread_work;
+                thread_accumulated_work += num_points * segment.num_bits;
+                segment_work -= num_points;
+            }
+            if (segment_work > 0) {
                 current_thread_idx++;
                 thread_accumulated_work = 0;
             }
@@ -189,20 +336,23 @@ std::vector<typename MSM<Curve>::ThreadWorkUnits> MSM<Curve>::get_work_units(
 
 /**
  * @brief Given a scalar that is *NOT* in Montgomery form, extract a `slice_size`-bit chunk
- * @brief At round i, we extract `slice_size * (i-1)` to `slice_sice * i` most significant bits.
+ * @brief At round i, we extract `slice_size * (i-1)` to `slice_sice * i` most significant bits of the low `num_bits`
+ * bits of the scalar.
  *
  * @tparam Curve
  * @param scalar
  * @param round
  * @param normal_slice_size
+ * @param num_bits
  * @return uint32_t
  */
 template <typename Curve>
 uint32_t MSM<Curve>::get_scalar_slice(const typename Curve::ScalarField& scalar,
                                       size_t round,
-                                      size_t slice_size) noexcept
+                                      size_t slice_size,
+                                      size_t num_bits) noexcept
 {
-    size_t hi_bit = NUM_BITS_IN_FIELD - (round * slice_size);
+    size_t hi_bit = num_bits - (round * slice_size);
     // todo remove
     bool last_slice = hi_bit < slice_size;
     size_t target_slice_size = last_slice ? hi_bit : slice_size;
@@ -213,7 +363,9 @@ uint32_t MSM<Curve>::get_scalar_slice(const typename Curve::ScalarField& scalar,
     size_t lo_slice_bits = std::min(target_slice_size, 64 - lo_slice_offset);
     size_t hi_slice_bits = target_slice_size - lo_slice_bits;
     size_t lo_slice = (scalar.data[start_limb] >> lo_slice_offset) & ((static_cast<size_t>(1) << lo_slice_bits) - 1);
-    size_t hi_slice = (scalar.data[end_limb] & ((static_cast<size_t>(1) << hi_slice_bits) - 1));
+    // For a 256-bit field, the top slice ends on the limb boundary and `end_limb` is past the last limb
+    size_t hi_slice =
+        (hi_slice_bits == 0) ? 0 : (scalar.data[end_limb] & ((static_cast<size_t>(1) << hi_slice_bits) - 1));
 
     uint32_t lo = static_cast<uint32_t>(lo_slice);
     uint32_t hi = static_cast<uint32_t>(hi_slice);
@@ -222,25 +374,36 @@ uint32_t MSM<Curve>::get_scalar_slice(const typename Curve::ScalarField& scalar,
     return result;
 }
 
+namespace {
+// We do 2 group operations per bucket, and they are full 3D Jacobian adds which are ~2x more than an affine add
+constexpr size_t COST_OF_BUCKET_OP_RELATIVE_TO_POINT = 5;
+
+size_t get_pippenger_cost(const size_t num_points, const size_t num_bits, const size_t bit_slice)
+{
+    const size_t num_rounds = numeric::ceil_div(num_bits, bit_slice);
+    const size_t num_buckets = 1 << bit_slice;
+    const size_t addition_cost = num_rounds * num_points;
+    const size_t bucket_cost = num_rounds * num_buckets * COST_OF_BUCKET_OP_RELATIVE_TO_POINT;
+    return addition_cost + bucket_cost;
+}
+} // namespace
+
 /**
- * @brief For a given number of points, compute the optimal Pippenger bucket size
+ * @brief For a given number of points with scalars of at most `num_bits` bits, compute the optimal Pippenger bucket
+ * size
  *
  * @tparam Curve
  * @param num_points
+ * @param num_bits
  * @return constexpr size_t
  */
-template <typename Curve> size_t MSM<Curve>::get_optimal_log_num_buckets(const size_t num_points) noexcept
+template <typename Curve>
+size_t MSM<Curve>::get_optimal_log_num_buckets(const size_t num_points, const size_t num_bits) noexcept
 {
-    // We do 2 group operations per bucket, and they are full 3D Jacobian adds which are ~2x more than an affine add
-    constexpr size_t COST_OF_BUCKET_OP_RELATIVE_TO_POINT = 5;
     size_t cached_cost = static_cast<size_t>(-1);
     size_t target_bit_slice = 0;
     for (size_t bit_slice = 1; bit_slice < 20; ++bit_slice) {
-        const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bit_slice);
-        const size_t num_buckets = 1 << bit_slice;
-        const size_t addition_cost = num_rounds * num_points;
-        const size_t bucket_cost = num_rounds * num_buckets * COST_OF_BUCKET_OP_RELATIVE_TO_POINT;
-        const size_t total_cost = addition_cost + bucket_cost;
+        const size_t total_cost = get_pippenger_cost(num_points, num_bits, bit_slice);
         if (total_cost < cached_cost) {
             cached_cost = total_cost;
             target_bit_slice = bit_slice;
@@ -249,6 +412,23 @@ template <typename Curve> size_t MSM<Curve>::get_optimal_log_num_buckets(const s
     return target_bit_slice;
 }
 
+/**
+ * @brief Estimated cost, in point additions, of a Pippenger over `num_points` points with scalars of at most
+ * `num_bits` bits
+ *
+ * @tparam Curve
+ * @param num_points
+ * @param num_bits
+ * @return size_t
+ */
+template <typename Curve> size_t MSM<Curve>::get_msm_cost(const size_t num_points, const size_t num_bits) noexcept
+{
+    if (num_points == 0) {
+        return 0;
+    }
+    return get_pippenger_cost(num_points, num_bits, get_optimal_log_num_buckets(num_points, num_bits));
+}
+
 /**
  * @brief Given a number of points and an optimal bucket size, should we use the affine trick?
  *
@@ -381,12 +561,13 @@ typename Curve::Element MSM<Curve>::small_pippenger_low_memory_with_transformed_
 {
     std::span<const uint32_t>& nonzero_scalar_indices = msm_data.scalar_indices;
     const size_t size = nonzero_scalar_indices.size();
-    const size_t bits_per_slice = get_optimal_log_num_buckets(size);
+    const size_t bits_per_slice = get_optimal_log_num_buckets(size, msm_data.num_bits);
     const size_t num_buckets = 1 << bits_per_slice;
-    JacobianBucketAccumulators bucket_data = JacobianBucketAccumulators(num_buckets);
+    JacobianBucketAccumulators& bucket_data = get_thread_scratch_space().jacobian_bucket_data;
+    bucket_data.resize(num_buckets);
     Element round_output = Curve::Group::point_at_infinity;
 
-    const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
+    const size_t num_rounds = numeric::ceil_div(msm_data.num_bits, bits_per_slice);
 
     for (size_t i = 0; i < num_rounds; ++i) {
         round_output = evaluate_small_pippenger_round(msm_data, i, bucket_data, round_output, bits_per_slice);
@@ -405,20 +586,20 @@ template <typename Curve>
 typename Curve::Element MSM<Curve>::pippenger_low_memory_with_transformed_scalars(MSMData& msm_data) noexcept
 {
     const size_t msm_size = msm_data.scalar_indices.size();
-    const size_t bits_per_slice = get_optimal_log_num_buckets(msm_size);
+    const size_t bits_per_slice = get_optimal_log_num_buckets(msm_size, msm_data.num_bits);
     const size_t num_buckets = 1 << bits_per_slice;
 
     if (!use_affine_trick(msm_size, num_buckets)) {
         return small_pippenger_low_memory_with_transformed_scalars(msm_data);
     }
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/1452): Consider allowing this memory to persist rather
-    // than allocating/deallocating on every execution.
-    AffineAdditionData affine_data = AffineAdditionData();
-    BucketAccumulators bucket_data = BucketAccumulators(num_buckets);
+    ThreadScratchSpace& scratch_space = get_thread_scratch_space();
+    AffineAdditionData& affine_data = scratch_space.affine_data;
+    BucketAccumulators& bucket_data = scratch_space.bucket_data;
+    bucket_data.resize(num_buckets);
 
     Element round_output = Curve::Group::point_at_infinity;
 
-    const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
+    const size_t num_rounds = numeric::ceil_div(msm_data.num_bits, bits_per_slice);
     for (size_t i = 0; i < num_rounds; ++i) {
         round_output = evaluate_pippenger_round(msm_data, i, affine_data, bucket_data, round_output, bits_per_slice);
     }
@@ -451,7 +632,8 @@ typename Curve::Element MSM<Curve>::evaluate_small_pippenger_round(MSMData& msm_
     const size_t size = nonzero_scalar_indices.size();
     for (size_t i = 0; i < size; ++i) {
         BB_ASSERT_DEBUG(nonzero_scalar_indices[i] < scalars.size());
-        uint32_t bucket_index = get_scalar_slice(scalars[nonzero_scalar_indices[i]], round_index, bits_per_slice);
+        uint32_t bucket_index =
+            get_scalar_slice(scalars[nonzero_scalar_indices[i]], round_index, bits_per_slice, msm_data.num_bits);
         BB_ASSERT_DEBUG(bucket_index < static_cast<uint32_t>(1 << bits_per_slice));
         if (bucket_index > 0) {
             // do this check because we do not reset bucket_data.buckets after each round
@@ -469,9 +651,10 @@ typename Curve::Element MSM<Curve>::evaluate_small_pippenger_round(MSMData& msm_
     round_output = accumulate_buckets(bucket_data);
     bucket_data.bucket_exists.clear();
     Element result = previous_round_output;
-    const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
-    size_t num_doublings = ((round_index == num_rounds - 1) && (NUM_BITS_IN_FIELD % bits_per_slice != 0))
-                               ? NUM_BITS_IN_FIELD % bits_per_slice
+    const size_t num_bits = msm_data.num_bits;
+    const size_t num_rounds = numeric::ceil_div(num_bits, bits_per_slice);
+    size_t num_doublings = ((round_index == num_rounds - 1) && (num_bits % bits_per_slice != 0))
+                               ? num_bits % bits_per_slice
                                : bits_per_slice;
     for (size_t i = 0; i < num_doublings; ++i) {
         result.self_dbl();
@@ -512,7 +695,8 @@ typename Curve::Element MSM<Curve>::evaluate_pippenger_round(MSMData& msm_data,
     // 2. high 32 bits: which point index do we source the point from?
     for (size_t i = 0; i < size; ++i) {
         BB_ASSERT_DEBUG(scalar_indices[i] < scalars.size());
-        round_schedule[i] = get_scalar_slice(scalars[scalar_indices[i]], round_index, bits_per_slice);
+        round_schedule[i] =
+            get_scalar_slice(scalars[scalar_indices[i]], round_index, bits_per_slice, msm_data.num_bits);
         round_schedule[i] += (static_cast<uint64_t>(scalar_indices[i]) << 32ULL);
     }
     // Sort our point schedules based on their bucket values. Reduces memory throughput in next step of algo
@@ -533,9 +717,10 @@ typename Curve::Element MSM<Curve>::evaluate_pippenger_round(MSMData& msm_data,
     }
 
     Element result = previous_round_output;
-    const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
-    size_t num_doublings = ((round_index == num_rounds - 1) && (NUM_BITS_IN_FIELD % bits_per_slice != 0))
-                               ? NUM_BITS_IN_FIELD % bits_per_slice
+    const size_t num_bits = msm_data.num_bits;
+    const size_t num_rounds = numeric::ceil_div(num_bits, bits_per_slice);
+    size_t num_doublings = ((round_index == num_rounds - 1) && (num_bits % bits_per_slice != 0))
+                               ? num_bits % bits_per_slice
                                : bits_per_slice;
     for (size_t i = 0; i < num_doublings; ++i) {
         result.self_dbl();
@@ -748,29 +933,64 @@ void MSM<Curve>::consume_point_schedule(std::span<const uint64_t> point_schedule
 }
 
 /**
- * @brief Compute multiple multi-scalar multiplications.
- * @details If we need to perform multiple MSMs, this method will be more efficient than calling `msm` repeatedly
- *          This is because this method will be able to dispatch equal work to all threads without splitting the input
- *          msms up so much.
- *          The Pippenger algorithm runtime is O(N/log(N)) so there will be slight gains as each inner-thread MSM will
- *          have a larger N
+ * @brief The Pippenger scratch space of the calling thread
+ * @details Every thread of the pool keeps its own, so that MSMs stop paying for the allocation of their bucket and
+ * schedule buffers once the pool threads have run a few.
+ *
+ * @tparam Curve
+ * @return MSM<Curve>::ThreadScratchSpace&
+ */
+template <typename Curve> typename MSM<Curve>::ThreadScratchSpace& MSM<Curve>::get_thread_scratch_space() noexcept
+{
+    static thread_local ThreadScratchSpace scratch_space;
+    return scratch_space;
+}
+
+template <typename Curve> void MSM<Curve>::ThreadScratchSpace::release_oversized_buffers() noexcept
+{
+    if (bucket_data.buckets.capacity() > MAX_POOLED_BUCKETS) {
+        bucket_data = BucketAccumulators(0);
+    }
+    if (jacobian_bucket_data.buckets.capacity() > MAX_POOLED_BUCKETS) {
+        jacobian_bucket_data = JacobianBucketAccumulators(0);
+    }
+    if (point_schedule.capacity() > MAX_POOLED_SCALARS) {
+        point_schedule = std::vector<uint64_t>();
+    }
+}
+
+template <typename Curve> void MSM<Curve>::ConvertedScalars::release_oversized_buffers() noexcept
+{
+    if (scalars.capacity() > MAX_POOLED_SCALARS) {
+        scalars = std::vector<ScalarField>();
+    }
+    for (auto& indices : nonzero_indices) {
+        if (indices.capacity() > MAX_POOLED_SCALARS) {
+            indices = std::vector<uint32_t>();
+        }
+    }
+}
+
+/**
+ * @brief Evaluate the work units of a batch MSM, whose scalars have been converted out of Montgomery form
  *
  * @tparam Curve
  * @param points
- * @param scalars
+ * @param transformed_scalars
+ * @param msm_scalar_indices
+ * @param thread_work_units
+ * @param handle_edge_cases
  * @return std::vector<typename Curve::AffineElement>
  */
 template <typename Curve>
-std::vector<typename Curve::AffineElement> MSM<Curve>::batch_multi_scalar_mul(
+std::vector<typename Curve::AffineElement> MSM<Curve>::evaluate_work_units(
     std::span<std::span<const typename Curve::AffineElement>> points,
-    std::span<std::span<ScalarField>> scalars,
+    std::span<const std::span<ScalarField>> transformed_scalars,
+    std::span<const std::vector<uint32_t>> msm_scalar_indices,
+    std::span<const ThreadWorkUnits> thread_work_units,
     bool handle_edge_cases) noexcept
 {
-    BB_ASSERT_EQ(points.size(), scalars.size());
     const size_t num_msms = points.size();
-
-    std::vector<std::vector<uint32_t>> msm_scalar_indices;
-    std::vector<ThreadWorkUnits> thread_work_units = get_work_units(scalars, msm_scalar_indices);
     const size_t num_cpus = get_num_cpus();
     std::vector<std::vector<std::pair<Element, size_t>>> thread_msm_results(num_cpus);
     BB_ASSERT_EQ(thread_work_units.size(), num_cpus);
@@ -780,13 +1000,18 @@ std::vector<typename Curve::AffineElement> MSM<Curve>::batch_multi_scalar_mul(
         if (!thread_work_units[thread_idx].empty()) {
             const std::vector<MSMWorkUnit>& msms = thread_work_units[thread_idx];
             std::vector<std::pair<Element, size_t>>& msm_results = thread_msm_results[thread_idx];
+            ThreadScratchSpace& scratch_space = get_thread_scratch_space();
             for (const MSMWorkUnit& msm : msms) {
-                std::span<const ScalarField> work_scalars = scalars[msm.batch_msm_index];
+                std::span<const ScalarField> work_scalars = transformed_scalars[msm.batch_msm_index];
                 std::span<const AffineElement> work_points = points[msm.batch_msm_index];
                 std::span<const uint32_t> work_indices =
                     std::span<const uint32_t>{ &msm_scalar_indices[msm.batch_msm_index][msm.start_index], msm.size };
-                std::vector<uint64_t> point_schedule(msm.size);
-                MSMData msm_data(work_scalars, work_points, work_indices, std::span<uint64_t>(point_schedule));
+                scratch_space.point_schedule.resize(msm.size);
+                MSMData msm_data(work_scalars,
+                                 work_points,
+                                 work_indices,
+                                 std::span<uint64_t>(scratch_space.point_schedule),
+                                 msm.num_bits);
                 Element msm_result = Curve::Group::point_at_infinity;
                 constexpr size_t SINGLE_MUL_THRESHOLD = 16;
                 if (msm.size < SINGLE_MUL_THRESHOLD) {
@@ -802,6 +1027,7 @@ std::vector<typename Curve::AffineElement> MSM<Curve>::batch_multi_scalar_mul(
                 }
                 msm_results.push_back(std::make_pair(msm_result, msm.batch_msm_index));
             }
+            scratch_space.release_oversized_buffers();
         }
     });
 
@@ -823,6 +1049,45 @@ std::vector<typename Curve::AffineElement> MSM<Curve>::batch_multi_scalar_mul(
     for (const auto& ele : results) {
         affine_results.emplace_back(AffineElement(ele.x, ele.y));
     }
+    return affine_results;
+}
+
+/**
+ * @brief Compute multiple multi-scalar multiplications.
+ * @details If we need to perform multiple MSMs, this method will be more efficient than calling `msm` repeatedly
+ *          This is because this method will be able to dispatch equal work to all threads without splitting the input
+ *          msms up so much.
+ *          The Pippenger algorithm runtime is O(N/log(N)) so there will be slight gains as each inner-thread MSM will
+ *          have a larger N
+ *
+ *          If `bucket_by_bit_length` is set, the small scalars of each MSM only go through the Pippenger rounds
+ *          their bit length needs, see `partition_scalar_indices_by_bit_length`.
+ *
+ *          The scalars are converted out of Montgomery form in place and converted back at the end, which saves
+ *          copying them for large MSMs. Use the overload taking const scalars when they must not be written to.
+ *
+ * @tparam Curve
+ * @param points
+ * @param scalars
+ * @param handle_edge_cases
+ * @param bucket_by_bit_length
+ * @return std::vector<typename Curve::AffineElement>
+ */
+template <typename Curve>
+std::vector<typename Curve::AffineElement> MSM<Curve>::batch_multi_scalar_mul(
+    std::span<std::span<const typename Curve::AffineElement>> points,
+    std::span<std::span<ScalarField>> scalars,
+    bool handle_edge_cases,
+    bool bucket_by_bit_length) noexcept
+{
+    BB_ASSERT_EQ(points.size(), scalars.size());
+
+    std::vector<std::span<const ScalarField>> input_scalars(scalars.begin(), scalars.end());
+    std::vector<std::vector<uint32_t>> msm_scalar_indices;
+    std::vector<ThreadWorkUnits> thread_work_units =
+        get_work_units(input_scalars, scalars, msm_scalar_indices, bucket_by_bit_length);
+    std::vector<AffineElement> affine_results =
+        evaluate_work_units(points, scalars, msm_scalar_indices, thread_work_units, handle_edge_cases);
 
     // Convert our scalars back into Montgomery form so they remain unchanged
     for (auto& msm_scalars : scalars) {
@@ -835,33 +1100,94 @@ std::vector<typename Curve::AffineElement> MSM<Curve>::batch_multi_scalar_mul(
     return affine_results;
 }
 
+/**
+ * @brief Compute multiple multi-scalar multiplications without writing to the scalars
+ * @details The scalars are converted out of Montgomery form into scratch space of the calling thread, which is kept
+ *          for the next call unless it grew beyond `MAX_POOLED_SCALARS`. Together with the per-thread Pippenger
+ *          buffers, small and medium MSMs thus run without allocating, converting the inputs in place or restoring
+ *          them.
+ *
+ * @tparam Curve
+ * @param points
+ * @param scalars
+ * @param handle_edge_cases
+ * @param bucket_by_bit_length
+ * @return std::vector<typename Curve::AffineElement>
+ */
+template <typename Curve>
+std::vector<typename Curve::AffineElement> MSM<Curve>::batch_multi_scalar_mul(
+    std::span<std::span<const typename Curve::AffineElement>> points,
+    std::span<std::span<const ScalarField>> scalars,
+    bool handle_edge_cases,
+    bool bucket_by_bit_length) noexcept
+{
+    BB_ASSERT_EQ(points.size(), scalars.size());
+
+    static thread_local ConvertedScalars pooled_scalars;
+    // Don't let a re-entrant call on this thread clobber the pooled buffers
+    std::optional<ConvertedScalars> nested_scalars;
+    ConvertedScalars& converted = pooled_scalars.in_use ? nested_scalars.emplace() : pooled_scalars;
+    converted.in_use = true;
+
+    size_t total_num_scalars = 0;
+    for (const auto& msm_scalars : scalars) {
+        total_num_scalars += msm_scalars.size();
+    }
+    converted.scalars.resize(total_num_scalars);
+    std::vector<std::span<ScalarField>> transformed_scalars;
+    size_t offset = 0;
+    for (const auto& msm_scalars : scalars) {
+        transformed_scalars.emplace_back(converted.scalars.data() + offset, msm_scalars.size());
+        offset += msm_scalars.size();
+    }
+
+    std::vector<ThreadWorkUnits> thread_work_units =
+        get_work_units(scalars, transformed_scalars, converted.nonzero_indices, bucket_by_bit_length);
+    std::vector<AffineElement> affine_results = evaluate_work_units(
+        points, transformed_scalars, converted.nonzero_indices, thread_work_units, handle_edge_cases);
+
+    converted.release_oversized_buffers();
+    converted.in_use = false;
+    return affine_results;
+}
+
 /**
  * @brief Helper method to evaluate a single MSM. Internally calls `batch_multi_scalar_mul`
+ * @details MSMs of up to `MAX_POOLED_SCALARS` scalars leave them untouched. Larger ones convert them in place, so as
+ * not to copy large polynomials, and restore them at the end.
  *
  * @tparam Curve
  * @param points
  * @param _scalars
+ * @param handle_edge_cases
+ * @param bucket_by_bit_length
  * @return Curve::AffineElement
  */
 template <typename Curve>
 typename Curve::AffineElement MSM<Curve>::msm(std::span<const typename Curve::AffineElement> points,
                                               PolynomialSpan<const ScalarField> _scalars,
-                                              bool handle_edge_cases) noexcept
+                                              bool handle_edge_cases,
+                                              bool bucket_by_bit_length) noexcept
 {
     if (_scalars.size() == 0) {
         return Curve::Group::affine_point_at_infinity;
     }
     BB_ASSERT_GTE(points.size(), _scalars.start_index + _scalars.size());
 
+    std::vector<std::span<const AffineElement>> pp{ points.subspan(_scalars.start_index) };
+    if (_scalars.size() <= MAX_POOLED_SCALARS) {
+        std::vector<std::span<const ScalarField>> ss{ _scalars.span };
+        return batch_multi_scalar_mul(pp, ss, handle_edge_cases, bucket_by_bit_length)[0];
+    }
+
     // unfortnately we need to remove const on this data type to prevent duplicating _scalars (which is typically
     // large) We need to convert `_scalars` out of montgomery form for the MSM. We then convert the scalars back
     // into Montgomery form at the end of the algorithm. NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1449): handle const correctness.
     ScalarField* scalars = const_cast<ScalarField*>(&_scalars[_scalars.start_index]);
 
-    std::vector<std::span<const AffineElement>> pp{ points.subspan(_scalars.start_index) };
     std::vector<std::span<ScalarField>> ss{ std::span<ScalarField>(scalars, _scalars.size()) };
-    AffineElement result = batch_multi_scalar_mul(pp, ss, handle_edge_cases)[0];
+    AffineElement result = batch_multi_scalar_mul(pp, ss, handle_edge_cases, bucket_by_bit_length)[0];
     return result;
 }
 
@@ -898,3 +1224,5 @@ template curve::BN254::Element pippenger_unsafe<curve::BN254>(PolynomialSpan<con
 
 template class bb::scalar_multiplication::MSM<bb::curve::Grumpkin>;
 template class bb::scalar_multiplication::MSM<bb::curve::BN254>;
+template class bb::scalar_multiplication::MSM<bb::curve::SECP256K1>;
+template class bb::scalar_multiplication::MSM<bb::curve::SECP256R1>;
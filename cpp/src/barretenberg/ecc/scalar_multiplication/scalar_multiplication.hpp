@@ -1,9 +1,13 @@
 #pragma once
 #include "barretenberg/ecc/groups/precomputed_generators_bn254_impl.hpp"
 #include "barretenberg/ecc/groups/precomputed_generators_grumpkin_impl.hpp"
+#include "barretenberg/ecc/groups/precomputed_generators_secp256k1_impl.hpp"
+#include "barretenberg/ecc/groups/precomputed_generators_secp256r1_impl.hpp"
 
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/curves/secp256k1/secp256k1.hpp"
+#include "barretenberg/ecc/curves/secp256r1/secp256r1.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 
 #include "./process_buckets.hpp"
@@ -33,6 +37,8 @@ template <typename Curve> class MSM {
         size_t batch_msm_index = 0;
         size_t start_index = 0;
         size_t size = 0;
+        // upper bound on the bit length of the scalars in the unit, i.e. the number of bits Pippenger has to process
+        size_t num_bits = NUM_BITS_IN_FIELD;
     };
     using ThreadWorkUnits = std::vector<MSMWorkUnit>;
 
@@ -41,6 +47,18 @@ template <typename Curve> class MSM {
         std::span<const AffineElement> points;
         std::span<const uint32_t> scalar_indices;
         std::span<uint64_t> point_schedule;
+        size_t num_bits = NUM_BITS_IN_FIELD;
+    };
+
+    /**
+     * @brief Result of bucketing the nonzero scalars of an MSM by bit length
+     * @details The first `num_small_scalars` indices refer to scalars of at most `small_num_bits` bits, the remaining
+     *          ones to scalars of at most `num_bits` bits.
+     */
+    struct BitLengthPartition {
+        size_t num_small_scalars = 0;
+        size_t small_num_bits = 0;
+        size_t num_bits = NUM_BITS_IN_FIELD;
     };
 
     /**
@@ -54,6 +72,12 @@ template <typename Curve> class MSM {
             : buckets(num_buckets)
             , bucket_exists(num_buckets)
         {}
+
+        void resize(size_t num_buckets) noexcept
+        {
+            buckets.resize(num_buckets);
+            bucket_exists.resize(num_buckets);
+        }
     };
 
     struct JacobianBucketAccumulators {
@@ -64,6 +88,12 @@ template <typename Curve> class MSM {
             : buckets(num_buckets)
             , bucket_exists(num_buckets)
         {}
+
+        void resize(size_t num_buckets) noexcept
+        {
+            buckets.resize(num_buckets);
+            bucket_exists.resize(num_buckets);
+        }
     };
     /**
      * @brief Temp data structure, one created per thread!
@@ -82,6 +112,36 @@ template <typename Curve> class MSM {
             , addition_result_bucket_destinations(((BATCH_SIZE + BATCH_OVERFLOW_SIZE) / 2))
         {}
     };
+
+    // Largest buffers the scratch spaces below keep between MSMs. Larger MSMs allocate what they need beyond that, at a
+    // cost that is negligible next to their group operations.
+    static constexpr size_t MAX_POOLED_SCALARS = 1 << 16;
+    static constexpr size_t MAX_POOLED_BUCKETS = 1 << 14;
+
+    /**
+     * @brief Pippenger buffers of one thread, kept alive across MSMs
+     */
+    struct ThreadScratchSpace {
+        AffineAdditionData affine_data;
+        BucketAccumulators bucket_data{ 0 };
+        JacobianBucketAccumulators jacobian_bucket_data{ 0 };
+        std::vector<uint64_t> point_schedule;
+
+        void release_oversized_buffers() noexcept;
+    };
+    static ThreadScratchSpace& get_thread_scratch_space() noexcept;
+
+    /**
+     * @brief Copies of the scalars of a non-mutating batch MSM, converted out of Montgomery form, and the indices of
+     * the nonzero ones
+     */
+    struct ConvertedScalars {
+        std::vector<ScalarField> scalars;
+        std::vector<std::vector<uint32_t>> nonzero_indices;
+        bool in_use = false;
+
+        void release_oversized_buffers() noexcept;
+    };
     static size_t get_num_rounds(size_t num_points) noexcept
     {
         const size_t bits_per_slice = get_optimal_log_num_buckets(num_points);
@@ -91,13 +151,30 @@ template <typename Curve> class MSM {
     static void add_affine_points(AffineElement* points,
                                   const size_t num_points,
                                   typename Curve::BaseField* scratch_space) noexcept;
-    static void transform_scalar_and_get_nonzero_scalar_indices(std::span<typename Curve::ScalarField> scalars,
+    static void transform_scalar_and_get_nonzero_scalar_indices(std::span<const ScalarField> scalars,
+                                                                std::span<ScalarField> transformed_scalars,
                                                                 std::vector<uint32_t>& consolidated_indices) noexcept;
+    static void transform_scalar_and_get_nonzero_scalar_indices(std::span<ScalarField> scalars,
+                                                                std::vector<uint32_t>& consolidated_indices) noexcept
+    {
+        transform_scalar_and_get_nonzero_scalar_indices(scalars, scalars, consolidated_indices);
+    }
+
+    static size_t get_scalar_bit_length(const ScalarField& scalar) noexcept;
+    static BitLengthPartition partition_scalar_indices_by_bit_length(std::span<const ScalarField> scalars,
+                                                                     std::vector<uint32_t>& scalar_indices) noexcept;
 
-    static std::vector<ThreadWorkUnits> get_work_units(std::span<std::span<ScalarField>> scalars,
-                                                       std::vector<std::vector<uint32_t>>& msm_scalar_indices) noexcept;
-    static uint32_t get_scalar_slice(const ScalarField& scalar, size_t round, size_t normal_slice_size) noexcept;
-    static size_t get_optimal_log_num_buckets(const size_t num_points) noexcept;
+    static std::vector<ThreadWorkUnits> get_work_units(std::span<const std::span<const ScalarField>> scalars,
+                                                       std::span<const std::span<ScalarField>> transformed_scalars,
+                                                       std::vector<std::vector<uint32_t>>& msm_scalar_indices,
+                                                       bool bucket_by_bit_length = false) noexcept;
+    static uint32_t get_scalar_slice(const ScalarField& scalar,
+                                     size_t round,
+                                     size_t normal_slice_size,
+                                     size_t num_bits = NUM_BITS_IN_FIELD) noexcept;
+    static size_t get_optimal_log_num_buckets(const size_t num_points,
+                                              const size_t num_bits = NUM_BITS_IN_FIELD) noexcept;
+    static size_t get_msm_cost(const size_t num_points, const size_t num_bits) noexcept;
     static bool use_affine_trick(const size_t num_points, const size_t num_buckets) noexcept;
 
     static Element small_pippenger_low_memory_with_transformed_scalars(MSMData& msm_data) noexcept;
@@ -122,12 +199,24 @@ template <typename Curve> class MSM {
                                        size_t num_input_points_processed,
                                        size_t num_queued_affine_points) noexcept;
 
+    static std::vector<AffineElement> evaluate_work_units(std::span<std::span<const AffineElement>> points,
+                                                          std::span<const std::span<ScalarField>> transformed_scalars,
+                                                          std::span<const std::vector<uint32_t>> msm_scalar_indices,
+                                                          std::span<const ThreadWorkUnits> thread_work_units,
+                                                          bool handle_edge_cases) noexcept;
+
     static std::vector<AffineElement> batch_multi_scalar_mul(std::span<std::span<const AffineElement>> points,
                                                              std::span<std::span<ScalarField>> scalars,
-                                                             bool handle_edge_cases = true) noexcept;
+                                                             bool handle_edge_cases = true,
+                                                             bool bucket_by_bit_length = false) noexcept;
+    static std::vector<AffineElement> batch_multi_scalar_mul(std::span<std::span<const AffineElement>> points,
+                                                             std::span<std::span<const ScalarField>> scalars,
+                                                             bool handle_edge_cases = true,
+                                                             bool bucket_by_bit_length = false) noexcept;
     static AffineElement msm(std::span<const AffineElement> points,
                              PolynomialSpan<const ScalarField> _scalars,
-                             bool handle_edge_cases = false) noexcept;
+                             bool handle_edge_cases = false,
+                             bool bucket_by_bit_length = false) noexcept;
 
     template <typename BucketType> static Element accumulate_buckets(BucketType& bucket_accumulators) noexcept
     {
@@ -154,6 +243,10 @@ template <typename Curve> class MSM {
         if constexpr (std::same_as<typename Curve::Group, bb::g1>) {
             constexpr auto gen = get_precomputed_generators<typename Curve::Group, "ECCVM_OFFSET_GENERATOR", 1>()[0];
             offset_generator = gen;
+        } else if constexpr (std::same_as<typename Curve::Group, secp256k1::g1> ||
+                             std::same_as<typename Curve::Group, secp256r1::g1>) {
+            constexpr auto gen = get_precomputed_generators<typename Curve::Group, "biggroup offset generator", 1>()[0];
+            offset_generator = gen;
         } else {
             constexpr auto gen = get_precomputed_generators<typename Curve::Group, "DEFAULT_DOMAIN_SEPARATOR", 8>()[0];
             offset_generator = gen;
@@ -182,6 +275,8 @@ typename Curve::Element pippenger_unsafe(PolynomialSpan<const typename Curve::Sc
 
 extern template class MSM<curve::Grumpkin>;
 extern template class MSM<curve::BN254>;
+extern template class MSM<curve::SECP256K1>;
+extern template class MSM<curve::SECP256R1>;
 
 // NEXT STEP ACCUMULATE BUVKETS
 } // namespace bb::scalar_multiplication
@@ -7,6 +7,8 @@
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <gtest/gtest.h>
 
@@ -71,7 +73,8 @@ template <class Curve> class ScalarMultiplicationTest : public ::testing::Test {
     };
 };
 
-using CurveTypes = ::testing::Types<bb::curve::BN254, bb::curve::Grumpkin>;
+using CurveTypes =
+    ::testing::Types<bb::curve::BN254, bb::curve::Grumpkin, bb::curve::SECP256K1, bb::curve::SECP256R1>;
 TYPED_TEST_SUITE(ScalarMultiplicationTest, CurveTypes);
 
 #define SCALAR_MULTIPLICATION_TYPE_ALIASES                                                                             \
@@ -82,7 +85,7 @@ TYPED_TEST_SUITE(ScalarMultiplicationTest, CurveTypes);
 TYPED_TEST(ScalarMultiplicationTest, GetScalarSlice)
 {
     SCALAR_MULTIPLICATION_TYPE_ALIASES
-    const size_t fr_size = 254;
+    const size_t fr_size = scalar_multiplication::MSM<Curve>::NUM_BITS_IN_FIELD;
     const size_t slice_bits = 7;
     size_t num_slices = (fr_size + 6) / 7;
     size_t last_slice_bits = fr_size - ((num_slices - 1) * slice_bits);
@@ -281,7 +284,7 @@ TYPED_TEST(ScalarMultiplicationTest, EvaluatePippengerRound)
 
     const size_t num_points = 2;
     std::vector<ScalarField> scalars(num_points);
-    constexpr size_t NUM_BITS_IN_FIELD = fr::modulus.get_msb() + 1;
+    constexpr size_t NUM_BITS_IN_FIELD = scalar_multiplication::MSM<Curve>::NUM_BITS_IN_FIELD;
     const size_t normal_slice_size = 7; // stop hardcoding
     const size_t num_buckets = 1 << normal_slice_size;
 
@@ -431,6 +434,149 @@ TYPED_TEST(ScalarMultiplicationTest, BatchMultiScalarMulSparse)
     EXPECT_EQ(result, expected);
 }
 
+TYPED_TEST(ScalarMultiplicationTest, BatchMultiScalarMulByBitLength)
+{
+    SCALAR_MULTIPLICATION_TYPE_ALIASES
+    using AffineElement = typename Curve::AffineElement;
+
+    // Mixes of scalar bit lengths found in witness polynomials: selectors, range constrained limbs, lookup read
+    // counts, 64-bit values, with a varying fraction of full-width field elements
+    const std::vector<uint64_t> small_value_bounds{ 2, 1 << 14, 1 << 20, 0 };
+    const std::vector<size_t> num_large_per_thousand{ 0, 10, 300, 1000 };
+    const size_t num_points = 5000;
+
+    std::vector<std::vector<ScalarField>> batch_scalars;
+    std::vector<std::span<const AffineElement>> batch_points_span;
+    std::vector<std::span<ScalarField>> batch_scalars_spans;
+    std::vector<AffineElement> expected;
+    size_t fixture_offset = 0;
+    for (const uint64_t bound : small_value_bounds) {
+        for (const size_t num_large : num_large_per_thousand) {
+            std::vector<ScalarField>& scalars = batch_scalars.emplace_back(num_points);
+            for (auto& scalar : scalars) {
+                const uint64_t value = engine.get_random_uint64();
+                if (static_cast<size_t>(engine.get_random_uint16() % 1000) < num_large) {
+                    scalar = ScalarField::random_element(&engine);
+                } else {
+                    scalar = ScalarField(bound == 0 ? value : value % bound);
+                }
+            }
+            ASSERT_LT(fixture_offset + num_points, TestFixture::num_points);
+            std::span<const AffineElement> points(&TestFixture::generators[fixture_offset], num_points);
+            fixture_offset += num_points;
+            batch_points_span.push_back(points);
+            expected.push_back(TestFixture::naive_msm(scalars, points));
+        }
+    }
+    for (auto& scalars : batch_scalars) {
+        batch_scalars_spans.push_back(scalars);
+    }
+
+    for (const bool handle_edge_cases : { false, true }) {
+        std::vector<AffineElement> result = scalar_multiplication::MSM<Curve>::batch_multi_scalar_mul(
+            batch_points_span, batch_scalars_spans, handle_edge_cases, /*bucket_by_bit_length=*/true);
+        EXPECT_EQ(result, expected);
+    }
+
+    // Each MSM on its own, i.e. with all threads working on it
+    for (size_t i = 0; i < batch_scalars.size(); ++i) {
+        AffineElement result = scalar_multiplication::MSM<Curve>::msm(batch_points_span[i],
+                                                                      PolynomialSpan<ScalarField>(0, batch_scalars[i]),
+                                                                      /*handle_edge_cases=*/false,
+                                                                      /*bucket_by_bit_length=*/true);
+        EXPECT_EQ(result, expected[i]);
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTest, BatchMultiScalarMulConstScalars)
+{
+    SCALAR_MULTIPLICATION_TYPE_ALIASES
+    using AffineElement = typename Curve::AffineElement;
+    using MSM = scalar_multiplication::MSM<Curve>;
+
+    // Sizes below and above the pooled scratch space, so that both reuse and release of the buffers are exercised
+    const std::vector<size_t> msm_sizes{ 0, 10, 1000, 5000, MSM::MAX_POOLED_SCALARS + 17 };
+    std::vector<std::span<const AffineElement>> batch_points_span;
+    std::vector<std::span<const ScalarField>> batch_scalars_spans;
+    std::vector<AffineElement> expected;
+    size_t fixture_offset = 0;
+    for (const size_t msm_size : msm_sizes) {
+        ASSERT_LT(fixture_offset + msm_size, TestFixture::num_points);
+        std::span<ScalarField> scalars(&TestFixture::scalars[fixture_offset], msm_size);
+        std::span<const AffineElement> points(&TestFixture::generators[fixture_offset], msm_size);
+        fixture_offset += msm_size;
+        batch_points_span.push_back(points);
+        batch_scalars_spans.push_back(scalars);
+        expected.push_back(TestFixture::naive_msm(scalars, points));
+    }
+    // The scalars must not even be rewritten in another representation
+    const std::vector<ScalarField> scalars_before(
+        TestFixture::scalars.begin(), TestFixture::scalars.begin() + static_cast<std::ptrdiff_t>(fixture_offset));
+    const auto expect_scalars_untouched = [&]() {
+        EXPECT_EQ(std::memcmp(TestFixture::scalars.data(), scalars_before.data(), fixture_offset * sizeof(ScalarField)),
+                  0);
+    };
+
+    for (const bool bucket_by_bit_length : { false, true }) {
+        std::vector<AffineElement> result = MSM::batch_multi_scalar_mul(
+            batch_points_span, batch_scalars_spans, /*handle_edge_cases=*/false, bucket_by_bit_length);
+        EXPECT_EQ(result, expected);
+        expect_scalars_untouched();
+    }
+    // Each small MSM on its own, reusing the scratch space of the batch
+    for (size_t i = 0; i < 4; ++i) {
+        AffineElement result = MSM::msm(batch_points_span[i],
+                                        PolynomialSpan<const ScalarField>(0, batch_scalars_spans[i]),
+                                        /*handle_edge_cases=*/true);
+        EXPECT_EQ(result, expected[i]);
+    }
+    expect_scalars_untouched();
+}
+
+TYPED_TEST(ScalarMultiplicationTest, PartitionScalarIndicesByBitLength)
+{
+    SCALAR_MULTIPLICATION_TYPE_ALIASES
+    using MSM = scalar_multiplication::MSM<Curve>;
+
+    // Mostly booleans with a few full-width scalars: the booleans are worth a separate single round
+    const size_t num_scalars = 1 << 12;
+    std::vector<ScalarField> scalars(num_scalars);
+    std::vector<uint32_t> indices(num_scalars);
+    for (size_t i = 0; i < num_scalars; ++i) {
+        scalars[i] = (i % 64 == 0) ? ScalarField::random_element(&engine) : ScalarField(1);
+        scalars[i].self_from_montgomery_form();
+        indices[i] = static_cast<uint32_t>(i);
+    }
+    auto partition = MSM::partition_scalar_indices_by_bit_length(scalars, indices);
+    EXPECT_EQ(partition.small_num_bits, 1UL);
+    EXPECT_EQ(partition.num_small_scalars, num_scalars - (num_scalars / 64));
+    EXPECT_LE(partition.num_bits, MSM::NUM_BITS_IN_FIELD);
+    for (size_t i = 0; i < num_scalars; ++i) {
+        const size_t bit_length = MSM::get_scalar_bit_length(scalars[indices[i]]);
+        if (i < partition.num_small_scalars) {
+            EXPECT_LE(bit_length, partition.small_num_bits);
+        } else {
+            EXPECT_GT(bit_length, partition.small_num_bits);
+            EXPECT_LE(bit_length, partition.num_bits);
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+    for (size_t i = 0; i < num_scalars; ++i) {
+        EXPECT_EQ(indices[i], i);
+    }
+
+    // Scalars of the same bit length are left alone, with only the rounds they need
+    for (size_t i = 0; i < num_scalars; ++i) {
+        scalars[i] = ScalarField(engine.get_random_uint64() | (1ULL << 63));
+        scalars[i].self_from_montgomery_form();
+    }
+    std::vector<uint32_t> unchanged_indices(indices);
+    partition = MSM::partition_scalar_indices_by_bit_length(scalars, indices);
+    EXPECT_EQ(partition.num_small_scalars, 0UL);
+    EXPECT_EQ(partition.num_bits, 64UL);
+    EXPECT_EQ(indices, unchanged_indices);
+}
+
 TYPED_TEST(ScalarMultiplicationTest, MSM)
 {
     SCALAR_MULTIPLICATION_TYPE_ALIASES
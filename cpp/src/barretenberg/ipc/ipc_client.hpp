@@ -9,6 +9,8 @@
 
 namespace bb::ipc {
 
+class BlobArena;
+
 /**
  * @brief Abstract interface for IPC client
  *
@@ -69,6 +71,12 @@ class IpcClient {
      */
     virtual void close() = 0;
 
+    /**
+     * @brief Arena into which large payloads can be written, to be referenced by offset and size in requests
+     * @return nullptr if the transport has no blob arena
+     */
+    virtual BlobArena* blob_arena() { return nullptr; }
+
     // Factory methods
     static std::unique_ptr<IpcClient> create_socket(const std::string& socket_path);
     static std::unique_ptr<IpcClient> create_shm(const std::string& base_name);
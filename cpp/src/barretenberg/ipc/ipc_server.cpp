@@ -1,10 +1,19 @@
 #include "barretenberg/ipc/ipc_server.hpp"
 #include "barretenberg/ipc/shm_server.hpp"
 #include "barretenberg/ipc/socket_server.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <string>
 
+#ifndef NO_MULTITHREADING
+#include "barretenberg/common/thread_pool.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#endif
+
 namespace bb::ipc {
 
 std::unique_ptr<IpcServer> IpcServer::create_socket(const std::string& socket_path, int max_clients)
@@ -14,9 +23,184 @@ std::unique_ptr<IpcServer> IpcServer::create_socket(const std::string& socket_pa
 
 std::unique_ptr<IpcServer> IpcServer::create_shm(const std::string& base_name,
                                                  size_t request_ring_size,
-                                                 size_t response_ring_size)
+                                                 size_t response_ring_size,
+                                                 size_t blob_arena_size)
+{
+    return std::make_unique<ShmServer>(base_name, request_ring_size, response_ring_size, blob_arena_size);
+}
+
+#ifndef NO_MULTITHREADING
+namespace {
+
+/**
+ * @brief Scheduling state of run_concurrent()
+ *
+ * Each client has a queue of received requests of which at most one is executing at any time; when it completes, the
+ * next request of that client is handed to the pool of its lane.
+ *
+ * The transports are not thread-safe: their client tables are mutated by accept() and receive() (on disconnect) and
+ * read by send(). All of these, and the pinning of client IDs, are therefore serialised by `transport_mutex`, while
+ * wait_for_data() only touches state owned by the event loop thread and runs without it. Responses are sent through a
+ * sender detached from the transport under the lock but invoked without it, so a client that doesn't drain its
+ * responses doesn't stall the others.
+ */
+class ConcurrentDispatcher {
+  public:
+    ConcurrentDispatcher(IpcServer& server,
+                         const IpcServer::Handler& handler,
+                         size_t num_workers,
+                         size_t num_fast_workers)
+        : server_(server)
+        , handler_(handler)
+        , default_pool_(std::max<size_t>(num_workers, 1))
+        , fast_pool_(std::max<size_t>(num_fast_workers, 1))
+    {}
+    ConcurrentDispatcher(const ConcurrentDispatcher&) = delete;
+    ConcurrentDispatcher(ConcurrentDispatcher&&) = delete;
+    ConcurrentDispatcher& operator=(const ConcurrentDispatcher&) = delete;
+    ConcurrentDispatcher& operator=(ConcurrentDispatcher&&) = delete;
+    ~ConcurrentDispatcher() { wait_for_idle(); }
+
+    std::mutex& transport_mutex() { return transport_mutex_; }
+
+    void dispatch(int client_id, std::vector<uint8_t> request, IpcServer::Lane lane)
+    {
+        std::unique_lock lock(state_mutex_);
+        auto& client = clients_[client_id];
+        client.pending.push_back({ std::move(request), lane });
+        if (!client.executing) {
+            start_next(client_id, client);
+        }
+    }
+
+    void wait_for_idle()
+    {
+        std::unique_lock lock(state_mutex_);
+        idle_condition_.wait(lock, [this] { return num_executing_ == 0; });
+    }
+
+  private:
+    struct PendingRequest {
+        std::vector<uint8_t> data;
+        IpcServer::Lane lane;
+    };
+    struct ClientQueue {
+        std::deque<PendingRequest> pending;
+        bool executing = false;
+    };
+
+    // Must be called with state_mutex_ held
+    void start_next(int client_id, ClientQueue& client)
+    {
+        auto request = std::make_shared<PendingRequest>(std::move(client.pending.front()));
+        client.pending.pop_front();
+        client.executing = true;
+        num_executing_++;
+        auto& pool = request->lane == IpcServer::Lane::Fast ? fast_pool_ : default_pool_;
+        pool.enqueue([this, client_id, request]() { execute(client_id, request->data); });
+    }
+
+    void execute(int client_id, std::span<const uint8_t> request)
+    {
+        std::vector<uint8_t> response;
+        bool shutdown = false;
+        try {
+            response = handler_(client_id, request);
+        } catch (const ShutdownRequested& shutdown_request) {
+            response = shutdown_request.response();
+            shutdown = true;
+        }
+        IpcServer::Sender sender;
+        {
+            std::unique_lock lock(transport_mutex_);
+            if (!response.empty()) {
+                sender = server_.detach_sender(client_id);
+                if (!sender) {
+                    server_.send(client_id, response.data(), response.size());
+                }
+            }
+            server_.unpin_client(client_id);
+        }
+        // The next request of the client only starts once this returns, so its sends are serialised
+        if (sender) {
+            sender(response.data(), response.size());
+        }
+        if (shutdown) {
+            server_.request_shutdown();
+        }
+
+        std::unique_lock lock(state_mutex_);
+        stopping_ = stopping_ || shutdown;
+        auto& client = clients_[client_id];
+        client.executing = false;
+        num_executing_--;
+        if (!client.pending.empty() && !stopping_) {
+            start_next(client_id, client);
+        } else if (client.pending.empty()) {
+            clients_.erase(client_id);
+        }
+        idle_condition_.notify_all();
+    }
+
+    IpcServer& server_;
+    const IpcServer::Handler& handler_;
+
+    std::mutex transport_mutex_;
+    std::mutex state_mutex_;
+    std::condition_variable idle_condition_;
+    std::unordered_map<int, ClientQueue> clients_;
+    size_t num_executing_ = 0;
+    bool stopping_ = false;
+
+    // Declared last so that the worker threads are joined before the state they use is destroyed
+    ThreadPool default_pool_;
+    ThreadPool fast_pool_;
+};
+
+} // namespace
+#endif
+
+void IpcServer::run_concurrent(const Handler& handler,
+                               const LaneSelector& select_lane,
+                               size_t num_workers,
+                               size_t num_fast_workers)
 {
-    return std::make_unique<ShmServer>(base_name, request_ring_size, response_ring_size);
+#ifdef NO_MULTITHREADING
+    (void)select_lane;
+    (void)num_workers;
+    (void)num_fast_workers;
+    run(handler);
+#else
+    ConcurrentDispatcher dispatcher(*this, handler, num_workers, num_fast_workers);
+    while (!shutdown_requested_.load(std::memory_order_acquire)) {
+        {
+            std::unique_lock lock(dispatcher.transport_mutex());
+            accept();
+        }
+
+        int client_id = wait_for_data(100000000); // 100ms timeout
+        if (client_id < 0) {
+            continue;
+        }
+
+        // Copy the request out of the transport so it can be released before the request executes
+        std::vector<uint8_t> request;
+        {
+            std::unique_lock lock(dispatcher.transport_mutex());
+            auto message = receive(client_id);
+            if (message.empty()) {
+                continue;
+            }
+            request.assign(message.begin(), message.end());
+            release(client_id, message.size());
+            pin_client(client_id);
+        }
+
+        const Lane lane = select_lane(request);
+        dispatcher.dispatch(client_id, std::move(request), lane);
+    }
+    dispatcher.wait_for_idle();
+#endif
 }
 
 } // namespace bb::ipc
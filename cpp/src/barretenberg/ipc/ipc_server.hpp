@@ -96,6 +96,21 @@ class IpcServer {
      */
     virtual bool send(int client_id, const void* data, size_t len) = 0;
 
+    /**
+     * @brief Function sending a message to one client, without going through the transport's client table
+     */
+    using Sender = std::function<bool(const void* data, size_t len)>;
+
+    /**
+     * @brief Detach a sender for a client, so that its response can be sent without serialising the transport
+     *
+     * Used by run_concurrent(), which calls it under the lock serialising the transport and invokes the sender once
+     * the lock is released: a client slow to drain its responses then only holds up its own requests. The sender may
+     * run concurrently with any call to the transport other than another send to the same client. Transports
+     * returning an empty function, as by default, have send() called under the lock instead.
+     */
+    virtual Sender detach_sender([[maybe_unused]] int client_id) { return {}; }
+
     /**
      * @brief Close the server and all client connections
      */
@@ -189,14 +204,92 @@ class IpcServer {
         }
     }
 
+    /**
+     * @brief Keep a client ID from being reassigned while requests it sent are still executing
+     *
+     * Used by run_concurrent(): a client may disconnect while one of its requests executes, and its response must
+     * not be delivered to a new client that took over its ID. Transports that never reuse client IDs need not
+     * override these.
+     */
+    virtual void pin_client([[maybe_unused]] int client_id) {}
+    virtual void unpin_client([[maybe_unused]] int client_id) {}
+
+    /**
+     * @brief Function called with the ID of a client that disconnected, once the ID is free to be reassigned
+     */
+    using ClientReleasedCallback = std::function<void(int client_id)>;
+
+    /**
+     * @brief Set the function notified when a client ID is released, e.g. to drop per-client state before a new client
+     * takes over the ID
+     *
+     * The callback is invoked from the thread driving the transport: with run_concurrent(), while holding the lock that
+     * serialises the transport. Transports that cannot detect disconnects (shared memory, which serves a single client
+     * for its lifetime) never invoke it.
+     */
+    void set_client_released_callback(ClientReleasedCallback callback) { client_released_ = std::move(callback); }
+
+    /**
+     * @brief Shared memory through which clients pass large payloads out-of-band of their requests
+     *
+     * Requests refer to a payload by its offset and size in the returned arena, which stays mapped until close().
+     * Empty if the transport has no blob arena.
+     */
+    virtual std::span<const uint8_t> blob_arena() const { return {}; }
+
+    /**
+     * @brief Execution lane of a request served by run_concurrent()
+     */
+    enum class Lane : uint8_t {
+        Default, // Executed on the general worker pool
+        Fast,    // Cheap request, executed on a reserved pool so it never queues behind long-running requests
+    };
+
+    /**
+     * @brief Picks the lane of a request from its raw bytes; called on the event loop thread, so it must be cheap
+     */
+    using LaneSelector = std::function<Lane(std::span<const uint8_t> request)>;
+
+    /**
+     * @brief Run server event loop, executing requests of different clients concurrently
+     *
+     * The event loop thread only accepts clients and copies requests out of the transport; requests are executed by
+     * a pool of `num_workers` threads, plus `num_fast_workers` threads reserved for requests in Lane::Fast.
+     * Requests of a single client are executed one at a time in the order they were received, so each client sees
+     * its responses in request order exactly as with run().
+     *
+     * On ShutdownRequested, the final response is sent, no further requests are started, and the call returns once
+     * the requests already executing have completed.
+     *
+     * Falls back to run() in builds without multithreading.
+     *
+     * @param handler Function to process requests and generate responses; called concurrently for different clients
+     * @param select_lane Function choosing the lane of each request
+     * @param num_workers Number of threads executing requests in Lane::Default
+     * @param num_fast_workers Number of threads executing requests in Lane::Fast
+     */
+    void run_concurrent(const Handler& handler,
+                        const LaneSelector& select_lane,
+                        size_t num_workers,
+                        size_t num_fast_workers = 1);
+
     // Factory methods
     static std::unique_ptr<IpcServer> create_socket(const std::string& socket_path, int max_clients);
     static std::unique_ptr<IpcServer> create_shm(const std::string& base_name,
                                                  size_t request_ring_size = static_cast<size_t>(1024 * 1024),
-                                                 size_t response_ring_size = static_cast<size_t>(1024 * 1024));
+                                                 size_t response_ring_size = static_cast<size_t>(1024 * 1024),
+                                                 size_t blob_arena_size = 0);
 
   protected:
     std::atomic<bool> shutdown_requested_{ false };
+    ClientReleasedCallback client_released_;
+
+    void notify_client_released(int client_id)
+    {
+        if (client_released_) {
+            client_released_(client_id);
+        }
+    }
 
     /**
      * @brief Wake all blocked threads (for graceful shutdown)
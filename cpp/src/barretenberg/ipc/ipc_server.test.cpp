@@ -0,0 +1,206 @@
+#include "barretenberg/ipc/ipc_client.hpp"
+#include "barretenberg/ipc/ipc_server.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace bb::ipc;
+
+namespace {
+
+constexpr uint8_t SLOW_REQUEST = 'S';
+constexpr uint8_t FAST_REQUEST = 'F';
+constexpr uint8_t LARGE_REQUEST = 'L';
+constexpr uint8_t SHUTDOWN_REQUEST = 'Q';
+constexpr auto SLOW_REQUEST_DURATION = std::chrono::milliseconds(500);
+// Far larger than a socket buffer, so sending it blocks until the client reads it
+constexpr size_t LARGE_RESPONSE_SIZE = static_cast<size_t>(64) * 1024 * 1024;
+
+/**
+ * @brief Echo server whose slow requests take SLOW_REQUEST_DURATION and whose large requests are answered with
+ * LARGE_RESPONSE_SIZE bytes, served by run_concurrent() on its own thread
+ */
+class ConcurrentServerTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        socket_path = "/tmp/bb_ipc_concurrent_" + std::to_string(getpid()) + ".sock";
+        server = IpcServer::create_socket(socket_path, 4);
+        ASSERT_TRUE(server->listen());
+        server->set_client_released_callback([this](int client_id) {
+            std::unique_lock lock(released_clients_mutex);
+            released_clients.push_back(client_id);
+        });
+        server_thread = std::thread([this]() {
+            server->run_concurrent(
+                [this](int client_id, std::span<const uint8_t> request) -> std::vector<uint8_t> {
+                    last_client_id = client_id;
+                    std::vector<uint8_t> response(request.begin(), request.end());
+                    if (request[0] == LARGE_REQUEST) {
+                        response.resize(LARGE_RESPONSE_SIZE);
+                    } else if (request[0] == SLOW_REQUEST) {
+                        std::this_thread::sleep_for(SLOW_REQUEST_DURATION);
+                    } else if (request[0] == SHUTDOWN_REQUEST) {
+                        throw ShutdownRequested(response);
+                    }
+                    return response;
+                },
+                [](std::span<const uint8_t> request) {
+                    return request[0] == FAST_REQUEST ? IpcServer::Lane::Fast : IpcServer::Lane::Default;
+                },
+                /*num_workers=*/1,
+                /*num_fast_workers=*/1);
+        });
+    }
+
+    void TearDown() override
+    {
+        server->request_shutdown();
+        server_thread.join();
+        server->close();
+    }
+
+    std::unique_ptr<IpcClient> connect()
+    {
+        auto client = IpcClient::create_socket(socket_path);
+        EXPECT_TRUE(client->connect());
+        return client;
+    }
+
+    static void send(IpcClient& client, uint8_t kind, uint8_t tag)
+    {
+        std::vector<uint8_t> request{ kind, tag };
+        ASSERT_TRUE(client.send(request.data(), request.size(), 0));
+    }
+
+    static std::vector<uint8_t> receive(IpcClient& client)
+    {
+        auto response = client.receive(0);
+        std::vector<uint8_t> result(response.begin(), response.end());
+        client.release(response.size());
+        return result;
+    }
+
+    std::vector<int> get_released_clients()
+    {
+        std::unique_lock lock(released_clients_mutex);
+        return released_clients;
+    }
+
+    std::string socket_path;
+    std::unique_ptr<IpcServer> server;
+    std::thread server_thread;
+    std::atomic<int> last_client_id = -1;
+    std::mutex released_clients_mutex;
+    std::vector<int> released_clients;
+};
+
+/**
+ * @brief A fast request of one client is answered while a slow request of another client is still executing
+ */
+TEST_F(ConcurrentServerTest, FastLaneDoesNotWaitForOtherClients)
+{
+    auto slow_client = connect();
+    auto fast_client = connect();
+
+    const auto start = std::chrono::steady_clock::now();
+    send(*slow_client, SLOW_REQUEST, 0);
+    // Make sure the slow request is executing before the fast one is sent
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    send(*fast_client, FAST_REQUEST, 1);
+
+    EXPECT_EQ(receive(*fast_client), (std::vector<uint8_t>{ FAST_REQUEST, 1 }));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, SLOW_REQUEST_DURATION);
+    EXPECT_EQ(receive(*slow_client), (std::vector<uint8_t>{ SLOW_REQUEST, 0 }));
+}
+
+/**
+ * @brief A client that doesn't read its response only holds up its own requests, not the other clients
+ */
+TEST_F(ConcurrentServerTest, UnreadResponseDoesNotStallOtherClients)
+{
+    auto stalled_client = connect();
+    auto fast_client = connect();
+
+    send(*stalled_client, LARGE_REQUEST, 0);
+    // Make sure the large response is being sent before the fast request is
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const auto start = std::chrono::steady_clock::now();
+    send(*fast_client, FAST_REQUEST, 1);
+
+    EXPECT_EQ(receive(*fast_client), (std::vector<uint8_t>{ FAST_REQUEST, 1 }));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, SLOW_REQUEST_DURATION);
+    EXPECT_EQ(receive(*stalled_client).size(), LARGE_RESPONSE_SIZE);
+}
+
+/**
+ * @brief The requests of a single client are answered in the order they were sent, whatever their lane
+ */
+TEST_F(ConcurrentServerTest, PerClientOrderIsPreserved)
+{
+    auto client = connect();
+
+    send(*client, SLOW_REQUEST, 0);
+    send(*client, FAST_REQUEST, 1);
+    send(*client, SLOW_REQUEST, 2);
+    send(*client, FAST_REQUEST, 3);
+
+    EXPECT_EQ(receive(*client), (std::vector<uint8_t>{ SLOW_REQUEST, 0 }));
+    EXPECT_EQ(receive(*client), (std::vector<uint8_t>{ FAST_REQUEST, 1 }));
+    EXPECT_EQ(receive(*client), (std::vector<uint8_t>{ SLOW_REQUEST, 2 }));
+    EXPECT_EQ(receive(*client), (std::vector<uint8_t>{ FAST_REQUEST, 3 }));
+}
+
+/**
+ * @brief A shutdown request is answered and stops the server once the requests already executing have completed
+ */
+TEST_F(ConcurrentServerTest, ShutdownWaitsForExecutingRequests)
+{
+    auto slow_client = connect();
+    auto shutdown_client = connect();
+
+    send(*slow_client, SLOW_REQUEST, 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    send(*shutdown_client, SHUTDOWN_REQUEST, 1);
+
+    EXPECT_EQ(receive(*shutdown_client), (std::vector<uint8_t>{ SHUTDOWN_REQUEST, 1 }));
+    EXPECT_EQ(receive(*slow_client), (std::vector<uint8_t>{ SLOW_REQUEST, 0 }));
+}
+
+/**
+ * @brief The ID of a disconnected client is released only once its requests have completed, so that per-client state
+ * can be dropped before a new client takes over the ID
+ */
+TEST_F(ConcurrentServerTest, ClientIsReleasedAfterItsRequestsComplete)
+{
+    auto client = connect();
+    send(*client, SLOW_REQUEST, 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const int client_id = last_client_id;
+    client->close();
+
+    // The server has seen the disconnect, but the slow request is still executing
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    EXPECT_TRUE(get_released_clients().empty());
+
+    std::this_thread::sleep_for(SLOW_REQUEST_DURATION);
+    EXPECT_EQ(get_released_clients(), std::vector<int>{ client_id });
+
+    // A client without requests in flight is released as soon as it disconnects
+    auto idle_client = connect();
+    send(*idle_client, FAST_REQUEST, 1);
+    EXPECT_EQ(receive(*idle_client), (std::vector<uint8_t>{ FAST_REQUEST, 1 }));
+    const int idle_client_id = last_client_id;
+    idle_client->close();
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    EXPECT_EQ(get_released_clients(), (std::vector<int>{ client_id, idle_client_id }));
+}
+
+} // namespace
@@ -1,8 +1,10 @@
 #include "barretenberg/ipc/ipc_client.hpp"
 #include "barretenberg/ipc/ipc_server.hpp"
+#include "barretenberg/ipc/shm/blob_arena.hpp"
 #include "barretenberg/ipc/shm/spsc_shm.hpp"
 #include "barretenberg/ipc/shm_client.hpp"
 #include "barretenberg/ipc/shm_server.hpp"
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <chrono>
@@ -12,6 +14,7 @@
 #include <functional>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <numeric>
 #include <random>
 #include <sstream>
 #include <thread>
@@ -215,4 +218,57 @@ TEST(ShmTest, SingleClientSmallRingHighVolume)
 //     server->close();
 // } // namespace
 
+/**
+ * @brief Payloads written into the blob arena by the client are read in place by the server
+ */
+TEST(ShmTest, BlobArenaPayloadsAreVisibleToServer)
+{
+    constexpr size_t ARENA_SIZE = 1UL << 20;
+    std::string blob_test_shm = "shm_blob_" + std::to_string(getpid());
+    auto server = IpcServer::create_shm(blob_test_shm, 4096, 4096, ARENA_SIZE);
+    ASSERT_TRUE(server->listen());
+    ASSERT_EQ(server->blob_arena().size(), ARENA_SIZE);
+
+    ShmClient client(blob_test_shm);
+    ASSERT_TRUE(client.connect());
+    BlobArena* arena = client.blob_arena();
+    ASSERT_NE(arena, nullptr);
+
+    std::vector<uint8_t> first(1000);
+    std::vector<uint8_t> second(5000);
+    std::iota(first.begin(), first.end(), uint8_t(1));
+    std::iota(second.begin(), second.end(), uint8_t(7));
+    auto first_offset = arena->write(first);
+    auto second_offset = arena->write(second);
+    ASSERT_TRUE(first_offset.has_value() && second_offset.has_value());
+    EXPECT_EQ(*second_offset % BlobArena::ALIGNMENT, 0U);
+
+    auto server_arena = server->blob_arena();
+    EXPECT_TRUE(std::ranges::equal(server_arena.subspan(*first_offset, first.size()), first));
+    EXPECT_TRUE(std::ranges::equal(server_arena.subspan(*second_offset, second.size()), second));
+
+    // Allocations beyond the arena fail until the client frees the arena
+    EXPECT_FALSE(arena->write(std::vector<uint8_t>(ARENA_SIZE)).has_value());
+    arena->reset();
+#ifdef __linux__
+    // Freeing the arena also releases the memory backing it
+    EXPECT_TRUE(std::ranges::all_of(server_arena.subspan(0, *second_offset + second.size()),
+                                    [](uint8_t byte) { return byte == 0; }));
+#endif
+    EXPECT_EQ(arena->write(std::vector<uint8_t>(ARENA_SIZE)), std::optional<uint64_t>(0));
+
+    client.close();
+    server->close();
+
+    // Without a blob arena size the client connects without an arena
+    auto plain_server = IpcServer::create_shm(blob_test_shm, 4096, 4096);
+    ASSERT_TRUE(plain_server->listen());
+    EXPECT_TRUE(plain_server->blob_arena().empty());
+    ShmClient plain_client(blob_test_shm);
+    ASSERT_TRUE(plain_client.connect());
+    EXPECT_EQ(plain_client.blob_arena(), nullptr);
+    plain_client.close();
+    plain_server->close();
+}
+
 } // namespace
@@ -0,0 +1,158 @@
+#include "blob_arena.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace bb::ipc {
+
+BlobArena::BlobArena(int fd, size_t size, uint8_t* data)
+    : fd_(fd)
+    , size_(size)
+    , data_(data)
+{}
+
+BlobArena::BlobArena(BlobArena&& other) noexcept
+    : fd_(other.fd_)
+    , size_(other.size_)
+    , data_(other.data_)
+    , used_(other.used_)
+{
+    other.fd_ = -1;
+    other.size_ = 0;
+    other.data_ = nullptr;
+    other.used_ = 0;
+}
+
+BlobArena& BlobArena::operator=(BlobArena&& other) noexcept
+{
+    if (this != &other) {
+        if (data_ != nullptr) {
+            munmap(data_, size_);
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+
+        fd_ = other.fd_;
+        size_ = other.size_;
+        data_ = other.data_;
+        used_ = other.used_;
+
+        other.fd_ = -1;
+        other.size_ = 0;
+        other.data_ = nullptr;
+        other.used_ = 0;
+    }
+    return *this;
+}
+
+BlobArena::~BlobArena()
+{
+    if (data_ != nullptr) {
+        munmap(data_, size_);
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+BlobArena BlobArena::create(const std::string& name, size_t size)
+{
+    if (name.empty() || size == 0) {
+        throw std::runtime_error("BlobArena::create: empty name or size");
+    }
+
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("BlobArena::create: shm_open failed for '" + name + "': " + std::strerror(errno));
+    }
+
+    // The object is sparse: only the pages written by the client are backed by memory
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        int e = errno;
+        ::close(fd);
+        shm_unlink(name.c_str());
+        throw std::runtime_error("BlobArena::create: ftruncate failed for '" + name +
+                                 "' (size=" + std::to_string(size) + "): " + std::strerror(e));
+    }
+
+    void* mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mem == MAP_FAILED) {
+        int e = errno;
+        ::close(fd);
+        shm_unlink(name.c_str());
+        throw std::runtime_error("BlobArena::create: mmap failed for '" + name + "' (size=" + std::to_string(size) +
+                                 "): " + std::strerror(e));
+    }
+    return BlobArena(fd, size, static_cast<uint8_t*>(mem));
+}
+
+BlobArena BlobArena::connect(const std::string& name)
+{
+    if (name.empty()) {
+        throw std::runtime_error("BlobArena::connect: empty name");
+    }
+
+    int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("BlobArena::connect: shm_open failed: " + std::string(std::strerror(errno)));
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        int e = errno;
+        ::close(fd);
+        throw std::runtime_error("BlobArena::connect: fstat failed: " + std::string(std::strerror(e)));
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+
+    void* mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mem == MAP_FAILED) {
+        int e = errno;
+        ::close(fd);
+        throw std::runtime_error("BlobArena::connect: mmap failed: " + std::string(std::strerror(e)));
+    }
+    return BlobArena(fd, size, static_cast<uint8_t*>(mem));
+}
+
+bool BlobArena::unlink(const std::string& name)
+{
+    return shm_unlink(name.c_str()) == 0;
+}
+
+std::optional<uint64_t> BlobArena::write(std::span<const uint8_t> bytes)
+{
+    const size_t offset = (used_ + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    if (offset > size_ || bytes.size() > size_ - offset) {
+        return std::nullopt;
+    }
+    if (!bytes.empty()) {
+#ifdef __linux__
+        // Back the region up front: writing to a sparse page that a full tmpfs cannot back raises SIGBUS
+        if (posix_fallocate(fd_, static_cast<off_t>(offset), static_cast<off_t>(bytes.size())) != 0) {
+            return std::nullopt;
+        }
+#endif
+        std::memcpy(data_ + offset, bytes.data(), bytes.size());
+    }
+    used_ = offset + bytes.size();
+    return offset;
+}
+
+void BlobArena::reset()
+{
+#ifdef __linux__
+    // Hand the pages back so that the arena only holds memory while requests referencing it are in flight
+    if (used_ > 0) {
+        fallocate(fd_, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(used_));
+    }
+#endif
+    used_ = 0;
+}
+
+} // namespace bb::ipc
@@ -0,0 +1,89 @@
+/**
+ * @file blob_arena.hpp
+ * @brief Shared-memory arena for large payloads passed alongside the SPSC rings
+ *
+ * - The client copies a large payload (e.g. bytecode or a witness) into the arena and sends only its offset and size
+ * - The server reads the payload in place, so payloads are not limited by the ring sizes and are not copied through
+ *   the rings or the msgpack decoder
+ * - The client owns the allocation: a region must stay untouched until the response to the request referencing it has
+ *   been received
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace bb::ipc {
+
+class BlobArena {
+  public:
+    // Alignment of the regions handed out by write()
+    static constexpr size_t ALIGNMENT = 64;
+
+    /**
+     * @brief Create a new arena
+     * @param name Shared memory object name (without /dev/shm prefix)
+     * @param size Size of the arena in bytes; pages are only backed by memory once written to
+     * @throws std::runtime_error if creation fails
+     */
+    static BlobArena create(const std::string& name, size_t size);
+
+    /**
+     * @brief Connect to an existing arena
+     * @param name Shared memory object name
+     * @throws std::runtime_error if connection fails
+     */
+    static BlobArena connect(const std::string& name);
+
+    /**
+     * @brief Unlink shared memory object (cleanup after close)
+     * @param name Shared memory object name
+     * @return true if successful, false otherwise
+     */
+    static bool unlink(const std::string& name);
+
+    // Move-only (no copy)
+    BlobArena(BlobArena&& other) noexcept;
+    BlobArena& operator=(BlobArena&& other) noexcept;
+    BlobArena(const BlobArena&) = delete;
+    BlobArena& operator=(const BlobArena&) = delete;
+
+    ~BlobArena();
+
+    size_t size() const { return size_; }
+
+    /**
+     * @brief The whole arena, as read by the server
+     */
+    std::span<const uint8_t> data() const { return { data_, size_ }; }
+
+    /**
+     * Client API: write() allocates after the previous allocation, reset() frees all allocations
+     *
+     * @brief Copy bytes into the arena
+     * @return Offset of the copy, or std::nullopt if it does not fit in the remaining space or the shared memory
+     * file system cannot back it (the payload must then be sent inline)
+     */
+    std::optional<uint64_t> write(std::span<const uint8_t> bytes);
+
+    /**
+     * @brief Free all allocations, and the memory backing them; only valid once every request referencing them has
+     * been answered
+     */
+    void reset();
+
+  private:
+    // Private constructor for create/connect factories
+    BlobArena(int fd, size_t size, uint8_t* data);
+
+    int fd_ = -1;
+    size_t size_ = 0;
+    uint8_t* data_ = nullptr;
+    size_t used_ = 0;
+};
+
+} // namespace bb::ipc
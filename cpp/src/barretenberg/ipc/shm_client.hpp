@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ipc_client.hpp"
+#include "shm/blob_arena.hpp"
 #include "shm/spsc_shm.hpp"
 #include "shm_common.hpp"
 #include <cassert>
@@ -50,15 +51,23 @@ class ShmClient : public IpcClient {
             // Connect to response ring (server writes, client reads)
             std::string resp_name = base_name_ + "_response";
             response_ring_ = SpscShm::connect(resp_name);
-
-            return true;
         } catch (...) {
             request_ring_.reset();
             response_ring_.reset();
             return false;
         }
+
+        // The blob arena is optional: the server only creates it when configured with a blob arena size
+        try {
+            blob_arena_ = BlobArena::connect(base_name_ + "_blobs");
+        } catch (...) {
+            blob_arena_.reset();
+        }
+        return true;
     }
 
+    BlobArena* blob_arena() override { return blob_arena_.has_value() ? &blob_arena_.value() : nullptr; }
+
     bool send(const void* data, size_t len, uint64_t timeout_ns) override
     {
         if (!request_ring_.has_value()) {
@@ -87,6 +96,7 @@ class ShmClient : public IpcClient {
     {
         request_ring_.reset();
         response_ring_.reset();
+        blob_arena_.reset();
     }
 
     void debug_dump() const
@@ -103,6 +113,7 @@ class ShmClient : public IpcClient {
     std::string base_name_;
     std::optional<SpscShm> request_ring_;  // Client writes to this
     std::optional<SpscShm> response_ring_; // Client reads from this
+    std::optional<BlobArena> blob_arena_;  // Client writes to this
 };
 
 } // namespace bb::ipc
@@ -2,6 +2,7 @@
 
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "ipc_server.hpp"
+#include "shm/blob_arena.hpp"
 #include "shm/spsc_shm.hpp"
 #include "shm_common.hpp"
 #include <cstdint>
@@ -22,6 +23,9 @@ namespace bb::ipc {
  *
  * Uses SPSC (single-producer single-consumer) for both requests and responses.
  * Simple 1:1 client-server communication.
+ *
+ * With a non-zero blob_arena_size, also creates a BlobArena ("<base_name>_blobs") into which the client can write large
+ * payloads that its requests then refer to by offset and size.
  */
 class ShmServer : public IpcServer {
   public:
@@ -29,10 +33,12 @@ class ShmServer : public IpcServer {
 
     ShmServer(std::string base_name,
               size_t request_ring_size = DEFAULT_RING_SIZE,
-              size_t response_ring_size = DEFAULT_RING_SIZE)
+              size_t response_ring_size = DEFAULT_RING_SIZE,
+              size_t blob_arena_size = 0)
         : base_name_(std::move(base_name))
         , request_ring_size_(request_ring_size)
         , response_ring_size_(response_ring_size)
+        , blob_arena_size_(blob_arena_size)
     {}
 
     ~ShmServer() override { close(); }
@@ -52,8 +58,10 @@ class ShmServer : public IpcServer {
         // Clean up any leftover shared memory
         std::string req_name = base_name_ + "_request";
         std::string resp_name = base_name_ + "_response";
+        std::string blobs_name = base_name_ + "_blobs";
         SpscShm::unlink(req_name);
         SpscShm::unlink(resp_name);
+        BlobArena::unlink(blobs_name);
 
         try {
             // Create SPSC ring for requests (client writes, server reads)
@@ -62,6 +70,11 @@ class ShmServer : public IpcServer {
             // Create SPSC ring for responses (server writes, client reads)
             response_ring_ = SpscShm::create(resp_name, response_ring_size_);
 
+            // Create arena for large payloads (client writes, server reads)
+            if (blob_arena_size_ > 0) {
+                blob_arena_ = BlobArena::create(blobs_name, blob_arena_size_);
+            }
+
             return true;
         } catch (...) {
             close(); // Cleanup on failure
@@ -108,17 +121,35 @@ class ShmServer : public IpcServer {
         return ring_send_msg(response_ring_.value(), data, len, 100000000);
     }
 
+    Sender detach_sender([[maybe_unused]] int client_id) override
+    {
+        if (!response_ring_.has_value()) {
+            return {};
+        }
+        // The response ring is only written to by the sends to the single client, which are serialised by the caller
+        return [this](const void* data, size_t len) { return send(0, data, len); };
+    }
+
     void close() override
     {
         // Close rings
         request_ring_.reset();
         response_ring_.reset();
+        blob_arena_.reset();
 
         // Clean up shared memory
         std::string req_name = base_name_ + "_request";
         std::string resp_name = base_name_ + "_response";
         SpscShm::unlink(req_name);
         SpscShm::unlink(resp_name);
+        if (blob_arena_size_ > 0) {
+            BlobArena::unlink(base_name_ + "_blobs");
+        }
+    }
+
+    std::span<const uint8_t> blob_arena() const override
+    {
+        return blob_arena_.has_value() ? blob_arena_->data() : std::span<const uint8_t>{};
     }
 
     void wakeup_all() override
@@ -146,8 +177,10 @@ class ShmServer : public IpcServer {
     std::string base_name_;
     size_t request_ring_size_;
     size_t response_ring_size_;
+    size_t blob_arena_size_;
     std::optional<SpscShm> request_ring_;  // Server reads from this
     std::optional<SpscShm> response_ring_; // Server writes to this
+    std::optional<BlobArena> blob_arena_;  // Server reads from this
 };
 
 } // namespace bb::ipc
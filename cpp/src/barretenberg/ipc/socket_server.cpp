@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <cstring>
 #include <fcntl.h>
+#include <memory>
 #include <span>
 #include <string>
 #include <sys/socket.h>
@@ -69,7 +70,7 @@ int SocketServer::find_free_slot()
 {
     // Look for existing free slot
     for (size_t i = 0; i < client_fds_.size(); i++) {
-        if (client_fds_[i] == -1) {
+        if (client_fds_[i] == -1 && (i >= client_pins_.size() || client_pins_[i] == 0)) {
             return static_cast<int>(i);
         }
     }
@@ -78,16 +79,10 @@ int SocketServer::find_free_slot()
     return static_cast<int>(client_fds_.size());
 }
 
-bool SocketServer::send(int client_id, const void* data, size_t len)
-{
-    if (client_id < 0 || static_cast<size_t>(client_id) >= client_fds_.size() ||
-        client_fds_[static_cast<size_t>(client_id)] < 0) {
-        errno = EINVAL;
-        return false;
-    }
-
-    int fd = client_fds_[static_cast<size_t>(client_id)];
+namespace {
 
+bool send_message(int fd, const void* data, size_t len)
+{
     // Send length prefix (4 bytes)
     auto msg_len = static_cast<uint32_t>(len);
     ssize_t n = ::send(fd, &msg_len, sizeof(msg_len), 0);
@@ -104,6 +99,80 @@ bool SocketServer::send(int client_id, const void* data, size_t len)
     return bytes_sent == len;
 }
 
+} // namespace
+
+bool SocketServer::send(int client_id, const void* data, size_t len)
+{
+    if (client_id < 0 || static_cast<size_t>(client_id) >= client_fds_.size() ||
+        client_fds_[static_cast<size_t>(client_id)] < 0) {
+        errno = EINVAL;
+        return false;
+    }
+    return send_message(client_fds_[static_cast<size_t>(client_id)], data, len);
+}
+
+IpcServer::Sender SocketServer::detach_sender(int client_id)
+{
+    if (client_id < 0 || static_cast<size_t>(client_id) >= client_fds_.size() ||
+        client_fds_[static_cast<size_t>(client_id)] < 0) {
+        return {};
+    }
+    // Send through a duplicate of the client's fd: the connection stays open, and the message goes to this client, even
+    // if it disconnects and its ID is reassigned while sending
+    struct OwnedFd {
+        int fd;
+        explicit OwnedFd(int fd)
+            : fd(fd)
+        {}
+        OwnedFd(const OwnedFd&) = delete;
+        OwnedFd(OwnedFd&&) = delete;
+        OwnedFd& operator=(const OwnedFd&) = delete;
+        OwnedFd& operator=(OwnedFd&&) = delete;
+        ~OwnedFd() { ::close(fd); }
+    };
+    const int fd = ::dup(client_fds_[static_cast<size_t>(client_id)]);
+    if (fd < 0) {
+        return {};
+    }
+    auto owned_fd = std::make_shared<OwnedFd>(fd);
+    return [owned_fd](const void* data, size_t len) { return send_message(owned_fd->fd, data, len); };
+}
+
+void SocketServer::pin_client(int client_id)
+{
+    if (client_id < 0) {
+        return;
+    }
+    const auto client_idx = static_cast<size_t>(client_id);
+    if (client_idx >= client_pins_.size()) {
+        client_pins_.resize(client_idx + 1, 0);
+    }
+    client_pins_[client_idx]++;
+}
+
+void SocketServer::unpin_client(int client_id)
+{
+    if (client_id < 0 || static_cast<size_t>(client_id) >= client_pins_.size() ||
+        client_pins_[static_cast<size_t>(client_id)] == 0) {
+        return;
+    }
+    client_pins_[static_cast<size_t>(client_id)]--;
+    release_slot_if_unused(client_id);
+}
+
+/**
+ * @brief Notify that a client ID can be reassigned, once its client has disconnected and no request of it is pinned
+ */
+void SocketServer::release_slot_if_unused(int client_id)
+{
+    const auto client_idx = static_cast<size_t>(client_id);
+    const bool connected = client_idx < client_fds_.size() && client_fds_[client_idx] >= 0;
+    const bool pinned = client_idx < client_pins_.size() && client_pins_[client_idx] > 0;
+    if (!connected && !pinned) {
+        notify_client_released(client_id);
+    }
+}
+
 void SocketServer::release(int client_id, size_t message_size)
 {
     // No-op for sockets - message already consumed from kernel buffer during receive()
@@ -374,6 +443,7 @@ void SocketServer::disconnect_client(int client_id)
         fd_to_client_id_.erase(fd);
         client_fds_[static_cast<size_t>(client_id)] = -1;
         num_clients_--;
+        release_slot_if_unused(client_id);
     }
 }
 
@@ -558,6 +628,7 @@ void SocketServer::disconnect_client(int client_id)
         fd_to_client_id_.erase(fd);
         client_fds_[static_cast<size_t>(client_id)] = -1;
         num_clients_--;
+        release_slot_if_unused(client_id);
     }
 }
 
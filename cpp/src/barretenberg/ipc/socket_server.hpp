@@ -35,11 +35,15 @@ class SocketServer : public IpcServer {
     std::span<const uint8_t> receive(int client_id) override;
     void release(int client_id, size_t message_size) override;
     bool send(int client_id, const void* data, size_t len) override;
+    Sender detach_sender(int client_id) override;
     void close() override;
+    void pin_client(int client_id) override;
+    void unpin_client(int client_id) override;
 
   private:
     void close_internal();
     void disconnect_client(int client_id);
+    void release_slot_if_unused(int client_id);
     int find_free_slot();
 
     std::string socket_path_;
@@ -49,6 +53,7 @@ class SocketServer : public IpcServer {
     std::vector<int> client_fds_;                    // client_id -> fd
     std::unordered_map<int, int> fd_to_client_id_;   // fd -> client_id (for fast lookup)
     std::vector<std::vector<uint8_t>> recv_buffers_; // client_id -> recv buffer
+    std::vector<uint32_t> client_pins_;              // client_id -> number of pins (slot not reusable while > 0)
     int num_clients_ = 0;
 };
 
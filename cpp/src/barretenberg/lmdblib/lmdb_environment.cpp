@@ -67,6 +67,27 @@ MDB_env* LMDBEnvironment::underlying() const
     return _mdbEnv;
 }
 
+void LMDBEnvironment::set_sync_on_commit(bool syncOnCommit)
+{
+    wait_for_writer();
+    try {
+        call_lmdb_func("mdb_env_set_flags",
+                       mdb_env_set_flags,
+                       _mdbEnv,
+                       static_cast<unsigned int>(MDB_NOSYNC),
+                       static_cast<int>(!syncOnCommit));
+    } catch (std::runtime_error&) {
+        release_writer();
+        throw;
+    }
+    release_writer();
+}
+
+void LMDBEnvironment::sync() const
+{
+    call_lmdb_func("mdb_env_sync", mdb_env_sync, _mdbEnv, 1);
+}
+
 uint64_t LMDBEnvironment::get_map_size() const
 {
     MDB_envinfo info;
@@ -50,6 +50,18 @@ class LMDBEnvironment {
 
     uint64_t get_data_file_size() const;
 
+    /**
+     * @brief Enables or disables flushing to disk as part of each write transaction commit (MDB_NOSYNC)
+     * While disabled, committed transactions only become durable once sync() has returned. Waits for any write
+     * transaction in progress to complete before changing the setting.
+     */
+    void set_sync_on_commit(bool syncOnCommit);
+
+    /**
+     * @brief Flushes all committed transactions to disk
+     */
+    void sync() const;
+
   private:
     std::atomic_uint64_t _id;
     std::string _directory;
@@ -4,6 +4,7 @@
 #include "lmdb.h"
 #include <cstdint>
 #include <functional>
+#include <optional>
 #include <vector>
 
 namespace bb::lmdblib {
@@ -56,6 +57,11 @@ class LMDBTransaction {
 
     template <typename T> bool get_value(T& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    template <typename T>
+    void get_values(const std::vector<T>& keys,
+                    std::vector<std::optional<std::vector<uint8_t>>>& data,
+                    const LMDBDatabase& db) const;
+
     template <typename T>
     void get_all_values_greater_or_equal_key(const T& key,
                                              std::vector<std::vector<uint8_t>>& data,
@@ -89,6 +95,14 @@ template <typename T> bool LMDBTransaction::get_value(T& key, uint64_t& data, co
     return get_value(keyBuffer, data, db);
 }
 
+template <typename T>
+void LMDBTransaction::get_values(const std::vector<T>& keys,
+                                 std::vector<std::optional<std::vector<uint8_t>>>& data,
+                                 const LMDBDatabase& db) const
+{
+    lmdb_queries::get_values(keys, data, db, *this);
+}
+
 template <typename T, typename K>
 bool LMDBTransaction::get_value_or_previous(T& key, K& data, const LMDBDatabase& db) const
 {
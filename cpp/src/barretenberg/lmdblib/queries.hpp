@@ -4,8 +4,11 @@
 #include "barretenberg/lmdblib/lmdb_helpers.hpp"
 #include "barretenberg/lmdblib/types.hpp"
 #include "lmdb.h"
+#include <algorithm>
 #include <cstdint>
 #include <functional>
+#include <numeric>
+#include <optional>
 #include <vector>
 
 namespace bb::lmdblib {
@@ -218,6 +221,59 @@ bool get_value_or_greater(TKey& key, Value& data, const LMDBDatabase& db, const
     return success;
 }
 
+/**
+ * Reads the values of many keys through a single cursor. The keys are visited in ascending order so that neighbouring
+ * keys are found on the pages already loaded by the previous lookup rather than each lookup descending the B-tree from
+ * the root. The ordering of TKey must match the comparator of the database.
+ * The values are returned in the order of the keys provided, std::nullopt for keys that are not present.
+ */
+template <typename TKey, typename TxType>
+void get_values(const std::vector<TKey>& keys,
+                std::vector<std::optional<Value>>& data,
+                const LMDBDatabase& db,
+                const TxType& tx)
+{
+    data.assign(keys.size(), std::nullopt);
+    if (keys.empty()) {
+        return;
+    }
+    std::vector<size_t> order(keys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return keys[lhs] < keys[rhs]; });
+
+    MDB_cursor* cursor = nullptr;
+    call_lmdb_func("mdb_cursor_open", mdb_cursor_open, tx.underlying(), db.underlying(), &cursor);
+
+    try {
+        const size_t* previous = nullptr;
+        for (const size_t& i : order) {
+            // Duplicate keys are adjacent once sorted, only the first one is looked up
+            if (previous != nullptr && keys[*previous] == keys[i]) {
+                data[i] = data[*previous];
+                continue;
+            }
+            previous = &i;
+
+            Key keyBuffer = serialise_key(keys[i]);
+            MDB_val dbKey;
+            dbKey.mv_size = keyBuffer.size();
+            dbKey.mv_data = (void*)keyBuffer.data();
+            MDB_val dbVal;
+            int code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_SET);
+            if (code == 0) {
+                data[i] = Value();
+                copy_to_vector(dbVal, data[i].value());
+            } else if (code != MDB_NOTFOUND) {
+                throw_error("get_values::mdb_cursor_get", code);
+            }
+        }
+    } catch (std::exception& e) {
+        call_lmdb_func(mdb_cursor_close, cursor);
+        throw;
+    }
+    call_lmdb_func(mdb_cursor_close, cursor);
+}
+
 template <typename TKey, typename TxType>
 void get_all_values_greater_or_equal_key(const TKey& key, ValuesVector& data, const LMDBDatabase& db, const TxType& tx)
 {
@@ -7,6 +7,7 @@
 #include <functional>
 #include <mutex>
 #include <shared_mutex>
+#include <span>
 #include <stdexcept>
 #include <thread>
 #include <utility>
@@ -47,6 +48,18 @@ class MessageDispatcher {
         return (iter->second.handler)(obj, buffer);
     }
 
+    /**
+     * @brief Handles a message read from a buffer owned by the caller
+     * The message is unpacked in place: strings and binary data reference the buffer rather than being copied, so it
+     * must remain valid until the handler returns.
+     */
+    bool on_new_data(std::span<const char> data, msgpack::sbuffer& buffer) const
+    {
+        msgpack::object_handle obj_handle = msgpack::unpack(data.data(), data.size());
+        msgpack::object obj = obj_handle.get();
+        return on_new_data(obj, buffer);
+    }
+
     void register_target(uint32_t msgType, const message_handler& handler, bool unique = false)
     {
         MessageHandler msg_handler{ unique, handler };
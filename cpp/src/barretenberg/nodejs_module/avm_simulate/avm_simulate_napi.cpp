@@ -96,9 +96,15 @@ struct ContractCallbacks {
         return provider.Get(name).As<Napi::Function>();
     }
 };
-} // namespace
 
-Napi::Value AvmSimulateNapi::simulate(const Napi::CallbackInfo& cb_info)
+/**
+ * @brief Shared implementation of simulate and simulateBlock.
+ *
+ * Validates the arguments, then deserializes the Inputs and runs simulate_fn on a worker thread with a contract DB
+ * that calls back into TypeScript and the given WorldState. Its result is serialized with msgpack.
+ */
+template <typename Inputs, typename SimulateFn>
+Napi::Value simulate_with_world_state(const Napi::CallbackInfo& cb_info, SimulateFn simulate_fn)
 {
     // TODO(dbanks12): configurable verbosity (maybe based on TS log level)
     // verbose_logging = true;
@@ -117,8 +123,7 @@ Napi::Value AvmSimulateNapi::simulate(const Napi::CallbackInfo& cb_info)
     }
 
     if (!cb_info[0].IsBuffer()) {
-        throw Napi::TypeError::New(env,
-                                   "First argument must be a Buffer containing serialized AvmFastSimulationInputs");
+        throw Napi::TypeError::New(env, "First argument must be a Buffer containing serialized simulation inputs");
     }
 
     if (!cb_info[1].IsObject()) {
@@ -170,13 +175,13 @@ Napi::Value AvmSimulateNapi::simulate(const Napi::CallbackInfo& cb_info)
     auto deferred = std::make_shared<Napi::Promise::Deferred>(env);
 
     // Create async operation that will run on a worker thread
-    auto* op = new AsyncOperation(env, deferred, [data, tsfns, ws_ptr](msgpack::sbuffer& result_buffer) {
+    auto* op = new AsyncOperation(env, deferred, [data, tsfns, ws_ptr, simulate_fn](msgpack::sbuffer& result_buffer) {
         // Ensure all thread-safe functions are released in all code paths
         TsfnReleaser releaser = TsfnReleaser(tsfns.to_vector());
 
         try {
             // Deserialize inputs from msgpack
-            avm2::AvmFastSimulationInputs inputs;
+            Inputs inputs;
             msgpack::object_handle obj_handle =
                 msgpack::unpack(reinterpret_cast<const char*>(data->data()), data->size());
             msgpack::object obj = obj_handle.get();
@@ -192,10 +197,8 @@ Napi::Value AvmSimulateNapi::simulate(const Napi::CallbackInfo& cb_info)
                                              *tsfns.commit_checkpoint,
                                              *tsfns.revert_checkpoint);
 
-            // Create AVM API and run simulation with the callback-based contracts DB and
-            // WorldState reference
-            avm2::AvmSimAPI avm;
-            avm2::TxSimulationResult result = avm.simulate(inputs, contract_db, *ws_ptr);
+            // Run simulation with the callback-based contracts DB and WorldState reference
+            auto result = simulate_fn(inputs, contract_db, *ws_ptr);
 
             // Serialize the simulation result with msgpack into the return buffer to TS.
             msgpack::pack(result_buffer, result);
@@ -212,6 +215,31 @@ Napi::Value AvmSimulateNapi::simulate(const Napi::CallbackInfo& cb_info)
 
     return deferred->Promise();
 }
+} // namespace
+
+Napi::Value AvmSimulateNapi::simulate(const Napi::CallbackInfo& cb_info)
+{
+    return simulate_with_world_state<avm2::AvmFastSimulationInputs>(
+        cb_info,
+        [](const avm2::AvmFastSimulationInputs& inputs,
+           avm2::simulation::ContractDBInterface& contract_db,
+           world_state::WorldState& ws) {
+            avm2::AvmSimAPI avm;
+            return avm.simulate(inputs, contract_db, ws);
+        });
+}
+
+Napi::Value AvmSimulateNapi::simulateBlock(const Napi::CallbackInfo& cb_info)
+{
+    return simulate_with_world_state<avm2::AvmFastBlockSimulationInputs>(
+        cb_info,
+        [](const avm2::AvmFastBlockSimulationInputs& inputs,
+           avm2::simulation::ContractDBInterface& contract_db,
+           world_state::WorldState& ws) {
+            avm2::AvmSimAPI avm;
+            return avm.simulate_block(inputs, contract_db, ws);
+        });
+}
 
 Napi::Value AvmSimulateNapi::simulateWithHintedDbs(const Napi::CallbackInfo& cb_info)
 {
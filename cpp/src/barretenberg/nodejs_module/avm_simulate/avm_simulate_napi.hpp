@@ -10,7 +10,7 @@ namespace bb::nodejs {
  * This class provides the bridge between TypeScript and the C++ avm_simulate*() functions.
  * It handles deserialization of inputs, execution on a worker thread, and serialization of results.
  *
- * The simulate variation uses real world state and uses callbacks to TS for contract DB.
+ * The simulate and simulateBlock variations use real world state and use callbacks to TS for contract DB.
  *
  * The simulateWithHintedDbs variation uses pre-collected hints for world state and contracts DB.
  * There are no callbacks to TS or direct calls to world state.
@@ -33,6 +33,20 @@ class AvmSimulateNapi {
      * @return Napi::Value Promise that resolves with simulation results
      */
     static Napi::Value simulate(const Napi::CallbackInfo& info);
+    /**
+     * @brief NAPI function to simulate the transactions of a block in order, in parallel where they are independent
+     *
+     * Expected arguments:
+     * - info[0]: Buffer containing serialized AvmFastBlockSimulationInputs (msgpack)
+     * - info[1]: Object with contract provider callbacks, as for simulate
+     * - info[2]: External WorldState handle (pointer to world_state::WorldState)
+     *
+     * Returns: Promise<Buffer> containing the serialized simulation results, one per transaction
+     *
+     * @param info NAPI callback info containing arguments
+     * @return Napi::Value Promise that resolves with simulation results
+     */
+    static Napi::Value simulateBlock(const Napi::CallbackInfo& info);
     /**
      * @brief NAPI function to simulate AVM execution with pre-collected hints
      *
@@ -14,6 +14,8 @@ Napi::Object Init(Napi::Env env, Napi::Object exports)
     exports.Set(Napi::String::New(env, "MsgpackClientAsync"),
                 bb::nodejs::msgpack_client::MsgpackClientAsync::get_class(env));
     exports.Set(Napi::String::New(env, "avmSimulate"), Napi::Function::New(env, bb::nodejs::AvmSimulateNapi::simulate));
+    exports.Set(Napi::String::New(env, "avmSimulateBlock"),
+                Napi::Function::New(env, bb::nodejs::AvmSimulateNapi::simulateBlock));
     exports.Set(Napi::String::New(env, "avmSimulateWithHintedDbs"),
                 Napi::Function::New(env, bb::nodejs::AvmSimulateNapi::simulateWithHintedDbs));
     return exports;
@@ -19,6 +19,7 @@ using namespace bb::nodejs::lmdb_store;
 const uint64_t DEFAULT_MAP_SIZE = 1024UL * 1024;
 const uint64_t DEFAULT_MAX_READERS = 16;
 const uint64_t DEFAULT_CURSOR_PAGE_SIZE = 10;
+const uint64_t DEFAULT_MESSAGE_WORKERS = 4;
 
 LMDBStoreWrapper::LMDBStoreWrapper(const Napi::CallbackInfo& info)
     : ObjectWrap(info)
@@ -53,6 +54,16 @@ LMDBStoreWrapper::LMDBStoreWrapper(const Napi::CallbackInfo& info)
         }
     }
 
+    size_t message_workers_index = 3;
+    uint64_t message_workers = DEFAULT_MESSAGE_WORKERS;
+    if (info.Length() > message_workers_index) {
+        if (info[message_workers_index].IsNumber()) {
+            message_workers = info[message_workers_index].As<Napi::Number>().Uint32Value();
+        } else if (!info[message_workers_index].IsUndefined()) {
+            throw Napi::TypeError::New(env, "The number of message workers must be a number");
+        }
+    }
+
     _store = std::make_unique<lmdblib::LMDBStore>(data_dir, map_size, max_readers, 2);
 
     _msg_processor.register_handler(LMDBStoreMessageType::OPEN_DATABASE, this, &LMDBStoreWrapper::open_database);
@@ -74,6 +85,8 @@ LMDBStoreWrapper::LMDBStoreWrapper(const Napi::CallbackInfo& info)
     _msg_processor.register_handler(LMDBStoreMessageType::CLOSE, this, &LMDBStoreWrapper::close, true);
 
     _msg_processor.register_handler(LMDBStoreMessageType::COPY_STORE, this, &LMDBStoreWrapper::copy_store, true);
+
+    _msg_processor.start(env, message_workers);
 }
 
 Napi::Value LMDBStoreWrapper::call(const Napi::CallbackInfo& info)
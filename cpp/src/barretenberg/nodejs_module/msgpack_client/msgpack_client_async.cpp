@@ -1,7 +1,9 @@
 #include "barretenberg/nodejs_module/msgpack_client/msgpack_client_async.hpp"
 #include "barretenberg/ipc/ipc_client.hpp"
+#include "barretenberg/ipc/shm/blob_arena.hpp"
 #include "napi.h"
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 using namespace bb::nodejs::msgpack_client;
@@ -122,6 +124,35 @@ Napi::Value MsgpackClientAsync::call(const Napi::CallbackInfo& info)
     return env.Undefined();
 }
 
+Napi::Value MsgpackClientAsync::writeBlob(const Napi::CallbackInfo& info)
+{
+    Napi::Env env = info.Env();
+
+    // Arg 0: payload to copy into the arena
+    if (info.Length() < 1 || !info[0].IsBuffer()) {
+        throw Napi::TypeError::New(env, "First argument must be a Buffer");
+    }
+
+    bb::ipc::BlobArena* arena = client_->blob_arena();
+    if (arena == nullptr) {
+        return env.Null();
+    }
+    auto payload = info[0].As<Napi::Buffer<uint8_t>>();
+    std::optional<uint64_t> offset = arena->write({ payload.Data(), payload.Length() });
+    if (!offset.has_value()) {
+        return env.Null();
+    }
+    return Napi::Number::New(env, static_cast<double>(*offset));
+}
+
+Napi::Value MsgpackClientAsync::resetBlobs(const Napi::CallbackInfo& info)
+{
+    if (bb::ipc::BlobArena* arena = client_->blob_arena(); arena != nullptr) {
+        arena->reset();
+    }
+    return info.Env().Undefined();
+}
+
 Napi::Value MsgpackClientAsync::acquire(const Napi::CallbackInfo& info)
 {
     Napi::Env env = info.Env();
@@ -165,6 +196,8 @@ Napi::Function MsgpackClientAsync::get_class(Napi::Env env)
         {
             MsgpackClientAsync::InstanceMethod("setResponseCallback", &MsgpackClientAsync::setResponseCallback),
             MsgpackClientAsync::InstanceMethod("call", &MsgpackClientAsync::call),
+            MsgpackClientAsync::InstanceMethod("writeBlob", &MsgpackClientAsync::writeBlob),
+            MsgpackClientAsync::InstanceMethod("resetBlobs", &MsgpackClientAsync::resetBlobs),
             MsgpackClientAsync::InstanceMethod("acquire", &MsgpackClientAsync::acquire),
             MsgpackClientAsync::InstanceMethod("release", &MsgpackClientAsync::release),
         });
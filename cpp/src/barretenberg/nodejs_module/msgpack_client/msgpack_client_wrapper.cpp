@@ -1,7 +1,9 @@
 #include "barretenberg/nodejs_module/msgpack_client/msgpack_client_wrapper.hpp"
 #include "barretenberg/ipc/ipc_client.hpp"
+#include "barretenberg/ipc/shm/blob_arena.hpp"
 #include "napi.h"
 #include <cstdint>
+#include <optional>
 #include <vector>
 
 using namespace bb::nodejs::msgpack_client;
@@ -76,6 +78,39 @@ Napi::Value MsgpackClientWrapper::call(const Napi::CallbackInfo& info)
     return js_buffer;
 }
 
+Napi::Value MsgpackClientWrapper::writeBlob(const Napi::CallbackInfo& info)
+{
+    Napi::Env env = info.Env();
+
+    if (!connected_) {
+        throw Napi::Error::New(env, "Client is not connected");
+    }
+
+    // Arg 0: payload to copy into the arena
+    if (info.Length() < 1 || !info[0].IsBuffer()) {
+        throw Napi::TypeError::New(env, "First argument must be a Buffer");
+    }
+
+    bb::ipc::BlobArena* arena = client_->blob_arena();
+    if (arena == nullptr) {
+        return env.Null();
+    }
+    auto payload = info[0].As<Napi::Buffer<uint8_t>>();
+    std::optional<uint64_t> offset = arena->write({ payload.Data(), payload.Length() });
+    if (!offset.has_value()) {
+        return env.Null();
+    }
+    return Napi::Number::New(env, static_cast<double>(*offset));
+}
+
+Napi::Value MsgpackClientWrapper::resetBlobs(const Napi::CallbackInfo& info)
+{
+    if (bb::ipc::BlobArena* arena = client_->blob_arena(); arena != nullptr) {
+        arena->reset();
+    }
+    return info.Env().Undefined();
+}
+
 Napi::Value MsgpackClientWrapper::close(const Napi::CallbackInfo& info)
 {
     Napi::Env env = info.Env();
@@ -94,6 +129,8 @@ Napi::Function MsgpackClientWrapper::get_class(Napi::Env env)
                        "MsgpackClient",
                        {
                            MsgpackClientWrapper::InstanceMethod("call", &MsgpackClientWrapper::call),
+                           MsgpackClientWrapper::InstanceMethod("writeBlob", &MsgpackClientWrapper::writeBlob),
+                           MsgpackClientWrapper::InstanceMethod("resetBlobs", &MsgpackClientWrapper::resetBlobs),
                            MsgpackClientWrapper::InstanceMethod("close", &MsgpackClientWrapper::close),
                        });
 }
@@ -24,6 +24,19 @@ class MsgpackClientWrapper : public Napi::ObjectWrap<MsgpackClientWrapper> {
      */
     Napi::Value call(const Napi::CallbackInfo& info);
 
+    /**
+     * @brief Copy a large payload into the server's blob arena, to be referenced by a BlobRef in a request
+     * @param info[0] - Buffer containing the payload
+     * @returns The offset of the payload in the arena, or null if there is no arena or it is full (the payload must
+     * then be sent inline)
+     */
+    Napi::Value writeBlob(const Napi::CallbackInfo& info);
+
+    /**
+     * @brief Free every payload in the blob arena; only valid once all requests referencing them have been answered
+     */
+    Napi::Value resetBlobs(const Napi::CallbackInfo& info);
+
     /**
      * @brief Close the shared memory connection
      */
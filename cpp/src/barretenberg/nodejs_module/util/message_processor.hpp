@@ -2,9 +2,13 @@
 
 #include "barretenberg/messaging/dispatcher.hpp"
 #include "barretenberg/messaging/header.hpp"
-#include "barretenberg/nodejs_module/util/async_op.hpp"
+#include "barretenberg/nodejs_module/util/promise.hpp"
+#include "barretenberg/nodejs_module/util/worker_pool.hpp"
 #include "napi.h"
 #include <atomic>
+#include <cstddef>
+#include <memory>
+#include <span>
 
 namespace bb::nodejs {
 
@@ -61,39 +65,34 @@ class AsyncMessageProcessor {
             unique);
     }
 
+    /**
+     * @brief Starts the threads messages are executed on. Must be called before any message is processed.
+     */
+    void start(Napi::Env env, size_t num_workers) { workers = std::make_unique<MessageWorkerPool>(env, num_workers); }
+
     Napi::Promise process_message(const Napi::CallbackInfo& info)
     {
         Napi::Env env = info.Env();
-        // keep this in a shared pointer so that AsyncOperation can resolve/reject the promise once the execution is
-        // complete on an separate thread
-        auto deferred = std::make_shared<Napi::Promise::Deferred>(env);
 
         if (!open) {
-            deferred->Reject(Napi::TypeError::New(env, "Message processor is closed").Value());
-        } else if (info.Length() < 1) {
-            deferred->Reject(Napi::TypeError::New(env, "Wrong number of arguments").Value());
-        } else if (!info[0].IsBuffer()) {
-            deferred->Reject(Napi::TypeError::New(env, "Argument must be a buffer").Value());
-        } else {
-            auto buffer = info[0].As<Napi::Buffer<char>>();
-            size_t length = buffer.Length();
-            // we mustn't access the Napi::Env outside of this top-level function
-            // so copy the data to a variable we own
-            // and make it a shared pointer so that it doesn't get destroyed as soon as we exit this code block
-            auto data = std::make_shared<std::vector<char>>(length);
-            std::copy_n(buffer.Data(), length, data->data());
-
-            auto* op = new bb::nodejs::AsyncOperation(env, deferred, [data, this, length](msgpack::sbuffer& buf) {
-                msgpack::object_handle obj_handle = msgpack::unpack(data->data(), length);
-                msgpack::object obj = obj_handle.get();
-                dispatcher.on_new_data(obj, buf);
-            });
-
-            // Napi is now responsible for destroying this object
-            op->Queue();
+            return promise_reject(env, Napi::TypeError::New(env, "Message processor is closed").Value());
+        }
+        if (!workers) {
+            return promise_reject(env, Napi::TypeError::New(env, "Message processor has not been started").Value());
+        }
+        if (info.Length() < 1) {
+            return promise_reject(env, Napi::TypeError::New(env, "Wrong number of arguments").Value());
+        }
+        if (!info[0].IsBuffer()) {
+            return promise_reject(env, Napi::TypeError::New(env, "Argument must be a buffer").Value());
         }
 
-        return deferred->Promise();
+        // The request is read in place by the worker, which keeps the buffer alive until the message completes
+        return workers->execute(env,
+                                info[0].As<Napi::Buffer<char>>(),
+                                [this](std::span<const char> request, msgpack::sbuffer& buf) {
+                                    dispatcher.on_new_data(request, buf);
+                                });
     }
 
     void close() { open = false; }
@@ -101,6 +100,8 @@ class AsyncMessageProcessor {
   private:
     bb::messaging::MessageDispatcher dispatcher;
     std::atomic_bool open = true;
+    // Declared last so that the messages in flight complete before the handlers they use are destroyed
+    std::unique_ptr<MessageWorkerPool> workers;
 
     template <typename P, typename R>
     void _register_handler(uint32_t msgType,
@@ -0,0 +1,82 @@
+#include "barretenberg/nodejs_module/util/worker_pool.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <utility>
+
+namespace bb::nodejs {
+
+MessageWorkerPool::MessageWorkerPool(Napi::Env env, size_t num_threads)
+    : _state(std::make_shared<State>())
+    , _workers(std::make_unique<ThreadPool>(std::max<size_t>(num_threads, 1)))
+{
+    _state->completions = CompletionQueue::New(env, "MessageWorkerPoolCompletion", 0, 1);
+    // Idle until a message is executed
+    _state->completions.Unref(env);
+}
+
+MessageWorkerPool::~MessageWorkerPool()
+{
+    // Joining the workers executes the messages already queued, their completions are delivered after the release
+    _workers.reset();
+    _state->completions.Release();
+}
+
+Napi::Promise MessageWorkerPool::execute(Napi::Env env, const Napi::Buffer<char>& request, message_fn fn)
+{
+    auto* completion = new Completion{ .state = _state,
+                                       .deferred = Napi::Promise::Deferred::New(env),
+                                       .request = Napi::Persistent(request),
+                                       .response = {},
+                                       .error = std::nullopt };
+    Napi::Promise promise = completion->deferred.Promise();
+    if (_state->in_flight++ == 0) {
+        _state->completions.Ref(env);
+    }
+
+    std::span<const char> data(request.Data(), request.Length());
+    _workers->enqueue([completion, data, fn = std::move(fn)]() {
+        try {
+            fn(data, completion->response);
+        } catch (const std::exception& e) {
+            completion->error = e.what();
+        } catch (...) {
+            // Catch any other exception type that's not derived from std::exception
+            // This ensures the promise is always rejected rather than leaving it hanging
+            completion->error = "Unknown exception occurred during async operation";
+        }
+        // The queue is unbounded, so this never blocks
+        completion->state->completions.BlockingCall(completion);
+    });
+
+    return promise;
+}
+
+void MessageWorkerPool::complete(Napi::Env env,
+                                 Napi::Function /*unused*/,
+                                 std::nullptr_t* /*context*/,
+                                 Completion* completion)
+{
+    std::unique_ptr<Completion> owned(completion);
+    if (env == nullptr) {
+        // The environment is being torn down, there is nothing left to settle or release
+        owned->request.SuppressDestruct();
+        return;
+    }
+
+    State& state = *owned->state;
+    if (--state.in_flight == 0) {
+        state.completions.Unref(env);
+    }
+
+    if (owned->error.has_value()) {
+        owned->deferred.Reject(Napi::Error::New(env, owned->error.value()).Value());
+        return;
+    }
+    size_t size = owned->response.size();
+    char* data = owned->response.release();
+    owned->deferred.Resolve(
+        Napi::Buffer<char>::NewOrCopy(env, data, size, [](Napi::Env /*unused*/, char* response) { free(response); }));
+}
+
+} // namespace bb::nodejs
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <napi.h>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace bb::nodejs {
+
+using message_fn = std::function<void(std::span<const char>, msgpack::sbuffer&)>;
+
+/**
+ * @brief Executes messages from JavaScript on a dedicated pool of C++ threads
+ *
+ * AsyncOperation runs on the libuv thread pool, which is small (4 threads by default) and shared with all of Node's
+ * own asynchronous I/O, so busy message handlers queue behind file system operations and each other. Each owner of a
+ * MessageWorkerPool sizes its own instead.
+ *
+ * Messages are also handed over without copies:
+ * - the request buffer is read in place by the worker, a reference to it being held until the message completes. JS
+ *   must therefore not modify a buffer after sending it, which the clients never do.
+ * - the response is passed to JS as an external buffer that takes ownership of the memory msgpack packed it into,
+ *   unless the runtime doesn't allow external buffers in which case it is copied.
+ *
+ * Completions are delivered to the JS thread through a thread-safe function, which keeps the event loop alive only
+ * while messages are in flight.
+ */
+class MessageWorkerPool {
+  public:
+    MessageWorkerPool(Napi::Env env, size_t num_threads);
+    MessageWorkerPool(const MessageWorkerPool&) = delete;
+    MessageWorkerPool& operator=(const MessageWorkerPool&) = delete;
+    MessageWorkerPool(MessageWorkerPool&&) = delete;
+    MessageWorkerPool& operator=(MessageWorkerPool&&) = delete;
+    /**
+     * @brief Waits for the messages in flight to be executed. Must be called on the JS thread.
+     */
+    ~MessageWorkerPool();
+
+    /**
+     * @brief Executes fn with the contents of request on a worker thread. Must be called on the JS thread.
+     *
+     * @return A promise resolved with the buffer fn packed its response into, or rejected with the error it threw
+     */
+    Napi::Promise execute(Napi::Env env, const Napi::Buffer<char>& request, message_fn fn);
+
+  private:
+    struct Completion;
+    static void complete(Napi::Env env, Napi::Function unused, std::nullptr_t* context, Completion* completion);
+    using CompletionQueue = Napi::TypedThreadSafeFunction<std::nullptr_t, Completion, complete>;
+
+    // Shared with the completions so that those still queued when the pool is destroyed can be delivered
+    struct State {
+        CompletionQueue completions;
+        // Only accessed on the JS thread
+        size_t in_flight = 0;
+    };
+
+    struct Completion {
+        std::shared_ptr<State> state;
+        Napi::Promise::Deferred deferred;
+        Napi::Reference<Napi::Buffer<char>> request;
+        msgpack::sbuffer response;
+        std::optional<std::string> error;
+    };
+
+    std::shared_ptr<State> _state;
+    std::unique_ptr<ThreadPool> _workers;
+};
+
+} // namespace bb::nodejs
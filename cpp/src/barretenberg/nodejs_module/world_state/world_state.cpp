@@ -7,6 +7,7 @@
 #include <iostream>
 #include <memory>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <sys/types.h>
@@ -18,7 +19,7 @@
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/messaging/header.hpp"
-#include "barretenberg/nodejs_module/util/async_op.hpp"
+#include "barretenberg/nodejs_module/util/promise.hpp"
 #include "barretenberg/nodejs_module/world_state/world_state.hpp"
 #include "barretenberg/nodejs_module/world_state/world_state_message.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
@@ -32,6 +33,7 @@ using namespace bb::crypto::merkle_tree;
 using namespace bb::messaging;
 
 const uint64_t DEFAULT_MAP_SIZE = 1024UL * 1024;
+const uint64_t DEFAULT_MESSAGE_WORKERS = 8;
 
 WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
     : ObjectWrap(info)
@@ -149,6 +151,27 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
         thread_pool_size = info[thread_pool_size_index].As<Napi::Number>().Uint32Value();
     }
 
+    uint64_t message_workers = DEFAULT_MESSAGE_WORKERS;
+    size_t message_workers_index = 7;
+    if (info.Length() > message_workers_index && !info[message_workers_index].IsUndefined()) {
+        if (!info[message_workers_index].IsNumber()) {
+            throw Napi::TypeError::New(env, "The number of message workers must be a number");
+        }
+
+        message_workers = info[message_workers_index].As<Napi::Number>().Uint32Value();
+    }
+
+    // Opt-in, see WorldState::set_group_commit for the durability trade-off
+    bool group_commit = false;
+    size_t group_commit_index = 8;
+    if (info.Length() > group_commit_index && !info[group_commit_index].IsUndefined()) {
+        if (!info[group_commit_index].IsBoolean()) {
+            throw Napi::TypeError::New(env, "Group commit must be a boolean");
+        }
+
+        group_commit = info[group_commit_index].As<Napi::Boolean>().Value();
+    }
+
     _ws = std::make_unique<WorldState>(thread_pool_size,
                                        data_dir,
                                        map_size,
@@ -156,6 +179,7 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
                                        tree_prefill,
                                        prefilled_public_data,
                                        initial_header_generator_point);
+    _ws->set_group_commit(group_commit);
 
     _dispatcher.register_target(
         WorldStateMessageType::GET_TREE_INFO,
@@ -274,41 +298,29 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
     _dispatcher.register_target(
         WorldStateMessageType::COPY_STORES,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return copy_stores(obj, buffer); });
+
+    _workers = std::make_unique<MessageWorkerPool>(env, message_workers);
 }
 
 Napi::Value WorldStateWrapper::call(const Napi::CallbackInfo& info)
 {
     Napi::Env env = info.Env();
-    // keep this in a shared pointer so that AsyncOperation can resolve/reject the promise once the execution is
-    // complete on an separate thread
-    auto deferred = std::make_shared<Napi::Promise::Deferred>(env);
 
     if (info.Length() < 1) {
-        deferred->Reject(Napi::TypeError::New(env, "Wrong number of arguments").Value());
-    } else if (!info[0].IsBuffer()) {
-        deferred->Reject(Napi::TypeError::New(env, "Argument must be a buffer").Value());
-    } else if (!_ws) {
-        deferred->Reject(Napi::TypeError::New(env, "World state has been closed").Value());
-    } else {
-        auto buffer = info[0].As<Napi::Buffer<char>>();
-        size_t length = buffer.Length();
-        // we mustn't access the Napi::Env outside of this top-level function
-        // so copy the data to a variable we own
-        // and make it a shared pointer so that it doesn't get destroyed as soon as we exit this code block
-        auto data = std::make_shared<std::vector<char>>(length);
-        std::copy_n(buffer.Data(), length, data->data());
-
-        auto* op = new AsyncOperation(env, deferred, [=, this](msgpack::sbuffer& buf) {
-            msgpack::object_handle obj_handle = msgpack::unpack(data->data(), length);
-            msgpack::object obj = obj_handle.get();
-            _dispatcher.on_new_data(obj, buf);
-        });
-
-        // Napi is now responsible for destroying this object
-        op->Queue();
+        return promise_reject(env, Napi::TypeError::New(env, "Wrong number of arguments").Value());
+    }
+    if (!info[0].IsBuffer()) {
+        return promise_reject(env, Napi::TypeError::New(env, "Argument must be a buffer").Value());
+    }
+    if (!_ws) {
+        return promise_reject(env, Napi::TypeError::New(env, "World state has been closed").Value());
     }
 
-    return deferred->Promise();
+    // The request is read in place by the worker, which keeps the buffer alive until the message completes
+    return _workers->execute(
+        env, info[0].As<Napi::Buffer<char>>(), [this](std::span<const char> request, msgpack::sbuffer& buf) {
+            _dispatcher.on_new_data(request, buf);
+        });
 }
 
 Napi::Value WorldStateWrapper::getHandle(const Napi::CallbackInfo& info)
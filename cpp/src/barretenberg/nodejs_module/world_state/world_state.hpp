@@ -1,6 +1,7 @@
 #pragma once
 
 #include "barretenberg/messaging/dispatcher.hpp"
+#include "barretenberg/nodejs_module/util/worker_pool.hpp"
 #include "barretenberg/nodejs_module/world_state/world_state_message.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include "barretenberg/world_state/world_state.hpp"
@@ -36,6 +37,8 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
   private:
     std::unique_ptr<bb::world_state::WorldState> _ws;
     bb::messaging::MessageDispatcher _dispatcher;
+    // Destroyed first, so that the messages in flight complete before the world state is destroyed
+    std::unique_ptr<MessageWorkerPool> _workers;
 
     bool get_tree_info(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_state_reference(msgpack::object& obj, msgpack::sbuffer& buffer) const;
@@ -56,6 +56,21 @@ template <typename Fr> struct BackingMemory {
         }
     };
     std::shared_ptr<FileBackedData> file_backed;
+
+    // Private (copy-on-write) mapping of a region of an existing file, e.g. a persistent polynomial cache. Unlike
+    // FileBackedData, the file is neither owned nor counted towards the storage budget.
+    struct MappedFileData {
+        void* addr;
+        size_t length;
+
+        ~MappedFileData()
+        {
+            if (addr != nullptr && length > 0) {
+                munmap(addr, length);
+            }
+        }
+    };
+    std::shared_ptr<MappedFileData> mapped_file;
 #endif
     // Aligned memory data substruct
     std::shared_ptr<Fr[]> aligned_memory;
@@ -69,6 +84,7 @@ template <typename Fr> struct BackingMemory {
         : raw_data(other.raw_data)
 #ifndef __wasm__
         , file_backed(std::move(other.file_backed))
+        , mapped_file(std::move(other.mapped_file))
 #endif
         , aligned_memory(std::move(other.aligned_memory))
     {
@@ -81,6 +97,7 @@ template <typename Fr> struct BackingMemory {
             raw_data = other.raw_data;
 #ifndef __wasm__
             file_backed = std::move(other.file_backed);
+            mapped_file = std::move(other.mapped_file);
 #endif
             aligned_memory = std::move(other.aligned_memory);
             other.raw_data = nullptr;
@@ -103,6 +120,33 @@ template <typename Fr> struct BackingMemory {
         return memory;
     }
 
+#ifndef __wasm__
+    /**
+     * @brief Map `size` elements of the file `fd`, starting at the page-aligned byte `offset`, as backing memory.
+     * @details The mapping is private: the pages are shared (through the page cache) with every other process mapping
+     * the same file until they are written to, at which point the writing process gets its own copy. Returns an empty
+     * BackingMemory (raw_data == nullptr) if the mapping fails.
+     */
+    static BackingMemory map_file(int fd, size_t offset, size_t size)
+    {
+        BackingMemory memory;
+        if (size == 0) {
+            return memory;
+        }
+        const size_t length = size * sizeof(Fr);
+        void* addr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, static_cast<off_t>(offset));
+        if (addr == MAP_FAILED) {
+            return memory;
+        }
+        auto mapped_file_data = std::make_shared<MappedFileData>();
+        mapped_file_data->addr = addr;
+        mapped_file_data->length = length;
+        memory.mapped_file = std::move(mapped_file_data);
+        memory.raw_data = static_cast<Fr*>(addr);
+        return memory;
+    }
+#endif
+
     ~BackingMemory() = default;
 
   private:
@@ -132,6 +132,18 @@ template <typename Fr> Polynomial<Fr>::Polynomial(std::span<const Fr> coefficien
     memcpy(static_cast<void*>(data()), static_cast<const void*>(coefficients.data()), sizeof(Fr) * coefficients.size());
 }
 
+template <typename Fr>
+Polynomial<Fr>::Polynomial(BackingMemory<Fr> memory, size_t size, size_t virtual_size, size_t start_index)
+{
+    BB_ASSERT_LTE(start_index + size, virtual_size);
+    coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{
+        start_index,        /* start index, used for shifted polynomials and offset 'islands' of non-zeroes */
+        size + start_index, /* end index, actual memory used is (end - start) */
+        virtual_size,       /* virtual size, i.e. until what size do we conceptually have zeroes */
+        std::move(memory)
+    };
+}
+
 // Assignments
 
 // full copy "expensive" assignment
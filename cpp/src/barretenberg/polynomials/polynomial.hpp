@@ -96,6 +96,8 @@ template <typename Fr> class Polynomial {
     Polynomial(Polynomial&& other) noexcept = default;
 
     Polynomial(std::span<const Fr> coefficients, size_t virtual_size);
+    // Wrap existing backing memory holding (at least) `size` initialized coefficients
+    Polynomial(BackingMemory<Fr> memory, size_t size, size_t virtual_size, size_t start_index);
 
     Polynomial(std::span<const Fr> coefficients)
         : Polynomial(coefficients, coefficients.size())
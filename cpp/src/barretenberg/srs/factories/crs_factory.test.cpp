@@ -100,3 +100,44 @@ TEST(CrsFactory, grumpkin)
     ASSERT_ANY_THROW(check_grumpkin_consistency(temp_crs_path, 1, /*allow_download=*/false));
     check_grumpkin_consistency(temp_crs_path, 1, /*allow_download=*/true);
 }
+
+TEST(CrsFactory, MappedCrsCache)
+{
+    constexpr size_t num_points = 1024;
+    const fs::path temp_crs_path = "barretenberg_srs_test_crs_mapped";
+    fs::remove_all(temp_crs_path);
+    fs::create_directories(temp_crs_path);
+    const auto g1_data = read_file(bb::srs::bb_crs_path() / "bn254_g1.dat", num_points * sizeof(g1::affine_element));
+    write_file(temp_crs_path / "bn254_g1.dat", g1_data);
+
+    // The first load validates the points and writes the native-layout cache
+    check_bn254_consistency(temp_crs_path, num_points, /*allow_download=*/false);
+    ASSERT_TRUE(fs::exists(temp_crs_path / "bn254_g1.native.dat"));
+
+    // Later loads map the cache directly, even without the original point file
+    fs::remove(temp_crs_path / "bn254_g1.dat");
+    check_bn254_consistency(temp_crs_path, num_points, /*allow_download=*/false);
+
+    // A cache corrupted anywhere in its point range, or truncated, is rejected and repopulated
+    const fs::path cache_path = temp_crs_path / "bn254_g1.native.dat";
+    const auto cache_size = fs::file_size(cache_path);
+    auto corrupt_cache = [&](std::streamoff offset) {
+        std::fstream cache(cache_path, std::ios::binary | std::ios::in | std::ios::out);
+        cache.seekg(offset);
+        const auto byte = static_cast<char>(cache.get() ^ 0x01);
+        cache.seekp(offset);
+        cache.put(byte);
+    };
+    for (std::streamoff offset : { std::streamoff(64), static_cast<std::streamoff>(cache_size) - 1 }) {
+        corrupt_cache(offset);
+        write_file(temp_crs_path / "bn254_g1.dat", g1_data);
+        check_bn254_consistency(temp_crs_path, num_points, /*allow_download=*/false);
+        fs::remove(temp_crs_path / "bn254_g1.dat");
+        check_bn254_consistency(temp_crs_path, num_points, /*allow_download=*/false);
+    }
+    fs::resize_file(cache_path, cache_size - sizeof(g1::affine_element));
+    write_file(temp_crs_path / "bn254_g1.dat", g1_data);
+    check_bn254_consistency(temp_crs_path, num_points, /*allow_download=*/false);
+    EXPECT_EQ(fs::file_size(cache_path), cache_size);
+    fs::remove_all(temp_crs_path);
+}
@@ -0,0 +1,285 @@
+#include "mapped_crs.hpp"
+#include "barretenberg/common/content_digest.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/curves/bn254/pairing.hpp"
+#include "bn254_crs_data.hpp"
+#include "get_bn254_crs.hpp"
+#include "get_grumpkin_crs.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+
+#if !defined(__wasm__) && !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define BB_MAPPED_CRS
+#endif
+
+namespace {
+
+using namespace bb;
+using namespace bb::srs::factories;
+
+#ifdef BB_MAPPED_CRS
+
+constexpr uint64_t NATIVE_CRS_MAGIC = 0x53524354414e4242; // "BBNATCRS" in little-endian
+constexpr uint64_t NATIVE_CRS_VERSION = 2;
+// Offset of the first point; keeps the points aligned to the 32-byte alignment of their coordinates
+constexpr size_t NATIVE_CRS_DATA_OFFSET = 64;
+
+struct NativeCrsHeader {
+    uint64_t magic;
+    uint64_t version;
+    uint64_t point_size;
+    uint64_t num_points;
+    uint64_t digest;
+};
+static_assert(sizeof(NativeCrsHeader) <= NATIVE_CRS_DATA_OFFSET);
+
+/**
+ * @brief A private mapping of a native-layout point cache.
+ * @details The Crs interface hands out mutable spans, so the mapping is writable; being MAP_PRIVATE, its pages stay
+ * shared with every other mapping of the file unless they are written to.
+ */
+template <typename AffineElement> class MappedPoints {
+  public:
+    MappedPoints(void* addr, size_t length, size_t num_points)
+        : addr_(addr)
+        , length_(length)
+        , num_points_(num_points)
+    {}
+    MappedPoints(const MappedPoints&) = delete;
+    MappedPoints(MappedPoints&&) = delete;
+    MappedPoints& operator=(const MappedPoints&) = delete;
+    MappedPoints& operator=(MappedPoints&&) = delete;
+    ~MappedPoints() { munmap(addr_, length_); }
+
+    std::span<AffineElement> points() const
+    {
+        return { reinterpret_cast<AffineElement*>(static_cast<uint8_t*>(addr_) + NATIVE_CRS_DATA_OFFSET),
+                 num_points_ };
+    }
+
+    /**
+     * @brief Map the cache at `path` if it is well-formed, holds at least `min_points` points and all of its points
+     * match the digest in its header.
+     */
+    static std::shared_ptr<MappedPoints> open(const std::filesystem::path& path, size_t min_points)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+        std::shared_ptr<MappedPoints> mapped;
+        NativeCrsHeader header{};
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) == 0 &&
+            pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+            header.magic == NATIVE_CRS_MAGIC && header.version == NATIVE_CRS_VERSION &&
+            header.point_size == sizeof(AffineElement) && header.num_points > 0 && header.num_points >= min_points &&
+            static_cast<uint64_t>(file_stat.st_size) >=
+                NATIVE_CRS_DATA_OFFSET + header.num_points * sizeof(AffineElement)) {
+            const size_t length = NATIVE_CRS_DATA_OFFSET + header.num_points * sizeof(AffineElement);
+            void* addr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                mapped = std::make_shared<MappedPoints>(addr, length, header.num_points);
+                if (content_digest<AffineElement>(mapped->points()) != header.digest) {
+                    mapped = nullptr;
+                }
+            }
+        }
+        // The mapping holds its own reference to the file
+        close(fd);
+        return mapped;
+    }
+
+    /**
+     * @brief Write `points` to the cache at `path`, returning whether the cache was written.
+     * @details The file is written under a process-unique name and renamed into place, so concurrent readers never
+     * observe a partially written cache.
+     */
+    static bool write(const std::filesystem::path& path, std::span<const AffineElement> points)
+    {
+        auto tmp_path = path;
+        tmp_path += ".tmp" + std::to_string(getpid());
+        std::error_code error;
+        {
+            NativeCrsHeader header{ .magic = NATIVE_CRS_MAGIC,
+                                    .version = NATIVE_CRS_VERSION,
+                                    .point_size = sizeof(AffineElement),
+                                    .num_points = points.size(),
+                                    .digest = content_digest(points) };
+            std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.seekp(static_cast<std::streamoff>(NATIVE_CRS_DATA_OFFSET));
+            file.write(reinterpret_cast<const char*>(points.data()),
+                       static_cast<std::streamsize>(points.size() * sizeof(AffineElement)));
+            if (!file) {
+                std::filesystem::remove(tmp_path, error);
+                return false;
+            }
+        }
+        std::filesystem::rename(tmp_path, path, error);
+        if (error) {
+            std::filesystem::remove(tmp_path, error);
+            return false;
+        }
+        return true;
+    }
+
+  private:
+    void* addr_;
+    size_t length_;
+    size_t num_points_;
+};
+
+/**
+ * @brief Map the native-layout cache at `cache_path`, populating it from `load_points()` if it is missing, too small,
+ * damaged or fails `is_valid_cache` (e.g. because it was written by a build with a different field representation).
+ * @details Every point is checked to be on the curve before the cache is written; afterwards the points are trusted
+ * as-is, exactly like the in-memory CRS trusts the points it was constructed from.
+ */
+template <typename AffineElement, typename LoadPoints, typename IsValidCache>
+std::shared_ptr<MappedPoints<AffineElement>> map_points(const std::filesystem::path& cache_path,
+                                                        size_t num_points,
+                                                        const LoadPoints& load_points,
+                                                        const IsValidCache& is_valid_cache)
+{
+    using Mapped = MappedPoints<AffineElement>;
+    if (auto mapped = Mapped::open(cache_path, num_points); mapped && is_valid_cache(mapped->points()[0])) {
+        vinfo("mapping native crs with num points ", mapped->points().size(), " at ", cache_path);
+        return mapped;
+    }
+
+    std::vector<AffineElement> points = load_points();
+    std::atomic<bool> all_on_curve = true;
+    parallel_for([&](const ThreadChunk& chunk) {
+        for (size_t i : chunk.range(points.size())) {
+            if (!points[i].on_curve()) {
+                all_on_curve = false;
+                return;
+            }
+        }
+    });
+    if (points.empty() || !all_on_curve || !Mapped::write(cache_path, points)) {
+        vinfo("could not write native crs cache at ", cache_path);
+        return nullptr;
+    }
+    vinfo("wrote native crs cache with num points ", points.size(), " at ", cache_path);
+    return Mapped::open(cache_path, num_points);
+}
+
+class MappedBn254Crs : public Crs<curve::BN254> {
+    using Curve = curve::BN254;
+
+  public:
+    MappedBn254Crs(const MappedBn254Crs&) = delete;
+    MappedBn254Crs(MappedBn254Crs&&) = delete;
+    MappedBn254Crs& operator=(const MappedBn254Crs&) = delete;
+    MappedBn254Crs& operator=(MappedBn254Crs&&) = delete;
+
+    MappedBn254Crs(std::shared_ptr<MappedPoints<Curve::AffineElement>> points, g2::affine_element const& g2_point)
+        : g2_x(g2_point)
+        , precomputed_g2_lines(
+              static_cast<pairing::miller_lines*>(aligned_alloc(64, sizeof(bb::pairing::miller_lines) * 2)))
+        , points_(std::move(points))
+    {
+        bb::pairing::precompute_miller_lines(bb::g2::one, precomputed_g2_lines[0]);
+        bb::pairing::precompute_miller_lines(g2_x, precomputed_g2_lines[1]);
+    }
+
+    ~MappedBn254Crs() override { aligned_free(precomputed_g2_lines); }
+
+    std::span<Curve::AffineElement> get_monomial_points() override { return points_->points(); }
+
+    size_t get_monomial_size() const override { return points_->points().size(); }
+
+    g2::affine_element get_g2x() const override { return g2_x; }
+
+    pairing::miller_lines const* get_precomputed_g2_lines() const override { return precomputed_g2_lines; }
+    g1::affine_element get_g1_identity() const override { return points_->points()[0]; };
+
+  private:
+    g2::affine_element g2_x;
+    pairing::miller_lines* precomputed_g2_lines;
+    std::shared_ptr<MappedPoints<Curve::AffineElement>> points_;
+};
+
+class MappedGrumpkinCrs : public Crs<curve::Grumpkin> {
+    using Curve = curve::Grumpkin;
+
+  public:
+    MappedGrumpkinCrs(std::shared_ptr<MappedPoints<Curve::AffineElement>> points)
+        : points_(std::move(points))
+    {}
+
+    std::span<Curve::AffineElement> get_monomial_points() override { return points_->points(); }
+    size_t get_monomial_size() const override { return points_->points().size(); }
+    Curve::AffineElement get_g1_identity() const override { return points_->points()[0]; };
+
+  private:
+    std::shared_ptr<MappedPoints<Curve::AffineElement>> points_;
+};
+
+#endif
+
+} // namespace
+
+namespace bb::srs::factories {
+
+std::shared_ptr<Crs<curve::BN254>> init_bn254_mapped_crs(const std::filesystem::path& path,
+                                                         size_t num_points,
+                                                         bool allow_download)
+{
+#ifdef BB_MAPPED_CRS
+    auto points = map_points<g1::affine_element>(
+        path / "bn254_g1.native.dat",
+        num_points,
+        [&]() { return get_bn254_g1_data(path, num_points, allow_download); },
+        [](const g1::affine_element& first_point) { return first_point == srs::BN254_G1_FIRST_ELEMENT; });
+    if (points == nullptr) {
+        return nullptr;
+    }
+    return std::make_shared<MappedBn254Crs>(std::move(points), srs::get_bn254_g2_crs_element());
+#else
+    static_cast<void>(path);
+    static_cast<void>(num_points);
+    static_cast<void>(allow_download);
+    return nullptr;
+#endif
+}
+
+std::shared_ptr<Crs<curve::Grumpkin>> init_grumpkin_mapped_crs(const std::filesystem::path& path,
+                                                               size_t num_points,
+                                                               bool allow_download)
+{
+#ifdef BB_MAPPED_CRS
+    auto points = map_points<curve::Grumpkin::AffineElement>(
+        path / "grumpkin_g1.native.dat",
+        num_points,
+        [&]() { return get_grumpkin_g1_data(path, num_points, allow_download); },
+        [](const curve::Grumpkin::AffineElement& first_point) { return first_point.on_curve(); });
+    if (points == nullptr) {
+        return nullptr;
+    }
+    return std::make_shared<MappedGrumpkinCrs>(std::move(points));
+#else
+    static_cast<void>(path);
+    static_cast<void>(num_points);
+    static_cast<void>(allow_download);
+    return nullptr;
+#endif
+}
+
+} // namespace bb::srs::factories
@@ -0,0 +1,31 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "crs_factory.hpp"
+#include <filesystem>
+#include <memory>
+
+namespace bb::srs::factories {
+
+/**
+ * @details The downloaded/generated point files store each point in its serialized (big-endian, non-Montgomery) form,
+ * so loading them means parsing every point into a private vector. Alongside them we keep a native-layout cache:
+ *
+ *      | header (64 bytes) | AffineElement[0] | AffineElement[1] | ... |
+ *
+ * whose points are stored exactly as they are laid out in memory (Montgomery form, host endianness). The cache is
+ * written once, after the points have been validated, and is then memory-mapped, so the CRS is served straight from
+ * the page cache and shared by every process on the host that maps the same file. The header records the number of
+ * points and a digest over all of them, which is checked every time the cache is mapped.
+ *
+ * Both functions return nullptr if the mapped CRS is unavailable (e.g. on wasm, or if the cache cannot be written), in
+ * which case the caller should fall back to an in-memory CRS.
+ */
+std::shared_ptr<Crs<curve::BN254>> init_bn254_mapped_crs(const std::filesystem::path& path,
+                                                         size_t num_points,
+                                                         bool allow_download = true);
+std::shared_ptr<Crs<curve::Grumpkin>> init_grumpkin_mapped_crs(const std::filesystem::path& path,
+                                                               size_t num_points,
+                                                               bool allow_download = true);
+
+} // namespace bb::srs::factories
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
+#include "barretenberg/srs/factories/mapped_crs.hpp"
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
 #include <filesystem>
@@ -23,6 +24,9 @@ namespace bb::srs::factories {
  *      | XX XX XX XX | _/          _/
  *
  * BN254 has one 128 byte G2 point. Grumpkin has no G2 points.
+ *
+ * On native builds, these factories serve the G1 points from a memory-mapped, native-layout copy of this file (see
+ * mapped_crs.hpp) and only fall back to parsing the points into memory if that copy is unavailable.
  */
 
 MemBn254CrsFactory init_bn254_crs(const std::filesystem::path& path,
@@ -46,18 +50,19 @@ class NativeBn254CrsFactory : public CrsFactory<curve::BN254> {
 #ifndef NO_MULTITHREADING
         std::lock_guard<std::mutex> lock(mutex_);
 #endif
-        if (degree > last_degree_ || mem_crs_ == nullptr) {
-            mem_crs_ = std::make_shared<MemBn254CrsFactory>(init_bn254_crs(path_, degree, allow_download_));
-            last_degree_ = degree;
+        if (crs_ == nullptr || crs_->get_monomial_size() < degree) {
+            crs_ = init_bn254_mapped_crs(path_, degree, allow_download_);
+            if (crs_ == nullptr) {
+                crs_ = init_bn254_crs(path_, degree, allow_download_).get_crs(degree);
+            }
         }
-        return mem_crs_->get_crs(degree);
+        return crs_;
     }
 
   private:
     std::filesystem::path path_;
     bool allow_download_ = true;
-    size_t last_degree_ = 0;
-    std::shared_ptr<MemBn254CrsFactory> mem_crs_;
+    std::shared_ptr<Crs<curve::BN254>> crs_;
 #ifndef NO_MULTITHREADING
     std::mutex mutex_;
 #endif
@@ -75,18 +80,19 @@ class NativeGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
 #ifndef NO_MULTITHREADING
         std::lock_guard<std::mutex> lock(mutex_);
 #endif
-        if (degree > last_degree_ || mem_crs_ == nullptr) {
-            mem_crs_ = std::make_unique<MemGrumpkinCrsFactory>(init_grumpkin_crs(path_, degree, allow_download_));
-            last_degree_ = degree;
+        if (crs_ == nullptr || crs_->get_monomial_size() < degree) {
+            crs_ = init_grumpkin_mapped_crs(path_, degree, allow_download_);
+            if (crs_ == nullptr) {
+                crs_ = init_grumpkin_crs(path_, degree, allow_download_).get_crs(degree);
+            }
         }
-        return mem_crs_->get_crs(degree);
+        return crs_;
     }
 
   private:
     std::filesystem::path path_;
     bool allow_download_ = true;
-    size_t last_degree_ = 0;
-    std::unique_ptr<MemGrumpkinCrsFactory> mem_crs_;
+    std::shared_ptr<Crs<curve::Grumpkin>> crs_;
 #ifndef NO_MULTITHREADING
     std::mutex mutex_;
 #endif
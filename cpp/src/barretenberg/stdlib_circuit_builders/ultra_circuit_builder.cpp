@@ -12,6 +12,7 @@
 #include "ultra_circuit_builder.hpp"
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/crypto/poseidon2/poseidon2_params.hpp"
 #include "rom_ram_logic.hpp"
 
@@ -264,6 +265,70 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_big_mul_add_gate(const mul_qua
     this->increment_num_gates();
 }
 
+/**
+ * @brief Create a series of big multiplication-addition gates, exactly as calling create_big_mul_add_gate on each of
+ * them in order would.
+ *
+ * @details The gates add no variables, so each one is a row of the arithmetic block that depends on nothing but its
+ * own inputs. The block is grown once by the number of gates and the rows are then filled in parallel, instead of
+ * being appended one at a time to every wire and selector column.
+ *
+ * @param gates Structures with variable indexes and wire selector values
+ * @param include_next_gate_w_4 For each gate, whether it adds the value of the 4-th witness at the next index. Empty
+ * if none of them does
+ */
+template <typename ExecutionTrace>
+void UltraCircuitBuilder_<ExecutionTrace>::create_big_mul_add_gates(std::span<const mul_quad_<FF>> gates,
+                                                                    std::span<const uint8_t> include_next_gate_w_4)
+{
+    BB_ASSERT(include_next_gate_w_4.empty() || include_next_gate_w_4.size() == gates.size());
+    const auto includes_next_gate_w_4 = [&](size_t i) {
+        return !include_next_gate_w_4.empty() && include_next_gate_w_4[i] != 0;
+    };
+#if defined(CHECK_CIRCUIT_STACKTRACES) || defined(TRACY_HACK_GATES_AS_MEMORY)
+    // Gates are tracked as they are appended
+    for (size_t i = 0; i < gates.size(); ++i) {
+        create_big_mul_add_gate(gates[i], includes_next_gate_w_4(i));
+    }
+#else
+#ifndef NDEBUG
+    for (const auto& in : gates) {
+        this->assert_valid_variables({ in.a, in.b, in.c, in.d });
+    }
+#endif
+    auto& block = blocks.arithmetic;
+    const size_t start = block.size();
+    for (auto& wire : block.wires) {
+        wire.resize(start + gates.size());
+    }
+    for (auto& selector : block.get_selectors()) {
+        selector.resize(start + gates.size());
+    }
+    parallel_for_heuristic(
+        gates.size(),
+        [&](size_t i) {
+            const auto& in = gates[i];
+            const size_t row = start + i;
+            const bool include_w_4 = includes_next_gate_w_4(i);
+            block.w_l()[row] = in.a;
+            block.w_r()[row] = in.b;
+            block.w_o()[row] = in.c;
+            block.w_4()[row] = in.d;
+            // See create_big_mul_add_gate for the scaling of the quadratic term
+            block.q_m().set(row, include_w_4 ? in.mul_scaling * FF(2) : in.mul_scaling);
+            block.q_1().set(row, in.a_scaling);
+            block.q_2().set(row, in.b_scaling);
+            block.q_3().set(row, in.c_scaling);
+            block.q_c().set(row, in.const_scaling);
+            block.q_4().set(row, in.d_scaling);
+            block.q_arith().set(row, include_w_4 ? 2 : 1);
+        },
+        /*heuristic_cost=*/7 * thread_heuristics::FF_COPY_COST + thread_heuristics::FF_MULTIPLICATION_COST);
+    check_selector_length_consistency();
+    this->increment_num_gates(gates.size());
+#endif
+}
+
 /**
  * @brief Create a big addition gate, where in.a * in.a_scaling + in.b * in.b_scaling + in.c *
  * in.c_scaling + in.d * in.d_scaling + in.const_scaling = 0. If include_next_gate_w_4 is enabled, then the sum also
@@ -16,6 +16,7 @@
 #include "rom_ram_logic.hpp"
 #include <deque>
 #include <optional>
+#include <span>
 #include <unordered_set>
 
 #include "barretenberg/serialize/msgpack.hpp"
@@ -298,6 +299,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
 
     void create_add_gate(const add_triple_<FF>& in);
     void create_big_mul_add_gate(const mul_quad_<FF>& in, const bool use_next_gate_w_4 = false);
+    void create_big_mul_add_gates(std::span<const mul_quad_<FF>> gates, std::span<const uint8_t> use_next_gate_w_4);
     void create_big_add_gate(const add_quad_<FF>& in, const bool use_next_gate_w_4 = false);
 
     void create_bool_gate(const uint32_t a);
@@ -404,11 +404,26 @@ template <typename Flavor> class SumcheckProver {
         // on the boolean hypercube.
         GateSeparatorPolynomial<FF> gate_separators(gate_challenges, multivariate_d);
 
-        multivariate_challenge.reserve(virtual_log_n);
         // In the first round, we compute the first univariate polynomial and populate the book-keeping table of
         // #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns.
         auto round_univariate =
             round.compute_univariate(full_polynomials, relation_parameters, gate_separators, alphas);
+
+        return prove_from_first_round_univariate(round_univariate, gate_separators);
+    };
+
+    /**
+     * @brief Non-ZK version of the sumcheck rounds, given the first round univariate.
+     * @details Allows the first round univariate to be computed externally, e.g. jointly for several instances of the
+     * same circuit by SumcheckProverRound::compute_univariates_for_instances.
+     *
+     * @param round_univariate The univariate of the first round, computed from #full_polynomials
+     * @param gate_separators The gate separator polynomial for #gate_challenges, not yet partially evaluated
+     */
+    SumcheckOutput<Flavor> prove_from_first_round_univariate(SumcheckRoundUnivariate round_univariate,
+                                                             GateSeparatorPolynomial<FF>& gate_separators)
+    {
+        multivariate_challenge.reserve(virtual_log_n);
         // Initialize the partially evaluated polynomials which will be used in the following rounds.
         // This will use the information in the structured full polynomials to save memory if possible.
         partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(full_polynomials, multivariate_n);
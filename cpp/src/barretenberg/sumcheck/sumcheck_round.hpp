@@ -160,16 +160,24 @@ template <typename Flavor> class SumcheckProverRound {
                       const size_t edge_idx)
     {
         for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
-            if constexpr (Flavor::USE_SHORT_MONOMIALS) {
-                extended_edge = bb::Univariate<FF, 2>({ multivariate[edge_idx], multivariate[edge_idx + 1] });
+            extend_edge(extended_edge, multivariate, edge_idx);
+        }
+    }
+
+    /**
+     * @brief Extend the evaluations of a single multivariate at the edge (edge_idx, edge_idx + 1)
+     */
+    static void extend_edge(auto& extended_edge, const auto& multivariate, const size_t edge_idx)
+    {
+        if constexpr (Flavor::USE_SHORT_MONOMIALS) {
+            extended_edge = bb::Univariate<FF, 2>({ multivariate[edge_idx], multivariate[edge_idx + 1] });
+        } else {
+            if (multivariate.end_index() < edge_idx) {
+                static const auto zero_univariate = bb::Univariate<FF, MAX_PARTIAL_RELATION_LENGTH>::zero();
+                extended_edge = zero_univariate;
             } else {
-                if (multivariate.end_index() < edge_idx) {
-                    static const auto zero_univariate = bb::Univariate<FF, MAX_PARTIAL_RELATION_LENGTH>::zero();
-                    extended_edge = zero_univariate;
-                } else {
-                    extended_edge = bb::Univariate<FF, 2>({ multivariate[edge_idx], multivariate[edge_idx + 1] })
-                                        .template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
-                }
+                extended_edge = bb::Univariate<FF, 2>({ multivariate[edge_idx], multivariate[edge_idx + 1] })
+                                    .template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
             }
         }
     }
@@ -500,6 +508,108 @@ template <typename Flavor> class SumcheckProverRound {
         return round_univariate;
     };
 
+    /**
+     * @brief Compute the first round univariates of several instances of the same circuit in a single pass over the
+     * hypercube.
+     * @details The instances share their precomputed polynomials (selectors, sigmas, ids, tables, lagranges), so at
+     * each edge these are read and extended once and reused for every instance; only the witness and shifted
+     * polynomials are extended per instance. Each instance has its own relation parameters, gate separators and
+     * subrelation separators, and gets its own round univariate. Since the partially evaluated polynomials of
+     * different instances diverge after the first challenge, only the first round can be shared in this way.
+     *
+     * @param instance_polynomials The full prover polynomials of each instance; the precomputed polynomials of the
+     * first instance are used for all of them
+     */
+    std::vector<SumcheckRoundUnivariate> compute_univariates_for_instances(
+        const std::vector<typename Flavor::ProverPolynomials*>& instance_polynomials,
+        const std::vector<bb::RelationParameters<FF>>& relation_parameters,
+        const std::vector<bb::GateSeparatorPolynomial<FF>>& gate_separators,
+        const std::vector<SubrelationSeparators>& alphas)
+        requires(!Flavor::HasZK && !isAvmFlavor<Flavor>)
+    {
+        BB_BENCH_NAME("compute_univariates_for_instances");
+
+        const size_t num_instances = instance_polynomials.size();
+        BB_ASSERT_EQ(relation_parameters.size(), num_instances);
+        BB_ASSERT_EQ(gate_separators.size(), num_instances);
+        BB_ASSERT_EQ(alphas.size(), num_instances);
+
+        // Each instance skips the same rows as in compute_univariate: those past the end of its witnesses and, for
+        // flavors that support it, the rows skip_entire_row reports as empty. An edge is only visited, and its
+        // precomputed polynomials extended, if at least one instance uses it.
+        std::vector<size_t> effective_round_sizes(num_instances);
+        size_t max_effective_round_size = 0;
+        for (size_t instance_idx = 0; instance_idx < num_instances; ++instance_idx) {
+            effective_round_sizes[instance_idx] = compute_effective_round_size(*instance_polynomials[instance_idx]);
+            max_effective_round_size = std::max(max_effective_round_size, effective_round_sizes[instance_idx]);
+        }
+        auto is_active_edge = [&](size_t instance_idx, size_t edge_idx) {
+            if (edge_idx >= effective_round_sizes[instance_idx]) {
+                return false;
+            }
+            if constexpr (isRowSkippable<Flavor, typename Flavor::ProverPolynomials, size_t>) {
+                return !Flavor::skip_entire_row(*instance_polynomials[instance_idx], edge_idx);
+            } else {
+                return true;
+            }
+        };
+        auto& shared_polynomials = *instance_polynomials[0];
+
+        // Construct univariate accumulator containers; one per instance per thread
+        std::vector<std::vector<SumcheckTupleOfTuplesOfUnivariates>> thread_univariate_accumulators(
+            num_instances, std::vector<SumcheckTupleOfTuplesOfUnivariates>(get_num_cpus()));
+
+        parallel_for([&](ThreadChunk chunk) {
+            ExtendedEdges extended_edges;
+            std::vector<uint8_t> active_instances(num_instances);
+            for (size_t i : chunk.range(max_effective_round_size / 2)) {
+                const size_t edge_idx = i * 2;
+                bool is_used = false;
+                for (size_t instance_idx = 0; instance_idx < num_instances; ++instance_idx) {
+                    active_instances[instance_idx] = static_cast<uint8_t>(is_active_edge(instance_idx, edge_idx));
+                    is_used |= active_instances[instance_idx] != 0;
+                }
+                if (!is_used) {
+                    continue;
+                }
+                for (auto [extended_edge, multivariate] :
+                     zip_view(extended_edges.get_precomputed(), shared_polynomials.get_precomputed())) {
+                    extend_edge(extended_edge, multivariate, edge_idx);
+                }
+                for (size_t instance_idx = 0; instance_idx < num_instances; ++instance_idx) {
+                    if (active_instances[instance_idx] == 0) {
+                        continue;
+                    }
+                    auto& polynomials = *instance_polynomials[instance_idx];
+                    for (auto [extended_edge, multivariate] :
+                         zip_view(extended_edges.get_witness(), polynomials.get_witness())) {
+                        extend_edge(extended_edge, multivariate, edge_idx);
+                    }
+                    for (auto [extended_edge, multivariate] :
+                         zip_view(extended_edges.get_shifted(), polynomials.get_shifted())) {
+                        extend_edge(extended_edge, multivariate, edge_idx);
+                    }
+                    accumulate_relation_univariates(thread_univariate_accumulators[instance_idx][chunk.thread_index],
+                                                    extended_edges,
+                                                    relation_parameters[instance_idx],
+                                                    gate_separators[instance_idx][edge_idx]);
+                }
+            }
+        });
+
+        std::vector<SumcheckRoundUnivariate> round_univariates;
+        round_univariates.reserve(num_instances);
+        for (size_t instance_idx = 0; instance_idx < num_instances; ++instance_idx) {
+            SumcheckTupleOfTuplesOfUnivariates instance_accumulators{};
+            for (auto& accumulators : thread_univariate_accumulators[instance_idx]) {
+                Utils::add_nested_tuples(instance_accumulators, accumulators);
+            }
+            round_univariates.emplace_back(batch_over_relations<SumcheckRoundUnivariate>(
+                instance_accumulators, alphas[instance_idx], gate_separators[instance_idx]));
+        }
+        return round_univariates;
+    }
+
     /*!
      * @brief For ZK Flavors: A method disabling the last 4 rows of the ProverPolynomials
      *
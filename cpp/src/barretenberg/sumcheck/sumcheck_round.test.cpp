@@ -1057,3 +1057,67 @@ TEST(SumcheckRound, CheckSumRecursiveUnsatisfiableWitness)
         info("Multiple rounds: Builder correctly detects failure in one of multiple rounds");
     }
 }
+
+/**
+ * @brief The first round univariates computed for several instances at once must match the ones computed for each
+ * instance on its own, including for an instance whose witnesses end well before the others
+ */
+TEST(SumcheckRound, ComputeUnivariatesForInstancesMatchesSingleInstance)
+{
+    using Flavor = SumcheckTestFlavor;
+    using FF = typename Flavor::FF;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+    using SumcheckRound = SumcheckProverRound<Flavor>;
+
+    const size_t log_n = 6;
+    const size_t n = 1 << log_n;
+    const std::array<size_t, 3> witness_sizes = { n - 1, 20, 7 };
+
+    ProverPolynomials shared_polynomials(n);
+    for (auto& poly : shared_polynomials.get_precomputed()) {
+        poly = bb::Polynomial<FF>::random(n);
+    }
+
+    std::vector<ProverPolynomials> instances;
+    std::vector<RelationParameters<FF>> relation_parameters;
+    std::vector<GateSeparatorPolynomial<FF>> gate_separators;
+    std::vector<typename SumcheckRound::SubrelationSeparators> alphas;
+    for (size_t witness_size : witness_sizes) {
+        ProverPolynomials polynomials;
+        for (auto [poly, shared_poly] : zip_view(polynomials.get_precomputed(), shared_polynomials.get_precomputed())) {
+            poly = shared_poly.share();
+        }
+        for (auto& poly : polynomials.get_witness()) {
+            poly = bb::Polynomial<FF>::random(witness_size, n, /*start_index=*/1);
+        }
+        polynomials.set_shifted();
+        instances.push_back(std::move(polynomials));
+
+        relation_parameters.push_back(RelationParameters<FF>::get_random());
+        std::vector<FF> betas(log_n);
+        for (auto& beta : betas) {
+            beta = FF::random_element();
+        }
+        gate_separators.emplace_back(betas, log_n);
+        typename SumcheckRound::SubrelationSeparators instance_alphas;
+        for (auto& alpha : instance_alphas) {
+            alpha = FF::random_element();
+        }
+        alphas.push_back(instance_alphas);
+    }
+
+    std::vector<ProverPolynomials*> instance_polynomials;
+    for (auto& polynomials : instances) {
+        instance_polynomials.push_back(&polynomials);
+    }
+    SumcheckRound batched_round(n);
+    auto batched_univariates = batched_round.compute_univariates_for_instances(
+        instance_polynomials, relation_parameters, gate_separators, alphas);
+
+    ASSERT_EQ(batched_univariates.size(), instances.size());
+    for (size_t i = 0; i < instances.size(); ++i) {
+        SumcheckRound round(n);
+        auto univariate = round.compute_univariate(instances[i], relation_parameters[i], gate_separators[i], alphas[i]);
+        EXPECT_EQ(batched_univariates[i], univariate) << "instance " << i;
+    }
+}
@@ -37,6 +37,28 @@ void TraceToPolynomials<Flavor>::populate(Builder& builder, typename Flavor::Pro
     }
 }
 
+template <class Flavor>
+void TraceToPolynomials<Flavor>::populate_wires(Builder& builder, typename Flavor::ProverPolynomials& polynomials)
+{
+    BB_BENCH_NAME("trace populate wires");
+
+    RefArray<Polynomial, NUM_WIRES> wires = polynomials.get_wires();
+    for (auto& block : builder.blocks.get()) {
+        const size_t offset = block.trace_offset();
+        for (size_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+            const auto& block_wire = block.wires[wire_idx];
+            auto& wire = wires[wire_idx];
+            for (size_t block_row_idx = 0; block_row_idx < block.size(); ++block_row_idx) {
+                wire.at(block_row_idx + offset) = builder.get_variable(block_wire[block_row_idx]);
+            }
+        }
+    }
+
+    if constexpr (IsMegaFlavor<Flavor>) {
+        copy_ecc_op_wires(builder, polynomials);
+    }
+}
+
 template <class Flavor>
 std::vector<CyclicPermutation> TraceToPolynomials<Flavor>::populate_wires_and_selectors_and_compute_copy_cycles(
     Builder& builder, ProverPolynomials& polynomials)
@@ -92,7 +114,19 @@ template <class Flavor>
 void TraceToPolynomials<Flavor>::add_ecc_op_wires_to_prover_instance(Builder& builder, ProverPolynomials& polynomials)
     requires IsMegaFlavor<Flavor>
 {
+    copy_ecc_op_wires(builder, polynomials);
+
+    // Construct the selector as the indicator on the ecc op block
     auto& ecc_op_selector = polynomials.lagrange_ecc_op;
+    for (size_t i = 0; i < builder.blocks.ecc_op.size(); ++i) {
+        ecc_op_selector.at(i) = 1;
+    }
+}
+
+template <class Flavor>
+void TraceToPolynomials<Flavor>::copy_ecc_op_wires(Builder& builder, ProverPolynomials& polynomials)
+    requires IsMegaFlavor<Flavor>
+{
     const size_t wire_idx_offset = Flavor::has_zero_row ? 1 : 0;
 
     // Copy the ecc op data from the conventional wires into the op wires over the range of ecc op gates. The data is
@@ -101,7 +135,6 @@ void TraceToPolynomials<Flavor>::add_ecc_op_wires_to_prover_instance(Builder& bu
     for (auto [ecc_op_wire, wire] : zip_view(polynomials.get_ecc_op_wires(), polynomials.get_wires())) {
         for (size_t i = 0; i < num_ecc_ops; ++i) {
             ecc_op_wire.at(i) = wire[i + wire_idx_offset];
-            ecc_op_selector.at(i) = 1; // construct selector as the indicator on the ecc op block
         }
     }
 }
@@ -35,6 +35,13 @@ template <class Flavor> class TraceToPolynomials {
      */
     static void populate(Builder& builder, ProverPolynomials&);
 
+    /**
+     * @brief Populate only the wire polynomials (and the ecc op wires, if any)
+     * @details Used when the precomputed polynomials (selectors, sigmas/ids, lagrange_ecc_op) are already available,
+     * e.g. from a PrecomputedPolynomialCache, so copy cycles need not be computed.
+     */
+    static void populate_wires(Builder& builder, ProverPolynomials&);
+
   private:
     /**
      * @brief Populate wire polynomials, selector polynomials and copy cycles from raw circuit data
@@ -50,6 +57,9 @@ template <class Flavor> class TraceToPolynomials {
      */
     static void add_ecc_op_wires_to_prover_instance(Builder& builder, ProverPolynomials&)
         requires IsMegaFlavor<Flavor>;
+
+    static void copy_ecc_op_wires(Builder& builder, ProverPolynomials&)
+        requires IsMegaFlavor<Flavor>;
 };
 
 } // namespace bb
@@ -6,6 +6,8 @@
 
 #include "translator_proving_key.hpp"
 #include "barretenberg/common/assert.hpp"
+
+#include <algorithm>
 namespace bb {
 /**
  * @brief Construct a set of polynomials that are the result of interleaving a group of polynomials into one. Used in
@@ -39,23 +41,100 @@ void TranslatorProvingKey::compute_interleaved_polynomials()
     const size_t MINI_CIRCUIT_SIZE = targets[0].size() / num_polys_in_group;
     BB_ASSERT_EQ(MINI_CIRCUIT_SIZE * num_polys_in_group, targets[0].size());
 
-    auto ordering_function = [&](size_t index) {
-        // Get the index of the interleaved polynomial
-        size_t i = index / interleaved[0].size();
-        // Get the index of the original polynomial
-        size_t j = index % interleaved[0].size();
-        auto& group = interleaved[i];
-        auto& current_target = targets[i];
-
-        // Copy into appropriate position in the interleaved polynomial
-        // We offset by start_index() as the first 0 is not physically represented for shiftable values
-        for (size_t k = group[j].start_index(); k < group[j].end_index(); k++) {
-            current_target.at(k * num_polys_in_group + j) = group[j][k];
+    // Partition the rows of the mini circuit across all threads. Each thread then writes a contiguous tile of every
+    // interleaved target (rows [start, end) of each group occupy [start * group_size, end * group_size)) while
+    // streaming through the same rows of the group polynomials, instead of each thread writing one strided column.
+    auto ordering_function = [&](size_t start, size_t end) {
+        for (size_t i = 0; i < interleaved.size(); i++) {
+            auto& group = interleaved[i];
+            auto& current_target = targets[i];
+            for (size_t j = 0; j < num_polys_in_group; j++) {
+                // We offset by start_index() as the first 0 is not physically represented for shiftable values
+                const size_t k_start = std::max(start, group[j].start_index());
+                const size_t k_end = std::min(end, group[j].end_index());
+                for (size_t k = k_start; k < k_end; k++) {
+                    current_target.at(k * num_polys_in_group + j) = group[j][k];
+                }
+            }
         }
     };
-    parallel_for(interleaved.size() * num_polys_in_group, ordering_function);
+    parallel_for_range(MINI_CIRCUIT_SIZE, ordering_function);
 }
 
+namespace {
+
+/**
+ * @brief Write the values of `unsorted_values`, which are expected to be range constrained to [0, max_value], into
+ * `target` in non-descending order.
+ *
+ * @details Since the values are 14-bit microlimbs, we use a counting sort, parallelised across all threads: each chunk
+ * of the input builds a histogram, the histograms are merged, and the output is written by threads owning contiguous
+ * ranges of rows. Values outside of the range can only come from a malformed circuit; for those we fall back to a
+ * comparison sort so the result is the same as before.
+ */
+void write_sorted_range_constraint_values(const std::vector<uint32_t>& unsorted_values,
+                                          const size_t max_value,
+                                          TranslatorProvingKey::Polynomial& target)
+{
+    const size_t num_values = unsorted_values.size();
+    const size_t histogram_size = max_value + 1;
+
+    // Each chunk should be substantially larger than its histogram for the counting pass to pay off
+    const size_t num_chunks = calculate_num_threads(num_values, /*min_iterations_per_thread=*/histogram_size);
+    const size_t chunk_size = (num_values + num_chunks - 1) / num_chunks;
+    std::vector<std::vector<uint32_t>> chunk_histograms(num_chunks);
+    std::vector<uint8_t> chunk_in_range(num_chunks, 1);
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        auto& histogram = chunk_histograms[chunk_idx];
+        histogram.resize(histogram_size, 0);
+        const size_t end = std::min(num_values, (chunk_idx + 1) * chunk_size);
+        for (size_t i = chunk_idx * chunk_size; i < end; i++) {
+            if (unsorted_values[i] > max_value) {
+                chunk_in_range[chunk_idx] = 0;
+                return;
+            }
+            histogram[unsorted_values[i]]++;
+        }
+    });
+
+    if (std::ranges::any_of(chunk_in_range, [](uint8_t in_range) { return in_range == 0; })) {
+        std::vector<uint32_t> sorted_values = unsorted_values;
+        std::sort(sorted_values.begin(), sorted_values.end());
+        target.copy_vector(sorted_values);
+        return;
+    }
+
+    // offsets[v] is the first row holding the value v in the sorted output
+    std::vector<size_t> offsets(histogram_size + 1, 0);
+    for (size_t value = 0; value < histogram_size; value++) {
+        size_t count = 0;
+        for (const auto& histogram : chunk_histograms) {
+            count += histogram[value];
+        }
+        offsets[value + 1] = offsets[value] + count;
+    }
+
+    // Fill the target row-wise. The first start_index() rows are not physically represented (and hold zeros, the
+    // minimum of every range constraint sequence).
+    parallel_for_range(num_values, [&](size_t start, size_t end) {
+        start = std::max(start, target.start_index());
+        if (start >= end) {
+            return;
+        }
+        // Find the value occupying row `start`
+        auto value_it = std::upper_bound(offsets.begin(), offsets.end(), start);
+        size_t value = static_cast<size_t>(std::distance(offsets.begin(), value_it)) - 1;
+        for (size_t row = start; row < end; row++) {
+            while (offsets[value + 1] <= row) {
+                value++;
+            }
+            target.at(row) = value;
+        }
+    });
+}
+
+} // namespace
+
 /**
  * @brief Compute denominator polynomials for Translator's range constraint permutation
  *
@@ -87,80 +166,81 @@ void TranslatorProvingKey::compute_translator_range_constraint_ordered_polynomia
                                              proving_key->polynomials.ordered_range_constraints_1,
                                              proving_key->polynomials.ordered_range_constraints_2,
                                              proving_key->polynomials.ordered_range_constraints_3 };
-    std::vector<size_t> extra_denominator_uint(dyadic_circuit_size_without_masking);
+    std::vector<uint32_t> extra_denominator_uint(dyadic_circuit_size_without_masking);
 
     const auto sorted_elements = get_sorted_steps();
     auto to_be_interleaved_groups = proving_key->polynomials.get_groups_to_be_interleaved();
 
-    // Given the polynomials in group_i, transfer their elements, sorted in non-descending order, into the corresponding
-    // ordered_range_constraint_i up to the given capacity and the remaining elements to the last range constraint.
-    // Sorting is done by converting the elements to uint for efficiency.
-    auto ordering_function = [&](size_t i) {
-        auto group = to_be_interleaved_groups[i];
-        std::vector<uint32_t> ordered_vectors_uint(dyadic_circuit_size_without_masking);
-
-        // Calculate how much space there is for values from the group polynomials given we also need to append the
-        // additional steps
-        auto free_space_before_runway = dyadic_circuit_size_without_masking - sorted_elements.size();
-
-        // Calculate the starting index of this group's overflowing elements in the extra denominator polynomial
+    // Calculate how much space there is for values from the group polynomials given we also need to append the
+    // additional steps
+    const size_t free_space_before_runway = dyadic_circuit_size_without_masking - sorted_elements.size();
+    const size_t max_value = (1 << Flavor::MICRO_LIMB_BITS) - 1;
+
+    // Given the polynomials in group_i, transfer their elements into the corresponding ordered_range_constraint_i up
+    // to the given capacity and the remaining elements to the last range constraint. Elements are converted to uint
+    // for efficient sorting. Each group polynomial contributes a contiguous range of rows to the ordered vector and a
+    // contiguous (possibly empty) range of overflowing elements to the extra denominator, so every (group, polynomial)
+    // pair can be transferred independently once the overflow offsets are known.
+    std::vector<std::vector<uint32_t>> ordered_vectors_uint(num_interleaved_wires);
+    std::vector<size_t> extra_denominator_offsets(num_interleaved_wires * Flavor::INTERLEAVING_GROUP_SIZE);
+    for (size_t i = 0; i < num_interleaved_wires; i++) {
+        ordered_vectors_uint[i].resize(dyadic_circuit_size_without_masking);
+        // The overflowing elements of group i start at this index in the extra denominator polynomial
         size_t extra_denominator_offset = i * sorted_elements.size();
-
-        // Go through each polynomial in the interleaved group
         for (size_t j = 0; j < Flavor::INTERLEAVING_GROUP_SIZE; j++) {
+            const auto& poly = to_be_interleaved_groups[i][j];
+            const size_t current_offset = j * dyadic_mini_circuit_size_without_masking;
+            const size_t k_start = poly.start_index();
+            const size_t k_end = poly.end_index() - NUM_DISABLED_ROWS_IN_SUMCHECK;
+            // Rows k with current_offset + k >= free_space_before_runway overflow into the extra denominator
+            const size_t overflow_threshold =
+                free_space_before_runway - std::min(free_space_before_runway, current_offset);
+            const size_t k_overflow = std::clamp(overflow_threshold, k_start, k_end);
+            extra_denominator_offsets[i * Flavor::INTERLEAVING_GROUP_SIZE + j] = extra_denominator_offset;
+            extra_denominator_offset += k_end - k_overflow;
+        }
+    }
 
-            // Calculate the offset in the target vector
-            auto current_offset = j * dyadic_mini_circuit_size_without_masking;
-            ;
-            // For each element in the polynomial
-            for (size_t k = group[j].start_index(); k < group[j].end_index() - NUM_DISABLED_ROWS_IN_SUMCHECK; k++) {
-
-                // Put it it the target polynomial
-                if ((current_offset + k) < free_space_before_runway) {
-                    ordered_vectors_uint[current_offset + k] = static_cast<uint32_t>(uint256_t(group[j][k]).data[0]);
-
-                    // Or in the extra one if there is no space left
-                } else {
-                    extra_denominator_uint[extra_denominator_offset] =
-                        static_cast<uint32_t>(uint256_t(group[j][k]).data[0]);
-                    extra_denominator_offset++;
-                }
+    parallel_for(num_interleaved_wires * Flavor::INTERLEAVING_GROUP_SIZE, [&](size_t index) {
+        const size_t i = index / Flavor::INTERLEAVING_GROUP_SIZE;
+        const size_t j = index % Flavor::INTERLEAVING_GROUP_SIZE;
+        const auto& poly = to_be_interleaved_groups[i][j];
+        auto& ordered_vector_uint = ordered_vectors_uint[i];
+
+        // Calculate the offset in the target vector
+        const size_t current_offset = j * dyadic_mini_circuit_size_without_masking;
+        size_t extra_denominator_offset = extra_denominator_offsets[index];
+        for (size_t k = poly.start_index(); k < poly.end_index() - NUM_DISABLED_ROWS_IN_SUMCHECK; k++) {
+            // Put it it the target polynomial
+            if ((current_offset + k) < free_space_before_runway) {
+                ordered_vector_uint[current_offset + k] = static_cast<uint32_t>(uint256_t(poly[k]).data[0]);
+
+                // Or in the extra one if there is no space left
+            } else {
+                extra_denominator_uint[extra_denominator_offset] = static_cast<uint32_t>(uint256_t(poly[k]).data[0]);
+                extra_denominator_offset++;
             }
         }
-        // Advance the iterator past the last written element in the range constraint polynomial and complete it with
-        // sorted steps
-        auto ordered_vector_it = ordered_vectors_uint.begin();
-        std::advance(ordered_vector_it, free_space_before_runway);
-        std::copy(sorted_elements.cbegin(), sorted_elements.cend(), ordered_vector_it);
-
-        // Sort the polynomial in nondescending order. We sort using the size_t vector for 2 reasons:
-        // 1. It is faster to sort size_t
-        // 2. Comparison operators for finite fields are operating on internal form, so we'd have to convert them
-        // from Montgomery
-        std::sort(ordered_vectors_uint.begin(), ordered_vectors_uint.end());
-        BB_ASSERT_EQ(ordered_vectors_uint.size(), dyadic_circuit_size_without_masking);
-        // Copy the values into the actual polynomial
-        ordered_constraint_polynomials[i].copy_vector(ordered_vectors_uint);
-    };
+    });
 
-    // Construct the first 4 polynomials
-    parallel_for(num_interleaved_wires, ordering_function);
+    // Complete the ordered vectors with the sorted steps and sort them in nondescending order. We sort as integers
+    // since comparison operators for finite fields operate on the internal (Montgomery) form. Each sort is itself
+    // parallelised across all threads.
+    for (size_t i = 0; i < num_interleaved_wires; i++) {
+        std::copy(sorted_elements.cbegin(),
+                  sorted_elements.cend(),
+                  ordered_vectors_uint[i].begin() + static_cast<std::ptrdiff_t>(free_space_before_runway));
+        write_sorted_range_constraint_values(ordered_vectors_uint[i], max_value, ordered_constraint_polynomials[i]);
+    }
 
     // Advance the iterator into the extra range constraint past the last written element
     auto extra_denominator_it = extra_denominator_uint.begin();
     std::advance(extra_denominator_it, num_interleaved_wires * sorted_elements.size());
 
-    // Add steps to the extra denominator polynomial to fill it
+    // Add steps to the extra denominator polynomial to fill it, then sort it into the last ordered polynomial
     std::copy(sorted_elements.cbegin(), sorted_elements.cend(), extra_denominator_it);
-    // Sort it
-#ifdef NO_PAR_ALGOS
-    std::sort(extra_denominator_uint.begin(), extra_denominator_uint.end());
-#else
-    std::sort(std::execution::par_unseq, extra_denominator_uint.begin(), extra_denominator_uint.end());
-#endif
-
-    // Copy the values into the actual polynomial
-    proving_key->polynomials.ordered_range_constraints_4.copy_vector(extra_denominator_uint);
+    write_sorted_range_constraint_values(
+        extra_denominator_uint, max_value, proving_key->polynomials.ordered_range_constraints_4);
 
     // Transfer randomness from interleaved to ordered polynomials such that the commitments and evaluations of all
     // ordered polynomials and their shifts are hidden
@@ -350,14 +430,16 @@ void TranslatorProvingKey::compute_extra_range_constraint_numerator()
 {
 
     const auto sorted_elements = get_sorted_steps();
-    // TODO(#756): can be parallelized further. This will use at most 5 threads
-    auto fill_with_shift = [&](size_t shift) {
-        for (size_t i = 0; i < sorted_elements.size(); i++) {
-            proving_key->polynomials.ordered_extra_range_constraints_numerator.at(
-                shift + i * (Flavor::NUM_INTERLEAVED_WIRES + 1)) = sorted_elements[i];
+    constexpr size_t num_repetitions = Flavor::NUM_INTERLEAVED_WIRES + 1;
+    auto& numerator = proving_key->polynomials.ordered_extra_range_constraints_numerator;
+    // Fill polynomials with a sequence, where each element is repeated NUM_INTERLEAVED_WIRES+1 times. The steps are
+    // partitioned across all threads so that each one writes a contiguous range of the polynomial.
+    parallel_for_range(sorted_elements.size(), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            for (size_t shift = 0; shift < num_repetitions; shift++) {
+                numerator.at(shift + i * num_repetitions) = sorted_elements[i];
+            }
         }
-    };
-    // Fill polynomials with a sequence, where each element is repeated NUM_INTERLEAVED_WIRES+1 times
-    parallel_for(Flavor::NUM_INTERLEAVED_WIRES + 1, fill_with_shift);
+    });
 }
 } // namespace bb
@@ -0,0 +1,190 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "batched_ultra_prover.hpp"
+#include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/sumcheck/sumcheck.hpp"
+
+namespace bb {
+
+template <IsUltraOrMegaHonk Flavor>
+BatchedUltraProver_<Flavor>::BatchedUltraProver_(const std::vector<std::shared_ptr<ProverInstance>>& prover_instances,
+                                                 const std::shared_ptr<HonkVK>& honk_vk)
+    : honk_vk(honk_vk)
+{
+    BB_ASSERT(!prover_instances.empty(), "BatchedUltraProver requires at least one prover instance");
+    const auto& first_instance = prover_instances.front();
+    commitment_key = CommitmentKey(first_instance->dyadic_size());
+
+    provers.reserve(prover_instances.size());
+    for (const auto& prover_instance : prover_instances) {
+        // The first sumcheck round reads the precomputed polynomials of the first instance on behalf of all of them
+        BB_ASSERT_EQ(prover_instance->dyadic_size(), first_instance->dyadic_size());
+        BB_ASSERT_EQ(prover_instance->get_final_active_wire_idx(), first_instance->get_final_active_wire_idx());
+        BB_ASSERT_EQ(prover_instance->pub_inputs_offset(), first_instance->pub_inputs_offset());
+
+        prover_instance->commitment_key = commitment_key;
+        provers.emplace_back(std::make_unique<Prover>(prover_instance, honk_vk));
+    }
+}
+
+/**
+ * @brief Run the Oink rounds of all instances in lock-step, committing to the witnesses of every instance in each round
+ * with a single batched MSM.
+ */
+template <IsUltraOrMegaHonk Flavor> void BatchedUltraProver_<Flavor>::execute_oink_rounds()
+{
+    BB_BENCH_NAME("BatchedUltraProver::execute_oink_rounds");
+
+    std::vector<OinkProver> oink_provers;
+    oink_provers.reserve(provers.size());
+    for (auto& prover : provers) {
+        oink_provers.emplace_back(prover->prover_instance, honk_vk, prover->transcript);
+    }
+
+    for (auto& oink_prover : oink_provers) {
+        oink_prover.execute_preamble_round();
+        oink_prover.commit_to_masking_poly();
+    }
+    execute_batched_commitment_round(
+        oink_provers,
+        [](OinkProver& oink_prover) { return oink_prover.start_wire_commitments_round(); },
+        [](OinkProver& oink_prover, auto commitments) { oink_prover.finish_wire_commitments_round(commitments); });
+    execute_batched_commitment_round(
+        oink_provers,
+        [](OinkProver& oink_prover) { return oink_prover.start_sorted_list_accumulator_round(); },
+        [](OinkProver& oink_prover, auto commitments) {
+            oink_prover.finish_sorted_list_accumulator_round(commitments);
+        });
+    execute_batched_commitment_round(
+        oink_provers,
+        [](OinkProver& oink_prover) { return oink_prover.start_log_derivative_inverse_round(); },
+        [](OinkProver& oink_prover, auto commitments) {
+            oink_prover.finish_log_derivative_inverse_round(commitments);
+        });
+    execute_batched_commitment_round(
+        oink_provers,
+        [](OinkProver& oink_prover) { return oink_prover.start_grand_product_computation_round(); },
+        [](OinkProver& oink_prover, auto commitments) {
+            oink_prover.finish_grand_product_computation_round(commitments);
+        });
+
+    for (auto& oink_prover : oink_provers) {
+        oink_prover.prover_instance->alpha = oink_prover.generate_alpha_round();
+        oink_prover.prover_instance->is_complete = true;
+    }
+}
+
+template <IsUltraOrMegaHonk Flavor>
+template <typename StartRound, typename FinishRound>
+void BatchedUltraProver_<Flavor>::execute_batched_commitment_round(std::vector<OinkProver>& oink_provers,
+                                                                   StartRound start_round,
+                                                                   FinishRound finish_round)
+{
+    using CommitBatch = typename CommitmentKey::CommitBatch;
+
+    std::vector<CommitBatch> batches;
+    batches.reserve(oink_provers.size());
+    RefVector<Polynomial> polynomials;
+    for (auto& oink_prover : oink_provers) {
+        batches.emplace_back(start_round(oink_prover));
+        for (auto& polynomial : batches.back().wires) {
+            polynomials.push_back(polynomial);
+        }
+    }
+
+    const std::vector<Commitment> commitments = commitment_key.batch_commit(polynomials);
+
+    std::span<const Commitment> remaining_commitments(commitments);
+    for (auto [oink_prover, batch] : zip_view(oink_provers, batches)) {
+        auto round_commitments = remaining_commitments.subspan(0, batch.wires.size());
+        remaining_commitments = remaining_commitments.subspan(batch.wires.size());
+        batch.send_to_verifier(oink_prover.transcript, round_commitments);
+        finish_round(oink_prover, round_commitments);
+    }
+}
+
+/**
+ * @brief Run sumcheck for every instance, computing the first round univariates of all instances together.
+ */
+template <IsUltraOrMegaHonk Flavor> void BatchedUltraProver_<Flavor>::execute_sumcheck_iop()
+{
+    if constexpr (Flavor::HasZK) {
+        // The ZK sumcheck masks each instance's round univariates independently; prove the instances one at a time
+        for (auto& prover : provers) {
+            prover->execute_sumcheck_iop();
+        }
+    } else {
+        BB_BENCH_NAME("BatchedUltraProver::execute_sumcheck_iop");
+        using Sumcheck = SumcheckProver<Flavor>;
+
+        const auto& first_instance = provers.front()->prover_instance;
+        const size_t polynomial_size = first_instance->dyadic_size();
+        const size_t virtual_log_n = Flavor::USE_PADDING ? Flavor::VIRTUAL_LOG_N : first_instance->log_dyadic_size();
+
+        std::vector<Sumcheck> sumchecks;
+        std::vector<typename Flavor::ProverPolynomials*> instance_polynomials;
+        std::vector<RelationParameters<FF>> relation_parameters;
+        std::vector<GateSeparatorPolynomial<FF>> gate_separators;
+        std::vector<typename Sumcheck::SubrelationSeparators> alphas;
+        sumchecks.reserve(provers.size());
+        gate_separators.reserve(provers.size());
+        for (auto& prover : provers) {
+            auto& prover_instance = prover->prover_instance;
+            auto& sumcheck = sumchecks.emplace_back(polynomial_size,
+                                                    prover_instance->polynomials,
+                                                    prover->transcript,
+                                                    prover_instance->alpha,
+                                                    prover_instance->gate_challenges,
+                                                    prover_instance->relation_parameters,
+                                                    virtual_log_n);
+            instance_polynomials.push_back(&prover_instance->polynomials);
+            relation_parameters.push_back(prover_instance->relation_parameters);
+            gate_separators.emplace_back(prover_instance->gate_challenges, sumcheck.multivariate_d);
+            alphas.push_back(sumcheck.alphas);
+        }
+
+        auto first_round_univariates = sumchecks.front().round.compute_univariates_for_instances(
+            instance_polynomials, relation_parameters, gate_separators, alphas);
+
+        for (size_t i = 0; i < provers.size(); ++i) {
+            provers[i]->sumcheck_output =
+                sumchecks[i].prove_from_first_round_univariate(first_round_univariates[i], gate_separators[i]);
+        }
+    }
+}
+
+template <IsUltraOrMegaHonk Flavor>
+std::vector<typename BatchedUltraProver_<Flavor>::Proof> BatchedUltraProver_<Flavor>::construct_proofs()
+{
+    execute_oink_rounds();
+    vinfo("created batched oink proofs");
+
+    for (auto& prover : provers) {
+        prover->generate_gate_challenges();
+    }
+
+    execute_sumcheck_iop();
+    vinfo("finished batched relation check rounds");
+
+    std::vector<Proof> proofs;
+    proofs.reserve(provers.size());
+    for (auto& prover : provers) {
+        prover->execute_pcs();
+        proofs.emplace_back(prover->export_proof());
+    }
+    vinfo("finished batched PCS rounds");
+
+    return proofs;
+}
+
+template class BatchedUltraProver_<UltraFlavor>;
+template class BatchedUltraProver_<UltraZKFlavor>;
+template class BatchedUltraProver_<UltraKeccakFlavor>;
+template class BatchedUltraProver_<UltraRollupFlavor>;
+template class BatchedUltraProver_<MegaFlavor>;
+
+} // namespace bb
@@ -0,0 +1,66 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/ultra_honk/oink_prover.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+
+namespace bb {
+
+/**
+ * @brief Prover for several instances of the same circuit, producing an independent proof for each.
+ * @details The instances are proven in lock-step so that work touching the shared circuit description is done once:
+ * - In each Oink round, the witness commitments of all instances are computed by a single batched MSM.
+ * - The first sumcheck round, which dominates sumcheck and is the only round reading the full precomputed polynomials,
+ *   is computed for all instances in a single pass over the hypercube so that each selector/sigma/table edge is read
+ *   once (non-ZK flavors only; ZK flavors run a standard sumcheck per instance).
+ * Each instance keeps its own transcript, so every proof is exactly what UltraProver_ would produce for that instance
+ * and is verified on its own.
+ */
+template <IsUltraOrMegaHonk Flavor_> class BatchedUltraProver_ {
+  public:
+    using Flavor = Flavor_;
+    using FF = typename Flavor::FF;
+    using Commitment = typename Flavor::Commitment;
+    using CommitmentKey = typename Flavor::CommitmentKey;
+    using Polynomial = typename Flavor::Polynomial;
+    using ProverInstance = ProverInstance_<Flavor>;
+    using HonkVK = typename Flavor::VerificationKey;
+    using Prover = UltraProver_<Flavor>;
+    using Proof = typename Prover::Proof;
+
+    std::vector<std::unique_ptr<Prover>> provers;
+    std::shared_ptr<HonkVK> honk_vk;
+
+    /**
+     * @param prover_instances Instances of a single circuit, i.e. with identical precomputed polynomials
+     * @param honk_vk The verification key of that circuit
+     */
+    BatchedUltraProver_(const std::vector<std::shared_ptr<ProverInstance>>& prover_instances,
+                        const std::shared_ptr<HonkVK>& honk_vk);
+
+    BB_PROFILE void execute_oink_rounds();
+    BB_PROFILE void execute_sumcheck_iop();
+
+    std::vector<Proof> construct_proofs();
+    std::vector<Proof> prove() { return construct_proofs(); };
+
+  private:
+    using OinkProver = bb::OinkProver<Flavor>;
+
+    CommitmentKey commitment_key;
+
+    template <typename StartRound, typename FinishRound>
+    void execute_batched_commitment_round(std::vector<OinkProver>& oink_provers,
+                                          StartRound start_round,
+                                          FinishRound finish_round);
+};
+
+using BatchedUltraProver = BatchedUltraProver_<UltraFlavor>;
+using BatchedUltraZKProver = BatchedUltraProver_<UltraZKFlavor>;
+using BatchedMegaProver = BatchedUltraProver_<MegaFlavor>;
+
+} // namespace bb
@@ -0,0 +1,135 @@
+#include "barretenberg/ultra_honk/batched_ultra_prover.hpp"
+#include "barretenberg/special_public_inputs/special_public_inputs.hpp"
+#include "barretenberg/stdlib/special_public_inputs/special_public_inputs.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+template <typename Flavor> class BatchedUltraProverTests : public ::testing::Test {
+  public:
+    using Builder = typename Flavor::CircuitBuilder;
+    using ProverInstance = ProverInstance_<Flavor>;
+    using VerificationKey = typename Flavor::VerificationKey;
+    using Prover = UltraProver_<Flavor>;
+    using BatchedProver = BatchedUltraProver_<Flavor>;
+    using Verifier = UltraVerifier_<Flavor>;
+
+    static void SetUpTestSuite() { bb::srs::init_file_crs_factory(bb::srs::bb_crs_path()); }
+
+    /**
+     * @brief Construct a circuit whose structure is fixed but whose witness values are fresh on every call
+     */
+    static Builder construct_circuit(bool valid = true)
+    {
+        Builder builder;
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 4);
+        MockCircuits::add_arithmetic_gates(builder, 1 << 9);
+        MockCircuits::add_lookup_gates(builder, 1);
+        // A final gate which is only satisfied if `valid`; the circuit structure is the same either way
+        fr a = fr::random_element();
+        fr b = fr::random_element();
+        fr c = fr::random_element();
+        fr d = valid ? a + b + c : a + b + c + 1;
+        builder.create_big_add_gate({ builder.add_variable(a),
+                                      builder.add_variable(b),
+                                      builder.add_variable(c),
+                                      builder.add_variable(d),
+                                      fr(1),
+                                      fr(1),
+                                      fr(1),
+                                      fr(-1),
+                                      fr(0) });
+        stdlib::recursion::honk::DefaultIO<Builder>::add_default(builder);
+        return builder;
+    }
+
+    static bool verify(const std::shared_ptr<VerificationKey>& verification_key, const HonkProof& proof)
+    {
+        Verifier verifier(verification_key);
+        return verifier.template verify_proof<DefaultIO>(proof).result;
+    }
+};
+
+using FlavorTypes = ::testing::Types<UltraFlavor, UltraZKFlavor>;
+TYPED_TEST_SUITE(BatchedUltraProverTests, FlavorTypes);
+
+/**
+ * @brief Each proof produced by the batched prover verifies independently
+ */
+TYPED_TEST(BatchedUltraProverTests, ProofsVerify)
+{
+    using ProverInstance = typename TestFixture::ProverInstance;
+    using VerificationKey = typename TestFixture::VerificationKey;
+
+    constexpr size_t NUM_INSTANCES = 3;
+    std::vector<std::shared_ptr<ProverInstance>> prover_instances;
+    for (size_t i = 0; i < NUM_INSTANCES; ++i) {
+        auto circuit = TestFixture::construct_circuit();
+        prover_instances.emplace_back(std::make_shared<ProverInstance>(circuit));
+    }
+    auto verification_key = std::make_shared<VerificationKey>(prover_instances[0]->get_precomputed());
+
+    typename TestFixture::BatchedProver prover(prover_instances, verification_key);
+    auto proofs = prover.construct_proofs();
+
+    ASSERT_EQ(proofs.size(), NUM_INSTANCES);
+    for (const auto& proof : proofs) {
+        EXPECT_TRUE(TestFixture::verify(verification_key, proof));
+    }
+}
+
+/**
+ * @brief An unsatisfied instance in the batch yields a failing proof without affecting the others
+ */
+TYPED_TEST(BatchedUltraProverTests, InvalidInstanceIsIsolated)
+{
+    using ProverInstance = typename TestFixture::ProverInstance;
+    using VerificationKey = typename TestFixture::VerificationKey;
+
+    std::vector<std::shared_ptr<ProverInstance>> prover_instances;
+    for (bool valid : { true, false, true }) {
+        auto circuit = TestFixture::construct_circuit(valid);
+        prover_instances.emplace_back(std::make_shared<ProverInstance>(circuit));
+    }
+    auto verification_key = std::make_shared<VerificationKey>(prover_instances[0]->get_precomputed());
+
+    typename TestFixture::BatchedProver prover(prover_instances, verification_key);
+    auto proofs = prover.construct_proofs();
+
+    EXPECT_TRUE(TestFixture::verify(verification_key, proofs[0]));
+    EXPECT_FALSE(TestFixture::verify(verification_key, proofs[1]));
+    EXPECT_TRUE(TestFixture::verify(verification_key, proofs[2]));
+}
+
+/**
+ * @brief Without ZK, the batched proof of an instance is identical to the one produced by UltraProver_
+ */
+TYPED_TEST(BatchedUltraProverTests, MatchesUnbatchedProof)
+{
+    using Flavor = TypeParam;
+    using ProverInstance = typename TestFixture::ProverInstance;
+    using VerificationKey = typename TestFixture::VerificationKey;
+
+    if constexpr (Flavor::HasZK) {
+        GTEST_SKIP() << "ZK proofs are randomised";
+    } else {
+        auto circuit = TestFixture::construct_circuit();
+        auto circuit_copy = circuit;
+        auto other_circuit = TestFixture::construct_circuit();
+
+        auto unbatched_instance = std::make_shared<ProverInstance>(circuit_copy);
+        auto verification_key = std::make_shared<VerificationKey>(unbatched_instance->get_precomputed());
+        typename TestFixture::Prover unbatched_prover(unbatched_instance, verification_key);
+        auto expected_proof = unbatched_prover.construct_proof();
+
+        std::vector<std::shared_ptr<ProverInstance>> prover_instances{ std::make_shared<ProverInstance>(other_circuit),
+                                                                       std::make_shared<ProverInstance>(circuit) };
+        typename TestFixture::BatchedProver prover(prover_instances, verification_key);
+        auto proofs = prover.construct_proofs();
+
+        EXPECT_EQ(proofs[1], expected_proof);
+    }
+}
@@ -81,8 +81,13 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_preamble_ro
 template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_wire_commitments_round()
 {
     BB_BENCH_NAME("OinkProver::execute_wire_commitments_round");
-    // Commit to the first three wire polynomials
-    // We only commit to the fourth wire polynomial after adding memory recordss
+    auto batch = start_wire_commitments_round();
+    finish_wire_commitments_round(batch.commit_and_send_to_verifier(transcript));
+}
+
+template <IsUltraOrMegaHonk Flavor>
+typename OinkProver<Flavor>::CommitBatch OinkProver<Flavor>::start_wire_commitments_round()
+{
     auto batch = prover_instance->commitment_key.start_batch();
     // Commit to the first three wire polynomials
     // We only commit to the fourth wire polynomial after adding memory records
@@ -101,37 +106,35 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_wire_commit
 
         for (auto [polynomial, label] :
              zip_view(prover_instance->polynomials.get_ecc_op_wires(), commitment_labels.get_ecc_op_wires())) {
-            {
-                BB_BENCH_NAME("COMMIT::ecc_op_wires");
-                batch.add_to_batch(polynomial, domain_separator + label, mask_ecc_op_polys);
-            };
+            batch.add_to_batch(polynomial, domain_separator + label, mask_ecc_op_polys);
         }
 
         // Commit to DataBus related polynomials
         for (auto [polynomial, label] :
              zip_view(prover_instance->polynomials.get_databus_entities(), commitment_labels.get_databus_entities())) {
-            {
-                BB_BENCH_NAME("COMMIT::databus");
-                bool is_unmasked_databus_commitment = label == "CALLDATA";
-                batch.add_to_batch(polynomial, label, /*mask?*/ Flavor::HasZK && !is_unmasked_databus_commitment);
-            }
+            bool is_unmasked_databus_commitment = label == "CALLDATA";
+            batch.add_to_batch(polynomial, label, /*mask?*/ Flavor::HasZK && !is_unmasked_databus_commitment);
         }
     }
+    return batch;
+}
 
-    auto computed_commitments = batch.commit_and_send_to_verifier(transcript);
-    prover_instance->commitments.w_l = computed_commitments[0];
-    prover_instance->commitments.w_r = computed_commitments[1];
-    prover_instance->commitments.w_o = computed_commitments[2];
+template <IsUltraOrMegaHonk Flavor>
+void OinkProver<Flavor>::finish_wire_commitments_round(std::span<const Commitment> commitments)
+{
+    prover_instance->commitments.w_l = commitments[0];
+    prover_instance->commitments.w_r = commitments[1];
+    prover_instance->commitments.w_o = commitments[2];
 
     if constexpr (IsMegaFlavor<Flavor>) {
         size_t commitment_idx = 3;
         for (auto& commitment : prover_instance->commitments.get_ecc_op_wires()) {
-            commitment = computed_commitments[commitment_idx];
+            commitment = commitments[commitment_idx];
             commitment_idx++;
         }
 
         for (auto& commitment : prover_instance->commitments.get_databus_entities()) {
-            commitment = computed_commitments[commitment_idx];
+            commitment = commitments[commitment_idx];
             commitment_idx++;
         }
     }
@@ -144,6 +147,13 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_wire_commit
 template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_sorted_list_accumulator_round()
 {
     BB_BENCH_NAME("OinkProver::execute_sorted_list_accumulator_round");
+    auto batch = start_sorted_list_accumulator_round();
+    finish_sorted_list_accumulator_round(batch.commit_and_send_to_verifier(transcript));
+}
+
+template <IsUltraOrMegaHonk Flavor>
+typename OinkProver<Flavor>::CommitBatch OinkProver<Flavor>::start_sorted_list_accumulator_round()
+{
     // Get eta challenges
     auto [eta, eta_two, eta_three] = transcript->template get_challenges<FF>(std::array<std::string, 3>{
         domain_separator + "eta", domain_separator + "eta_two", domain_separator + "eta_three" });
@@ -167,11 +177,15 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_sorted_list
         prover_instance->polynomials.lookup_read_tags, commitment_labels.lookup_read_tags, /*mask?*/ Flavor::HasZK);
     batch.add_to_batch(
         prover_instance->polynomials.w_4, domain_separator + commitment_labels.w_4, /*mask?*/ Flavor::HasZK);
-    auto computed_commitments = batch.commit_and_send_to_verifier(transcript);
+    return batch;
+}
 
-    prover_instance->commitments.lookup_read_counts = computed_commitments[0];
-    prover_instance->commitments.lookup_read_tags = computed_commitments[1];
-    prover_instance->commitments.w_4 = computed_commitments[2];
+template <IsUltraOrMegaHonk Flavor>
+void OinkProver<Flavor>::finish_sorted_list_accumulator_round(std::span<const Commitment> commitments)
+{
+    prover_instance->commitments.lookup_read_counts = commitments[0];
+    prover_instance->commitments.lookup_read_tags = commitments[1];
+    prover_instance->commitments.w_4 = commitments[2];
 }
 
 /**
@@ -181,6 +195,13 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_sorted_list
 template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_log_derivative_inverse_round()
 {
     BB_BENCH_NAME("OinkProver::execute_log_derivative_inverse_round");
+    auto batch = start_log_derivative_inverse_round();
+    finish_log_derivative_inverse_round(batch.commit_and_send_to_verifier(transcript));
+}
+
+template <IsUltraOrMegaHonk Flavor>
+typename OinkProver<Flavor>::CommitBatch OinkProver<Flavor>::start_log_derivative_inverse_round()
+{
     auto [beta, gamma] = transcript->template get_challenges<FF>(
         std::array<std::string, 2>{ domain_separator + "beta", domain_separator + "gamma" });
     prover_instance->relation_parameters.beta = beta;
@@ -202,13 +223,17 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_log_derivat
             batch.add_to_batch(polynomial, label, /*mask?*/ Flavor::HasZK);
         };
     }
-    auto computed_commitments = batch.commit_and_send_to_verifier(transcript);
+    return batch;
+}
 
-    prover_instance->commitments.lookup_inverses = computed_commitments[0];
+template <IsUltraOrMegaHonk Flavor>
+void OinkProver<Flavor>::finish_log_derivative_inverse_round(std::span<const Commitment> commitments)
+{
+    prover_instance->commitments.lookup_inverses = commitments[0];
     if constexpr (IsMegaFlavor<Flavor>) {
         size_t commitment_idx = 1;
         for (auto& commitment : prover_instance->commitments.get_databus_inverses()) {
-            commitment = computed_commitments[commitment_idx];
+            commitment = commitments[commitment_idx];
             commitment_idx++;
         };
     }
@@ -221,19 +246,30 @@ template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_log_derivat
 template <IsUltraOrMegaHonk Flavor> void OinkProver<Flavor>::execute_grand_product_computation_round()
 {
     BB_BENCH_NAME("OinkProver::execute_grand_product_computation_round");
-    // Compute the permutation grand product polynomial
+    auto batch = start_grand_product_computation_round();
+    finish_grand_product_computation_round(batch.commit_and_send_to_verifier(transcript));
+}
 
+template <IsUltraOrMegaHonk Flavor>
+typename OinkProver<Flavor>::CommitBatch OinkProver<Flavor>::start_grand_product_computation_round()
+{
+    // Compute the permutation grand product polynomial
     WitnessComputation<Flavor>::compute_grand_product_polynomial(prover_instance->polynomials,
                                                                  prover_instance->public_inputs,
                                                                  prover_instance->pub_inputs_offset(),
                                                                  prover_instance->relation_parameters,
                                                                  prover_instance->get_final_active_wire_idx() + 1);
 
-    {
-        BB_BENCH_NAME("COMMIT::z_perm");
-        prover_instance->commitments.z_perm =
-            commit_to_witness_polynomial(prover_instance->polynomials.z_perm, commitment_labels.z_perm);
-    }
+    auto batch = prover_instance->commitment_key.start_batch();
+    batch.add_to_batch(
+        prover_instance->polynomials.z_perm, domain_separator + commitment_labels.z_perm, /*mask?*/ Flavor::HasZK);
+    return batch;
+}
+
+template <IsUltraOrMegaHonk Flavor>
+void OinkProver<Flavor>::finish_grand_product_computation_round(std::span<const Commitment> commitments)
+{
+    prover_instance->commitments.z_perm = commitments[0];
 }
 
 template <IsUltraOrMegaHonk Flavor> typename Flavor::SubrelationSeparator OinkProver<Flavor>::generate_alpha_round()
@@ -63,6 +63,9 @@ template <IsUltraOrMegaHonk Flavor> class OinkProver {
         , domain_separator(std::move(domain_separator))
     {}
 
+    using Commitment = typename Flavor::Commitment;
+    using CommitBatch = typename CommitmentKey::CommitBatch;
+
     void prove();
     Proof export_proof();
     void execute_preamble_round();
@@ -70,6 +73,19 @@ template <IsUltraOrMegaHonk Flavor> class OinkProver {
     void execute_sorted_list_accumulator_round();
     void execute_log_derivative_inverse_round();
     void execute_grand_product_computation_round();
+
+    // Each commitment round is split into computing the batch of polynomials to commit to and consuming the resulting
+    // commitments (which have already been sent to the verifier), so that BatchedUltraProver_ can commit to the batches
+    // of several instances with a single batched MSM.
+    CommitBatch start_wire_commitments_round();
+    void finish_wire_commitments_round(std::span<const Commitment> commitments);
+    CommitBatch start_sorted_list_accumulator_round();
+    void finish_sorted_list_accumulator_round(std::span<const Commitment> commitments);
+    CommitBatch start_log_derivative_inverse_round();
+    void finish_log_derivative_inverse_round(std::span<const Commitment> commitments);
+    CommitBatch start_grand_product_computation_round();
+    void finish_grand_product_computation_round(std::span<const Commitment> commitments);
+
     void commit_to_masking_poly();
     SubrelationSeparator generate_alpha_round();
     Flavor::Commitment commit_to_witness_polynomial(Polynomial<FF>& polynomial, const std::string& label);
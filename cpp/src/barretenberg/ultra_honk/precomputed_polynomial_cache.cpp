@@ -0,0 +1,218 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "precomputed_polynomial_cache.hpp"
+#include "barretenberg/common/bb_bench.hpp"
+#include "barretenberg/common/content_digest.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/zip_view.hpp"
+
+#include <cstdint>
+#include <fcntl.h>
+#include <fstream>
+#include <span>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace bb {
+
+namespace {
+
+constexpr uint64_t CACHE_MAGIC = 0x4548434143504242; // "BBPCACHE" in little-endian
+constexpr uint64_t CACHE_VERSION = 2;
+// Polynomial data is aligned so it can be mapped directly; 64KiB is a multiple of every common page size
+constexpr uint64_t DATA_ALIGNMENT = 1 << 16;
+
+struct FileHeader {
+    uint64_t magic;
+    uint64_t version;
+    uint64_t num_polynomials;
+    uint64_t dyadic_size;
+    uint64_t num_public_inputs;
+    uint64_t pub_inputs_offset;
+    uint64_t final_active_wire_idx;
+};
+
+struct PolynomialHeader {
+    uint64_t start_index;
+    uint64_t size;
+    uint64_t virtual_size;
+    uint64_t data_offset;
+    uint64_t digest;
+};
+
+uint64_t align_up(uint64_t offset)
+{
+    return (offset + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1);
+}
+
+#ifndef __wasm__
+bool read_exact(int fd, void* dest, size_t num_bytes, size_t offset)
+{
+    auto* out = static_cast<uint8_t*>(dest);
+    while (num_bytes > 0) {
+        ssize_t num_read = pread(fd, out, num_bytes, static_cast<off_t>(offset));
+        if (num_read <= 0) {
+            return false;
+        }
+        out += num_read;
+        offset += static_cast<size_t>(num_read);
+        num_bytes -= static_cast<size_t>(num_read);
+    }
+    return true;
+}
+#endif
+
+} // namespace
+
+std::filesystem::path PrecomputedPolynomialCache::entry_path(const fr& vk_hash, size_t num_polynomials) const
+{
+    std::ostringstream name;
+    name << vk_hash << "-" << num_polynomials << ".precomputed";
+    return directory / name.str();
+}
+
+bool PrecomputedPolynomialCache::load(const fr& vk_hash,
+                                      const Metadata& expected,
+                                      RefVector<Polynomial> polynomials) const
+{
+#ifdef __wasm__
+    static_cast<void>(vk_hash);
+    static_cast<void>(expected);
+    static_cast<void>(polynomials);
+    return false;
+#else
+    BB_BENCH_NAME("PrecomputedPolynomialCache::load");
+    const auto path = entry_path(vk_hash, polynomials.size());
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    // The mappings hold their own reference to the file, so we can close it on every exit path
+    auto load_entry = [&]() {
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0) {
+            return false;
+        }
+        const auto file_size = static_cast<uint64_t>(file_stat.st_size);
+
+        FileHeader header{};
+        if (!read_exact(fd, &header, sizeof(header), 0) || header.magic != CACHE_MAGIC ||
+            header.version != CACHE_VERSION || header.num_polynomials != polynomials.size()) {
+            return false;
+        }
+        Metadata cached{ .trace = { .dyadic_size = header.dyadic_size,
+                                    .num_public_inputs = header.num_public_inputs,
+                                    .pub_inputs_offset = header.pub_inputs_offset },
+                         .final_active_wire_idx = header.final_active_wire_idx };
+        if (!(cached == expected)) {
+            return false;
+        }
+
+        std::vector<PolynomialHeader> entries(header.num_polynomials);
+        if (!read_exact(fd, entries.data(), entries.size() * sizeof(PolynomialHeader), sizeof(header))) {
+            return false;
+        }
+
+        std::vector<Polynomial> mapped;
+        mapped.reserve(entries.size());
+        for (const auto& entry : entries) {
+            if (entry.start_index + entry.size > entry.virtual_size || entry.data_offset % DATA_ALIGNMENT != 0 ||
+                entry.data_offset + entry.size * sizeof(fr) > file_size) {
+                return false;
+            }
+            if (entry.size == 0) {
+                mapped.emplace_back(0, entry.virtual_size, entry.start_index);
+                continue;
+            }
+            auto memory = BackingMemory<fr>::map_file(fd, entry.data_offset, entry.size);
+            // A damaged or truncated entry is a miss; this reads every page of the entry once
+            if (memory.raw_data == nullptr ||
+                content_digest(std::span<const fr>(memory.raw_data, entry.size)) != entry.digest) {
+                return false;
+            }
+            mapped.emplace_back(std::move(memory), entry.size, entry.virtual_size, entry.start_index);
+        }
+
+        for (auto [poly, mapped_poly] : zip_view(polynomials, mapped)) {
+            poly = std::move(mapped_poly);
+        }
+        return true;
+    };
+
+    bool hit = load_entry();
+    close(fd);
+    vinfo("precomputed polynomial cache ", hit ? "hit: " : "miss: ", path);
+    return hit;
+#endif
+}
+
+void PrecomputedPolynomialCache::store(const fr& vk_hash,
+                                       const Metadata& metadata,
+                                       RefVector<Polynomial> polynomials) const
+{
+#ifdef __wasm__
+    static_cast<void>(vk_hash);
+    static_cast<void>(metadata);
+    static_cast<void>(polynomials);
+#else
+    BB_BENCH_NAME("PrecomputedPolynomialCache::store");
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    const auto path = entry_path(vk_hash, polynomials.size());
+    // Write to a process-unique temporary file and rename it into place so concurrent readers and writers of the same
+    // entry never observe a partially written file
+    auto tmp_path = path;
+    tmp_path += ".tmp" + std::to_string(getpid());
+
+    FileHeader header{ .magic = CACHE_MAGIC,
+                       .version = CACHE_VERSION,
+                       .num_polynomials = polynomials.size(),
+                       .dyadic_size = metadata.trace.dyadic_size,
+                       .num_public_inputs = metadata.trace.num_public_inputs,
+                       .pub_inputs_offset = metadata.trace.pub_inputs_offset,
+                       .final_active_wire_idx = metadata.final_active_wire_idx };
+
+    std::vector<PolynomialHeader> entries;
+    entries.reserve(polynomials.size());
+    uint64_t data_offset = align_up(sizeof(FileHeader) + polynomials.size() * sizeof(PolynomialHeader));
+    for (const auto& poly : polynomials) {
+        entries.push_back({ .start_index = poly.start_index(),
+                            .size = poly.size(),
+                            .virtual_size = poly.virtual_size(),
+                            .data_offset = data_offset,
+                            .digest = content_digest(std::span<const fr>(poly.data(), poly.size())) });
+        data_offset = align_up(data_offset + poly.size() * sizeof(fr));
+    }
+
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()),
+                   static_cast<std::streamsize>(entries.size() * sizeof(PolynomialHeader)));
+        for (auto [entry, poly] : zip_view(entries, polynomials)) {
+            file.seekp(static_cast<std::streamoff>(entry.data_offset));
+            file.write(reinterpret_cast<const char*>(poly.data()),
+                       static_cast<std::streamsize>(poly.size() * sizeof(fr)));
+        }
+        if (!file) {
+            info("failed to write precomputed polynomial cache entry: ", tmp_path);
+            std::filesystem::remove(tmp_path, error);
+            return;
+        }
+    }
+    std::filesystem::rename(tmp_path, path, error);
+    if (error) {
+        info("failed to store precomputed polynomial cache entry: ", path, " (", error.message(), ")");
+        std::filesystem::remove(tmp_path, error);
+    }
+#endif
+}
+
+} // namespace bb
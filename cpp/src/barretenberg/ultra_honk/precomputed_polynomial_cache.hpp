@@ -0,0 +1,72 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/flavor/flavor.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+
+#include <filesystem>
+
+namespace bb {
+
+/**
+ * @brief On-disk cache of the precomputed polynomials (selectors, sigmas/ids, tables, lagranges) of a circuit, keyed by
+ * the hash of its verification key.
+ *
+ * @details Each entry is a single flat file in native layout: a header recording the trace metadata and the shape of
+ * every polynomial, followed by the raw (Montgomery form) coefficients of each polynomial at a page-aligned offset. A
+ * ProverInstance proving a circuit whose VK is known can then map the polynomials copy-on-write straight from the file
+ * instead of recomputing them from the circuit, and concurrent provers of the same circuit share the pages through the
+ * page cache.
+ *
+ * Entries are written to a temporary file and renamed into place, so readers never observe a partial entry. Each
+ * polynomial's coefficients are recorded with a content digest which is checked when the entry is mapped. Any
+ * mismatch (format, number of polynomials, trace metadata, digest) is treated as a miss.
+ */
+class PrecomputedPolynomialCache {
+  public:
+    using Polynomial = bb::Polynomial<fr>;
+
+    /**
+     * @brief Trace metadata that must match between the cached entry and the circuit being proven
+     */
+    struct Metadata {
+        MetaData trace;
+        size_t final_active_wire_idx = 0;
+
+        bool operator==(const Metadata& other) const
+        {
+            return trace.dyadic_size == other.trace.dyadic_size &&
+                   trace.num_public_inputs == other.trace.num_public_inputs &&
+                   trace.pub_inputs_offset == other.trace.pub_inputs_offset &&
+                   final_active_wire_idx == other.final_active_wire_idx;
+        }
+    };
+
+    explicit PrecomputedPolynomialCache(std::filesystem::path directory)
+        : directory(std::move(directory))
+    {}
+
+    std::filesystem::path entry_path(const fr& vk_hash, size_t num_polynomials) const;
+
+    /**
+     * @brief Map the cached polynomials for `vk_hash` into `polynomials`.
+     * @return false (leaving `polynomials` untouched) if there is no valid entry matching `expected`
+     */
+    bool load(const fr& vk_hash, const Metadata& expected, RefVector<Polynomial> polynomials) const;
+
+    /**
+     * @brief Write `polynomials` as the entry for `vk_hash`; failures are logged and otherwise ignored.
+     */
+    void store(const fr& vk_hash, const Metadata& metadata, RefVector<Polynomial> polynomials) const;
+
+  private:
+    std::filesystem::path directory;
+};
+
+} // namespace bb
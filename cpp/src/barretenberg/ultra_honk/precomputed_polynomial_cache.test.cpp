@@ -0,0 +1,136 @@
+#include "barretenberg/ultra_honk/precomputed_polynomial_cache.hpp"
+#include "barretenberg/common/zip_view.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/ultra_honk/prover_instance.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace bb;
+
+class PrecomputedPolynomialCacheTests : public ::testing::Test {
+  public:
+    using Flavor = MegaFlavor;
+    using Builder = Flavor::CircuitBuilder;
+    using ProverInstance = ProverInstance_<Flavor>;
+    using VerificationKey = Flavor::VerificationKey;
+
+    static void SetUpTestSuite() { bb::srs::init_file_crs_factory(bb::srs::bb_crs_path()); }
+
+    void SetUp() override
+    {
+        cache_dir = std::filesystem::temp_directory_path() / ("bb-precomputed-cache-test-" + std::to_string(getpid()));
+        std::filesystem::remove_all(cache_dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(cache_dir); }
+
+    static Builder construct_circuit()
+    {
+        Builder builder;
+        builder.add_ultra_and_mega_gates_to_ensure_all_polys_are_non_zero();
+        MockCircuits::add_arithmetic_gates(builder, 1 << 10);
+        return builder;
+    }
+
+    std::filesystem::path cache_dir;
+};
+
+/**
+ * @brief A prover instance built from a cache hit has exactly the polynomials of one built from scratch
+ */
+TEST_F(PrecomputedPolynomialCacheTests, CachedInstanceMatchesFreshInstance)
+{
+    auto circuit = construct_circuit();
+    auto populating_circuit = circuit;
+    auto cached_circuit = circuit;
+    auto fresh_instance = std::make_shared<ProverInstance>(circuit);
+    auto verification_key = std::make_shared<VerificationKey>(fresh_instance->get_precomputed());
+    const fr vk_hash = verification_key->hash();
+
+    PrecomputedPolynomialCache cache(cache_dir);
+    const auto entry = cache.entry_path(vk_hash, Flavor::NUM_PRECOMPUTED_ENTITIES);
+
+    // The first instance misses and populates the cache
+    auto populating_instance = std::make_shared<ProverInstance>(populating_circuit, cache, vk_hash);
+    EXPECT_TRUE(std::filesystem::exists(entry));
+
+    // The second instance maps its precomputed polynomials from the cache
+    auto cached_instance = std::make_shared<ProverInstance>(cached_circuit, cache, vk_hash);
+
+    for (auto& instance : { populating_instance, cached_instance }) {
+        for (auto [expected, actual] :
+             zip_view(fresh_instance->polynomials.get_all(), instance->polynomials.get_all())) {
+            EXPECT_EQ(expected, actual);
+        }
+        EXPECT_EQ(instance->public_inputs, fresh_instance->public_inputs);
+    }
+    VerificationKey cached_verification_key(cached_instance->get_precomputed());
+    EXPECT_EQ(cached_verification_key.hash(), vk_hash);
+}
+
+/**
+ * @brief An entry whose trace metadata does not match the circuit is treated as a miss
+ */
+TEST_F(PrecomputedPolynomialCacheTests, MetadataMismatchIsMiss)
+{
+    auto circuit = construct_circuit();
+    auto instance = std::make_shared<ProverInstance>(circuit);
+    const fr vk_hash = VerificationKey(instance->get_precomputed()).hash();
+
+    PrecomputedPolynomialCache cache(cache_dir);
+    PrecomputedPolynomialCache::Metadata metadata{ .trace = instance->get_metadata(),
+                                                   .final_active_wire_idx = instance->get_final_active_wire_idx() };
+    cache.store(vk_hash, metadata, RefVector<Flavor::Polynomial>(instance->polynomials.get_precomputed()));
+
+    Flavor::ProverPolynomials polynomials;
+    EXPECT_TRUE(cache.load(vk_hash, metadata, RefVector<Flavor::Polynomial>(polynomials.get_precomputed())));
+    for (auto [expected, actual] : zip_view(instance->polynomials.get_precomputed(), polynomials.get_precomputed())) {
+        EXPECT_EQ(expected, actual);
+    }
+
+    auto mismatched = metadata;
+    mismatched.final_active_wire_idx++;
+    Flavor::ProverPolynomials untouched;
+    EXPECT_FALSE(cache.load(vk_hash, mismatched, RefVector<Flavor::Polynomial>(untouched.get_precomputed())));
+    EXPECT_FALSE(cache.load(fr(1), metadata, RefVector<Flavor::Polynomial>(untouched.get_precomputed())));
+    for (auto& poly : untouched.get_precomputed()) {
+        EXPECT_TRUE(poly.is_empty());
+    }
+}
+
+/**
+ * @brief An entry whose polynomial data does not match its recorded digest is treated as a miss
+ */
+TEST_F(PrecomputedPolynomialCacheTests, DamagedEntryIsMiss)
+{
+    auto circuit = construct_circuit();
+    auto instance = std::make_shared<ProverInstance>(circuit);
+    const fr vk_hash = VerificationKey(instance->get_precomputed()).hash();
+
+    PrecomputedPolynomialCache cache(cache_dir);
+    PrecomputedPolynomialCache::Metadata metadata{ .trace = instance->get_metadata(),
+                                                   .final_active_wire_idx = instance->get_final_active_wire_idx() };
+    cache.store(vk_hash, metadata, RefVector<Flavor::Polynomial>(instance->polynomials.get_precomputed()));
+
+    // The file ends with the coefficients of the last non-empty polynomial; flip a bit of the last one
+    const auto entry = cache.entry_path(vk_hash, Flavor::NUM_PRECOMPUTED_ENTITIES);
+    {
+        std::fstream file(entry, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekg(-1, std::ios::end);
+        char byte = 0;
+        file.read(&byte, 1);
+        byte ^= 1;
+        file.seekp(-1, std::ios::end);
+        file.write(&byte, 1);
+        ASSERT_TRUE(file.good());
+    }
+
+    Flavor::ProverPolynomials untouched;
+    EXPECT_FALSE(cache.load(vk_hash, metadata, RefVector<Flavor::Polynomial>(untouched.get_precomputed())));
+    for (auto& poly : untouched.get_precomputed()) {
+        EXPECT_TRUE(poly.is_empty());
+    }
+}
@@ -11,8 +11,135 @@
 #include "barretenberg/honk/proof_system/logderivative_library.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 
+#include <chrono>
+
 namespace bb {
 
+template <IsUltraOrMegaHonk Flavor>
+void ProverInstance_<Flavor>::construct(Circuit& circuit, const PrecomputedPolynomialCache* cache, const FF& vk_hash)
+{
+    BB_BENCH_NAME("ProverInstance(Circuit&)");
+    vinfo("Constructing ProverInstance");
+    auto start = std::chrono::steady_clock::now();
+
+    // Check pairing point tagging: either no pairing points were created,
+    // or all pairing points have been aggregated into a single equivalence class
+    BB_ASSERT(circuit.pairing_points_tagging.has_single_pairing_point_tag(),
+              "Pairing points must all be aggregated together. Either no pairing points should be created, or "
+              "all created pairing points must be aggregated into a single pairing point. Found ",
+              circuit.pairing_points_tagging.num_unique_pairing_points(),
+              " different pairing points.");
+    // Check pairing point tagging: check that the pairing points have been set to public
+    BB_ASSERT(circuit.pairing_points_tagging.has_public_pairing_points() ||
+                  !circuit.pairing_points_tagging.has_pairing_points(),
+              "Pairing points must be set to public in the circuit before constructing the ProverInstance.");
+
+    // Decider proving keys can be constructed multiple times, hence, we check whether the circuit has been
+    // finalized
+    if (!circuit.circuit_finalized) {
+        circuit.finalize_circuit(/* ensure_nonzero = */ true);
+    }
+    metadata.dyadic_size = compute_dyadic_size(circuit);
+
+    // Find index of last non-trivial wire value in the trace
+    circuit.blocks.compute_offsets(); // compute offset of each block within the trace
+    for (auto& block : circuit.blocks.get()) {
+        if (block.size() > 0) {
+            final_active_wire_idx = block.trace_offset() + block.size() - 1;
+        }
+    }
+    metadata.num_public_inputs = circuit.blocks.pub_inputs.size();
+    metadata.pub_inputs_offset = circuit.blocks.pub_inputs.trace_offset();
+
+    // Try to map the precomputed polynomials from the cache; this must happen before the remaining polynomials are
+    // allocated so that the allocation below can skip them
+    const PrecomputedPolynomialCache::Metadata cache_metadata{ .trace = metadata,
+                                                               .final_active_wire_idx = final_active_wire_idx };
+    if (cache != nullptr) {
+        precomputed_from_cache =
+            cache->load(vk_hash, cache_metadata, RefVector<Polynomial>(polynomials.get_precomputed()));
+    }
+
+    vinfo("allocating polynomials object in prover instance...");
+    {
+        BB_BENCH_NAME("allocating polynomials");
+
+        populate_memory_records(circuit);
+
+        allocate_wires();
+
+        allocate_permutation_argument_polynomials();
+
+        allocate_selectors(circuit);
+
+        allocate_table_lookup_polynomials(circuit);
+
+        allocate_lagrange_polynomials();
+
+        if constexpr (IsMegaFlavor<Flavor>) {
+            allocate_ecc_op_polynomials(circuit);
+        }
+        if constexpr (HasDataBus<Flavor>) {
+            allocate_databus_polynomials(circuit);
+        }
+
+        // Set the shifted polynomials now that all of the to_be_shifted polynomials are defined.
+        polynomials.set_shifted();
+    }
+
+    // Construct and add to proving key the wire, selector and copy constraint polynomials
+    vinfo("populating trace...");
+    if (precomputed_from_cache) {
+        Trace::populate_wires(circuit, polynomials);
+    } else {
+        Trace::populate(circuit, polynomials);
+    }
+
+    {
+        BB_BENCH_NAME("constructing prover instance after trace populate");
+
+        // If Goblin, construct the databus polynomials
+        if constexpr (IsMegaFlavor<Flavor>) {
+            BB_BENCH_NAME("constructing databus polynomials");
+
+            construct_databus_polynomials(circuit);
+        }
+    }
+
+    if (!precomputed_from_cache) {
+        // Set the lagrange polynomials
+        polynomials.lagrange_first.at(0) = 1;
+        polynomials.lagrange_last.at(final_active_wire_idx) = 1;
+
+        BB_BENCH_NAME("constructing lookup table polynomials");
+
+        construct_lookup_table_polynomials<Flavor>(polynomials.get_tables(), circuit);
+    }
+
+    {
+        BB_BENCH_NAME("constructing lookup read counts");
+
+        construct_lookup_read_counts<Flavor>(polynomials.lookup_read_counts, polynomials.lookup_read_tags, circuit);
+    }
+    { // Public inputs handling
+        for (size_t i = 0; i < metadata.num_public_inputs; ++i) {
+            size_t idx = i + metadata.pub_inputs_offset;
+            public_inputs.emplace_back(polynomials.w_r[idx]);
+        }
+
+        if constexpr (HasIPAAccumulator<Flavor>) { // Set the IPA claim indices
+            ipa_proof = circuit.ipa_proof;
+        }
+    }
+
+    if (cache != nullptr && !precomputed_from_cache) {
+        cache->store(vk_hash, cache_metadata, RefVector<Polynomial>(polynomials.get_precomputed()));
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+    vinfo("time to construct proving key: ", diff.count(), " ms.");
+}
+
 /**
  * @brief Compute the minimum dyadic (power-of-2) circuit size
  * @details The dyadic circuit size is the smallest power of two which can accommodate all polynomials required for the
@@ -56,11 +183,13 @@ template <IsUltraOrMegaHonk Flavor> void ProverInstance_<Flavor>::allocate_permu
     BB_BENCH_NAME("allocate_permutation_argument_polynomials");
 
     // Sigma and ID polynomials are zero outside the active trace range
-    for (auto& sigma : polynomials.get_sigmas()) {
-        sigma = Polynomial::shiftable(trace_active_range_size(), dyadic_size());
-    }
-    for (auto& id : polynomials.get_ids()) {
-        id = Polynomial::shiftable(trace_active_range_size(), dyadic_size());
+    if (!precomputed_from_cache) {
+        for (auto& sigma : polynomials.get_sigmas()) {
+            sigma = Polynomial::shiftable(trace_active_range_size(), dyadic_size());
+        }
+        for (auto& id : polynomials.get_ids()) {
+            id = Polynomial::shiftable(trace_active_range_size(), dyadic_size());
+        }
     }
 
     // If no ZK, allocate only the active range of the trace; else allocate full dyadic size to allow for blinding
@@ -72,6 +201,9 @@ template <IsUltraOrMegaHonk Flavor> void ProverInstance_<Flavor>::allocate_lagra
 {
     BB_BENCH_NAME("allocate_lagrange_polynomials");
 
+    if (precomputed_from_cache) {
+        return;
+    }
     polynomials.lagrange_first = Polynomial(
         /* size=*/1, /*virtual size=*/dyadic_size(), /*start_index=*/0);
 
@@ -83,6 +215,9 @@ template <IsUltraOrMegaHonk Flavor> void ProverInstance_<Flavor>::allocate_selec
 {
     BB_BENCH_NAME("allocate_selectors");
 
+    if (precomputed_from_cache) {
+        return;
+    }
     // Define gate selectors over the block they are isolated to
     for (auto [selector, block] : zip_view(polynomials.get_gate_selectors(), circuit.blocks.get_gate_blocks())) {
         selector = Polynomial(block.size(), dyadic_size(), block.trace_offset());
@@ -103,8 +238,10 @@ void ProverInstance_<Flavor>::allocate_table_lookup_polynomials(const Circuit& c
 
     // Allocate polynomials containing the actual table data; offset to align with the lookup gate block
     BB_ASSERT_GT(dyadic_size(), tables_size);
-    for (auto& table_poly : polynomials.get_tables()) {
-        table_poly = Polynomial(tables_size, dyadic_size());
+    if (!precomputed_from_cache) {
+        for (auto& table_poly : polynomials.get_tables()) {
+            table_poly = Polynomial(tables_size, dyadic_size());
+        }
     }
 
     // Read counts and tags: track which table entries have been read
@@ -134,7 +271,9 @@ void ProverInstance_<Flavor>::allocate_ecc_op_polynomials(const Circuit& circuit
     for (auto& wire : polynomials.get_ecc_op_wires()) {
         wire = Polynomial(ecc_op_block_size, dyadic_size());
     }
-    polynomials.lagrange_ecc_op = Polynomial(ecc_op_block_size, dyadic_size());
+    if (!precomputed_from_cache) {
+        polynomials.lagrange_ecc_op = Polynomial(ecc_op_block_size, dyadic_size());
+    }
 }
 
 template <IsUltraOrMegaHonk Flavor>
@@ -178,7 +317,9 @@ void ProverInstance_<Flavor>::allocate_databus_polynomials(const Circuit& circui
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1555): Allocate minimum size >1 to avoid point at
     // infinity commitment.
     const size_t max_databus_column_size = std::max({ calldata_size, sec_calldata_size, return_data_size, 2UL });
-    polynomials.databus_id = Polynomial(max_databus_column_size, dyadic_size());
+    if (!precomputed_from_cache) {
+        polynomials.databus_id = Polynomial(max_databus_column_size, dyadic_size());
+    }
 }
 
 /**
@@ -225,6 +366,9 @@ void ProverInstance_<Flavor>::construct_databus_polynomials(Circuit& circuit)
         return_data_read_tags.at(idx) = return_data_read_counts[idx] > 0 ? 1 : 0; // has row been read or not
     }
 
+    if (precomputed_from_cache) {
+        return;
+    }
     auto& databus_id = polynomials.databus_id;
     // Compute a simple identity polynomial for use in the databus lookup argument
     for (size_t i = 0; i < databus_id.size(); ++i) {
@@ -21,6 +21,7 @@
 #include "barretenberg/honk/execution_trace/ultra_execution_trace.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/trace_to_polynomials/trace_to_polynomials.hpp"
+#include "barretenberg/ultra_honk/precomputed_polynomial_cache.hpp"
 #include <chrono>
 
 namespace bb {
@@ -96,108 +97,22 @@ template <IsUltraOrMegaHonk Flavor_> class ProverInstance_ {
     ProverInstance_(Circuit& circuit, const CommitmentKey& commitment_key = CommitmentKey())
         : commitment_key(commitment_key)
     {
-        BB_BENCH_NAME("ProverInstance(Circuit&)");
-        vinfo("Constructing ProverInstance");
-        auto start = std::chrono::steady_clock::now();
-
-        // Check pairing point tagging: either no pairing points were created,
-        // or all pairing points have been aggregated into a single equivalence class
-        BB_ASSERT(circuit.pairing_points_tagging.has_single_pairing_point_tag(),
-                  "Pairing points must all be aggregated together. Either no pairing points should be created, or "
-                  "all created pairing points must be aggregated into a single pairing point. Found ",
-                  circuit.pairing_points_tagging.num_unique_pairing_points(),
-                  " different pairing points.");
-        // Check pairing point tagging: check that the pairing points have been set to public
-        BB_ASSERT(circuit.pairing_points_tagging.has_public_pairing_points() ||
-                      !circuit.pairing_points_tagging.has_pairing_points(),
-                  "Pairing points must be set to public in the circuit before constructing the ProverInstance.");
-
-        // Decider proving keys can be constructed multiple times, hence, we check whether the circuit has been
-        // finalized
-        if (!circuit.circuit_finalized) {
-            circuit.finalize_circuit(/* ensure_nonzero = */ true);
-        }
-        metadata.dyadic_size = compute_dyadic_size(circuit);
-
-        // Find index of last non-trivial wire value in the trace
-        circuit.blocks.compute_offsets(); // compute offset of each block within the trace
-        for (auto& block : circuit.blocks.get()) {
-            if (block.size() > 0) {
-                final_active_wire_idx = block.trace_offset() + block.size() - 1;
-            }
-        }
-
-        vinfo("allocating polynomials object in prover instance...");
-        {
-            BB_BENCH_NAME("allocating polynomials");
-
-            populate_memory_records(circuit);
-
-            allocate_wires();
-
-            allocate_permutation_argument_polynomials();
-
-            allocate_selectors(circuit);
-
-            allocate_table_lookup_polynomials(circuit);
-
-            allocate_lagrange_polynomials();
-
-            if constexpr (IsMegaFlavor<Flavor>) {
-                allocate_ecc_op_polynomials(circuit);
-            }
-            if constexpr (HasDataBus<Flavor>) {
-                allocate_databus_polynomials(circuit);
-            }
-
-            // Set the shifted polynomials now that all of the to_be_shifted polynomials are defined.
-            polynomials.set_shifted();
-        }
-
-        // Construct and add to proving key the wire, selector and copy constraint polynomials
-        vinfo("populating trace...");
-        Trace::populate(circuit, polynomials);
-
-        {
-            BB_BENCH_NAME("constructing prover instance after trace populate");
-
-            // If Goblin, construct the databus polynomials
-            if constexpr (IsMegaFlavor<Flavor>) {
-                BB_BENCH_NAME("constructing databus polynomials");
-
-                construct_databus_polynomials(circuit);
-            }
-        }
-        // Set the lagrange polynomials
-        polynomials.lagrange_first.at(0) = 1;
-        polynomials.lagrange_last.at(final_active_wire_idx) = 1;
-
-        {
-            BB_BENCH_NAME("constructing lookup table polynomials");
-
-            construct_lookup_table_polynomials<Flavor>(polynomials.get_tables(), circuit);
-        }
-
-        {
-            BB_BENCH_NAME("constructing lookup read counts");
-
-            construct_lookup_read_counts<Flavor>(polynomials.lookup_read_counts, polynomials.lookup_read_tags, circuit);
-        }
-        { // Public inputs handling
-            metadata.num_public_inputs = circuit.blocks.pub_inputs.size();
-            metadata.pub_inputs_offset = circuit.blocks.pub_inputs.trace_offset();
-            for (size_t i = 0; i < metadata.num_public_inputs; ++i) {
-                size_t idx = i + metadata.pub_inputs_offset;
-                public_inputs.emplace_back(polynomials.w_r[idx]);
-            }
-
-            if constexpr (HasIPAAccumulator<Flavor>) { // Set the IPA claim indices
-                ipa_proof = circuit.ipa_proof;
-            }
-        }
-        auto end = std::chrono::steady_clock::now();
-        auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-        vinfo("time to construct proving key: ", diff.count(), " ms.");
+        construct(circuit, /*cache=*/nullptr, /*vk_hash=*/FF(0));
+    }
+
+    /**
+     * @brief Construct from a circuit whose verification key hash is already known (e.g. from a stored VK).
+     * @details The precomputed polynomials are mapped from `cache` if it holds a matching entry, skipping selector,
+     * permutation, table and lagrange construction entirely; otherwise they are computed as usual and stored in the
+     * cache for subsequent provers of the same circuit.
+     */
+    ProverInstance_(Circuit& circuit,
+                    const PrecomputedPolynomialCache& cache,
+                    const FF& vk_hash,
+                    const CommitmentKey& commitment_key = CommitmentKey())
+        : commitment_key(commitment_key)
+    {
+        construct(circuit, &cache, vk_hash);
     }
 
     ProverInstance_() = default;
@@ -211,6 +126,11 @@ template <IsUltraOrMegaHonk Flavor_> class ProverInstance_ {
     static constexpr size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
     static constexpr size_t NUM_WIRES = Circuit::NUM_WIRES;
 
+    // whether the precomputed polynomials were mapped from a PrecomputedPolynomialCache rather than computed
+    bool precomputed_from_cache = false;
+
+    void construct(Circuit& circuit, const PrecomputedPolynomialCache* cache, const FF& vk_hash);
+
     size_t compute_dyadic_size(Circuit&);
 
     void allocate_wires();
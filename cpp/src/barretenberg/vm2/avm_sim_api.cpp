@@ -25,6 +25,22 @@ TxSimulationResult AvmSimAPI::simulate(const FastSimulationInputs& inputs,
                                                                              inputs.protocol_contracts));
 }
 
+std::vector<TxSimulationResult> AvmSimAPI::simulate_block(const FastBlockSimulationInputs& inputs,
+                                                          simulation::ContractDBInterface& contract_db,
+                                                          world_state::WorldState& ws)
+{
+    info("Simulating block of ", inputs.txs.size(), " transactions...");
+    AvmSimulationHelper simulation_helper;
+    return AVM_TRACK_TIME_V("simulation/block",
+                            simulation_helper.simulate_block_fast_with_existing_ws(contract_db,
+                                                                                   inputs.ws_revision,
+                                                                                   ws,
+                                                                                   inputs.config,
+                                                                                   inputs.txs,
+                                                                                   inputs.global_variables,
+                                                                                   inputs.protocol_contracts));
+}
+
 TxSimulationResult AvmSimAPI::simulate_with_hinted_dbs(const ProvingInputs& inputs)
 {
     info("Simulating...");
@@ -9,6 +9,7 @@ class AvmSimAPI {
   public:
     using ProvingInputs = AvmProvingInputs;
     using FastSimulationInputs = AvmFastSimulationInputs;
+    using FastBlockSimulationInputs = AvmFastBlockSimulationInputs;
 
     AvmSimAPI() = default;
 
@@ -16,6 +17,10 @@ class AvmSimAPI {
                                 simulation::ContractDBInterface& contract_db,
                                 world_state::WorldState& ws);
     TxSimulationResult simulate_with_hinted_dbs(const AvmProvingInputs& inputs);
+    // Simulates the transactions of a block in order, executing independent transactions in parallel.
+    std::vector<TxSimulationResult> simulate_block(const FastBlockSimulationInputs& inputs,
+                                                   simulation::ContractDBInterface& contract_db,
+                                                   world_state::WorldState& ws);
 };
 
 } // namespace bb::avm2
@@ -0,0 +1,223 @@
+#include "barretenberg/vm2/avm_sim_api.hpp"
+
+#include <filesystem>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/vm2/common/aztec_constants.hpp"
+#include "barretenberg/vm2/common/aztec_types.hpp"
+#include "barretenberg/vm2/common/memory_types.hpp"
+#include "barretenberg/vm2/common/opcodes.hpp"
+#include "barretenberg/vm2/simulation/lib/merkle.hpp"
+#include "barretenberg/vm2/simulation/testing/mock_dbs.hpp"
+#include "barretenberg/vm2/simulation_helper.hpp"
+#include "barretenberg/vm2/testing/instruction_builder.hpp"
+#include "barretenberg/world_state/world_state.hpp"
+
+namespace bb::avm2 {
+namespace {
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+using simulation::MockContractDB;
+using testing::InstructionBuilder;
+using world_state::MerkleTreeId;
+using world_state::WorldState;
+using world_state::WorldStateRevision;
+
+const AztecAddress CONTRACT_ADDRESS = 0xc0ffee;
+const ContractClassId CONTRACT_CLASS_ID = 0xc1a55;
+
+// A contract that takes (slot, increment, nullifier) as calldata, adds the increment to the value stored in the slot,
+// emits the nullifier and returns the value it read.
+std::vector<uint8_t> counter_bytecode()
+{
+    const std::vector<simulation::Instruction> instructions = {
+        InstructionBuilder(WireOpCode::SET_8).operand<uint8_t>(0).operand(MemoryTag::U32).operand<uint8_t>(3).build(),
+        InstructionBuilder(WireOpCode::SET_8).operand<uint8_t>(1).operand(MemoryTag::U32).operand<uint8_t>(0).build(),
+        InstructionBuilder(WireOpCode::CALLDATACOPY)
+            .operand<uint16_t>(0)
+            .operand<uint16_t>(1)
+            .operand<uint16_t>(10)
+            .build(),
+        InstructionBuilder(WireOpCode::SLOAD).operand<uint16_t>(10).operand<uint16_t>(20).build(),
+        InstructionBuilder(WireOpCode::ADD_8).operand<uint8_t>(20).operand<uint8_t>(11).operand<uint8_t>(21).build(),
+        InstructionBuilder(WireOpCode::SSTORE).operand<uint16_t>(21).operand<uint16_t>(10).build(),
+        InstructionBuilder(WireOpCode::EMITNULLIFIER).operand<uint16_t>(12).build(),
+        InstructionBuilder(WireOpCode::SET_8).operand<uint8_t>(2).operand(MemoryTag::U32).operand<uint8_t>(1).build(),
+        InstructionBuilder(WireOpCode::RETURN).operand<uint16_t>(2).operand<uint16_t>(20).build(),
+    };
+
+    std::vector<uint8_t> bytecode;
+    for (const auto& instruction : instructions) {
+        auto serialized = instruction.serialize();
+        bytecode.insert(bytecode.end(), serialized.begin(), serialized.end());
+    }
+    return bytecode;
+}
+
+// Every transaction has its own first nullifier and fee payer, so that the only state they share is the one touched
+// by the contract.
+Tx make_tx(size_t index, const FF& slot, const FF& increment, const FF& nullifier)
+{
+    return Tx{
+        .hash = "0x" + std::to_string(index + 1),
+        .gas_settings = { .gas_limits = { .l2_gas = 1000000, .da_gas = 1000000 } },
+        .non_revertible_accumulated_data = { .nullifiers = { FF(0xaaaa0000 + index) } },
+        .app_logic_enqueued_calls = { {
+            .request = { .msg_sender = 100, .contract_address = CONTRACT_ADDRESS },
+            .calldata = { slot, increment, nullifier },
+        } },
+        .fee_payer = FF(0xfee0000 + index),
+    };
+}
+
+class AvmSimAPIBlockTest : public ::testing::Test {
+  protected:
+    AvmSimAPIBlockTest()
+        : data_dir(crypto::merkle_tree::random_temp_directory())
+    {
+        std::filesystem::create_directories(data_dir);
+        ws = std::make_unique<WorldState>(
+            /*thread_pool_size=*/4, data_dir, /*map_size=*/10240, tree_heights, tree_prefill, /*generator_point=*/28);
+
+        ON_CALL(contract_db, get_contract_instance(CONTRACT_ADDRESS))
+            .WillByDefault(Return(ContractInstance{ .current_contract_class_id = CONTRACT_CLASS_ID,
+                                                    .original_contract_class_id = CONTRACT_CLASS_ID }));
+        ON_CALL(contract_db, get_contract_class(CONTRACT_CLASS_ID))
+            .WillByDefault(Return(ContractClass{ .id = CONTRACT_CLASS_ID, .packed_bytecode = counter_bytecode() }));
+        ON_CALL(contract_db, get_bytecode_commitment(CONTRACT_CLASS_ID)).WillByDefault(Return(FF(0)));
+    }
+
+    ~AvmSimAPIBlockTest() override
+    {
+        ws.reset();
+        std::filesystem::remove_all(data_dir);
+    }
+
+    // A fork of the genesis state in which the contract is deployed.
+    WorldStateRevision create_fork()
+    {
+        const uint64_t fork_id = ws->create_fork(0);
+        ws->insert_indexed_leaves<crypto::merkle_tree::NullifierLeafValue>(
+            MerkleTreeId::NULLIFIER_TREE,
+            { simulation::unconstrained_silo_nullifier(CONTRACT_INSTANCE_REGISTRY_CONTRACT_ADDRESS, CONTRACT_ADDRESS) },
+            fork_id);
+        return WorldStateRevision{ .forkId = fork_id, .includeUncommitted = true };
+    }
+
+    // Simulates the block on its own fork both transaction by transaction and with simulate_block, and checks that
+    // both produce the same results and leave the trees in the same state.
+    std::vector<TxSimulationResult> simulate_both_ways(const std::vector<Tx>& txs)
+    {
+        const PublicSimulatorConfig config{ .collect_call_metadata = true };
+        const GlobalVariables globals{ .chain_id = 1, .version = 1, .block_number = 1, .timestamp = 1000 };
+        const ProtocolContracts protocol_contracts{};
+
+        const WorldStateRevision sequential_revision = create_fork();
+        std::vector<TxSimulationResult> sequential_results;
+        for (const Tx& tx : txs) {
+            AvmSimulationHelper helper;
+            sequential_results.push_back(helper.simulate_fast_with_existing_ws(
+                contract_db, sequential_revision, *ws, config, tx, globals, protocol_contracts));
+        }
+
+        const WorldStateRevision block_revision = create_fork();
+        AvmSimAPI avm;
+        std::vector<TxSimulationResult> block_results = avm.simulate_block(
+            { .ws_revision = block_revision,
+              .config = config,
+              .txs = txs,
+              .global_variables = globals,
+              .protocol_contracts = protocol_contracts },
+            contract_db,
+            *ws);
+
+        EXPECT_EQ(block_results.size(), sequential_results.size());
+        for (size_t i = 0; i < std::min(block_results.size(), sequential_results.size()); ++i) {
+            EXPECT_EQ(block_results[i], sequential_results[i]) << "transaction " << i;
+        }
+        EXPECT_EQ(ws->get_state_reference(block_revision), ws->get_state_reference(sequential_revision));
+
+        return sequential_results;
+    }
+
+    static FF returned_value(const TxSimulationResult& result)
+    {
+        const auto& values = result.app_logic_return_values.at(0).values;
+        return values.has_value() && !values->empty() ? values->at(0) : FF(0);
+    }
+
+    std::string data_dir;
+    std::unordered_map<MerkleTreeId, uint32_t> tree_heights{
+        { MerkleTreeId::NULLIFIER_TREE, NULLIFIER_TREE_HEIGHT },
+        { MerkleTreeId::NOTE_HASH_TREE, NOTE_HASH_TREE_HEIGHT },
+        { MerkleTreeId::PUBLIC_DATA_TREE, PUBLIC_DATA_TREE_HEIGHT },
+        { MerkleTreeId::L1_TO_L2_MESSAGE_TREE, L1_TO_L2_MSG_TREE_HEIGHT },
+        { MerkleTreeId::ARCHIVE, ARCHIVE_HEIGHT },
+    };
+    std::unordered_map<MerkleTreeId, crypto::merkle_tree::index_t> tree_prefill{
+        { MerkleTreeId::NULLIFIER_TREE, 128 },
+        { MerkleTreeId::PUBLIC_DATA_TREE, 128 },
+    };
+    std::unique_ptr<WorldState> ws;
+    NiceMock<MockContractDB> contract_db;
+};
+
+TEST_F(AvmSimAPIBlockTest, IndependentTransactionsMatchSequentialSimulation)
+{
+    std::vector<Tx> txs;
+    for (size_t i = 0; i < 4; ++i) {
+        txs.push_back(make_tx(i, /*slot=*/FF(10 + i), /*increment=*/FF(5), /*nullifier=*/FF(0xbbbb0000 + i)));
+    }
+
+    auto results = simulate_both_ways(txs);
+
+    for (const auto& result : results) {
+        EXPECT_EQ(result.revert_code, RevertCode::OK);
+        EXPECT_EQ(returned_value(result), FF(0));
+    }
+}
+
+TEST_F(AvmSimAPIBlockTest, TransactionsWritingTheSameSlotMatchSequentialSimulation)
+{
+    const std::vector<Tx> txs = {
+        make_tx(0, /*slot=*/FF(10), /*increment=*/FF(5), /*nullifier=*/FF(0xbbbb0000)),
+        make_tx(1, /*slot=*/FF(11), /*increment=*/FF(7), /*nullifier=*/FF(0xbbbb0001)),
+        make_tx(2, /*slot=*/FF(10), /*increment=*/FF(3), /*nullifier=*/FF(0xbbbb0002)),
+        make_tx(3, /*slot=*/FF(10), /*increment=*/FF(1), /*nullifier=*/FF(0xbbbb0003)),
+    };
+
+    auto results = simulate_both_ways(txs);
+
+    // The later transactions see the values written by the earlier ones.
+    EXPECT_EQ(returned_value(results[0]), FF(0));
+    EXPECT_EQ(returned_value(results[1]), FF(0));
+    EXPECT_EQ(returned_value(results[2]), FF(5));
+    EXPECT_EQ(returned_value(results[3]), FF(8));
+}
+
+TEST_F(AvmSimAPIBlockTest, TransactionsEmittingTheSameNullifierMatchSequentialSimulation)
+{
+    const std::vector<Tx> txs = {
+        make_tx(0, /*slot=*/FF(10), /*increment=*/FF(5), /*nullifier=*/FF(0xbbbb0000)),
+        make_tx(1, /*slot=*/FF(11), /*increment=*/FF(7), /*nullifier=*/FF(0xbbbb0001)),
+        make_tx(2, /*slot=*/FF(12), /*increment=*/FF(3), /*nullifier=*/FF(0xbbbb0000)),
+    };
+
+    auto results = simulate_both_ways(txs);
+
+    // The nullifier already exists when the last transaction emits it.
+    EXPECT_EQ(results[0].revert_code, RevertCode::OK);
+    EXPECT_EQ(results[1].revert_code, RevertCode::OK);
+    EXPECT_NE(results[2].revert_code, RevertCode::OK);
+}
+
+} // namespace
+} // namespace bb::avm2
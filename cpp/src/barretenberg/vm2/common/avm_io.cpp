@@ -133,6 +133,13 @@ AvmFastSimulationInputs AvmFastSimulationInputs::from(const std::vector<uint8_t>
     return inputs;
 }
 
+AvmFastBlockSimulationInputs AvmFastBlockSimulationInputs::from(const std::vector<uint8_t>& data)
+{
+    AvmFastBlockSimulationInputs inputs;
+    msgpack::unpack(reinterpret_cast<const char*>(data.data()), data.size()).get().convert(inputs);
+    return inputs;
+}
+
 /////////////////////////////////////////////////////////
 /// Serialization to columns
 /////////////////////////////////////////////////////////
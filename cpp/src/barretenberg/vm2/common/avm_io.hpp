@@ -457,6 +457,20 @@ struct AvmFastSimulationInputs {
     MSGPACK_CAMEL_CASE_FIELDS(ws_revision, config, tx, global_variables, protocol_contracts);
 };
 
+// The transactions of a block, simulated in order on top of the same world state revision.
+struct AvmFastBlockSimulationInputs {
+    world_state::WorldStateRevision ws_revision;
+    PublicSimulatorConfig config;
+    std::vector<Tx> txs;
+    GlobalVariables global_variables;
+    ProtocolContracts protocol_contracts;
+
+    static AvmFastBlockSimulationInputs from(const std::vector<uint8_t>& data);
+    bool operator==(const AvmFastBlockSimulationInputs& other) const = default;
+
+    MSGPACK_CAMEL_CASE_FIELDS(ws_revision, config, txs, global_variables, protocol_contracts);
+};
+
 ////////////////////////////////////////////////////////////////////////////
 // Tx Simulation Result
 ////////////////////////////////////////////////////////////////////////////
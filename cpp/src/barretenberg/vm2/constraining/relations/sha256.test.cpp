@@ -3,13 +3,13 @@
 
 #include <cstdint>
 
+#include "barretenberg/crypto/sha256/sha256.hpp"
 #include "barretenberg/vm2/constraining/flavor_settings.hpp"
 #include "barretenberg/vm2/constraining/testing/check_relation.hpp"
 #include "barretenberg/vm2/generated/relations/lookups_sha256.hpp"
 #include "barretenberg/vm2/generated/relations/sha256.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/gadgets/memory.hpp"
-#include "barretenberg/vm2/simulation/lib/sha256_compression.hpp"
 #include "barretenberg/vm2/simulation/standalone/pure_bitwise.hpp"
 #include "barretenberg/vm2/simulation/standalone/pure_gt.hpp"
 #include "barretenberg/vm2/simulation/standalone/pure_memory.hpp"
@@ -632,7 +632,7 @@ TEST(Sha256MemoryConstrainingTest, Complex)
     }
 
     // Compute the expected output and set it in memory
-    std::array<uint32_t, 8> expected_output = simulation::sha256_block(state, input);
+    std::array<uint32_t, 8> expected_output = crypto::sha256_block(state, input);
     for (uint32_t i = 0; i < expected_output.size(); ++i) {
         mem.set(output_addr + i, MemoryValue::from<uint32_t>(expected_output[i]));
         trace.set(i + state.size() + input.size(),
@@ -12,6 +12,7 @@
 #include "barretenberg/vm2/common/to_radix.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/events/execution_event.hpp"
+#include "barretenberg/vm2/simulation/events/sha256_event.hpp"
 #include "barretenberg/vm2/simulation/gadgets/context.hpp"
 #include "barretenberg/vm2/simulation/gadgets/context_provider.hpp"
 #include "barretenberg/vm2/simulation/gadgets/gas_tracker.hpp"
@@ -1198,6 +1199,22 @@ TEST_F(ExecutionSimulationTest, Sha256Compression)
     execution.sha256_compression(context, dst_address, state_address, input_address);
 }
 
+TEST_F(ExecutionSimulationTest, Sha256CompressionError)
+{
+    MemoryAddress state_address = 10;
+    MemoryAddress input_address = 20;
+    MemoryAddress dst_address = 50;
+
+    EXPECT_CALL(context, get_memory);
+    EXPECT_CALL(gas_tracker, consume_gas(Gas{ 0, 0 }));
+    EXPECT_CALL(sha256, compression(_, state_address, input_address, dst_address))
+        .WillOnce(Throw(Sha256CompressionException("Invalid tag for sha256 input values.")));
+
+    // A failing compression is an exceptional halt of the opcode, not an unhandled error
+    EXPECT_THROW(execution.sha256_compression(context, dst_address, state_address, input_address),
+                 OpcodeExecutionException);
+}
+
 } // namespace
 
 } // namespace bb::avm2::simulation
@@ -16,6 +16,7 @@
 #include "barretenberg/vm2/simulation/gadgets/keccakf1600.hpp"
 #include "barretenberg/vm2/simulation/gadgets/range_check.hpp"
 #include "barretenberg/vm2/simulation/lib/execution_id_manager.hpp"
+#include "barretenberg/vm2/simulation/standalone/pure_keccakf1600.hpp"
 #include "barretenberg/vm2/simulation/standalone/pure_memory.hpp"
 #include "barretenberg/vm2/testing/macros.hpp"
 
@@ -225,5 +226,36 @@ TEST_F(KeccakSimulationTest, dstSliceOutOfBounds)
     EXPECT_THROW_WITH_MESSAGE(keccak.permutation(memory, dst_addr, src_addr), "Write slice out of range");
 }
 
+TEST_F(KeccakSimulationTest, pureMatchesGadget)
+{
+    const MemoryAddress src_addr = 1979;
+    const MemoryAddress dst_addr = 3030;
+    const MemoryAddress pure_dst_addr = 4040;
+
+    for (size_t i = 0; i < AVM_KECCAKF1600_STATE_SIZE; i++) {
+        memory.set(src_addr + static_cast<MemoryAddress>(i), MemoryValue::from<uint64_t>((i * i) + 187));
+    }
+
+    PureKeccakF1600 pure_keccak;
+    keccak.permutation(memory, dst_addr, src_addr);
+    pure_keccak.permutation(memory, pure_dst_addr, src_addr);
+
+    for (size_t i = 0; i < AVM_KECCAKF1600_STATE_SIZE; i++) {
+        EXPECT_EQ(memory.get(pure_dst_addr + static_cast<MemoryAddress>(i)).as<uint64_t>(),
+                  memory.get(dst_addr + static_cast<MemoryAddress>(i)).as<uint64_t>());
+    }
+
+    // Same errors as the gadget
+    memory.set(src_addr + 9, MemoryValue::from_tag_truncating(MemoryTag::U128, 0));
+    EXPECT_THROW_WITH_MESSAGE(pure_keccak.permutation(memory, pure_dst_addr, src_addr),
+                              format("Read slice tag invalid - addr: ",
+                                     src_addr + 9,
+                                     " tag: ",
+                                     static_cast<uint32_t>(MemoryTag::U128)));
+    EXPECT_THROW_WITH_MESSAGE(
+        pure_keccak.permutation(memory, AVM_HIGHEST_MEM_ADDRESS - AVM_KECCAKF1600_STATE_SIZE + 2, src_addr),
+        "Write slice out of range");
+}
+
 } // namespace
 } // namespace bb::avm2::simulation
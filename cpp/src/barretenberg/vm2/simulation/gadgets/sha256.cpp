@@ -6,8 +6,6 @@
 #include <memory>
 #include <stdexcept>
 
-#include "barretenberg/vm2/simulation/lib/sha256_compression.hpp"
-
 namespace bb::avm2::simulation {
 
 namespace {
@@ -105,7 +103,7 @@ void Sha256::compression(MemoryInterface& memory,
 
     try {
         if (state_addr_out_of_range || input_addr_out_of_range || output_addr_out_of_range) {
-            throw std::runtime_error("Memory address out of range for sha256 compression.");
+            throw Sha256CompressionException("Memory address out of range for sha256 compression.");
         }
 
         // Read the hash state from memory. The state needs to be loaded atomically from memory (i.e. all 8 elements are
@@ -116,7 +114,7 @@ void Sha256::compression(MemoryInterface& memory,
 
         // If any of the state values are not of tag U32, we throw an error.
         if (std::ranges::any_of(state, [](const MemoryValue& val) { return val.get_tag() != MemoryTag::U32; })) {
-            throw std::runtime_error("Invalid tag for sha256 state values.");
+            throw Sha256CompressionException("Invalid tag for sha256 state values.");
         }
 
         // Load 16 elements representing the hash input from memory.
@@ -124,11 +122,11 @@ void Sha256::compression(MemoryInterface& memory,
         for (uint32_t i = 0; i < 16; ++i) {
             input.emplace_back(memory.get(input_addr + i));
             if (input[i].get_tag() != MemoryTag::U32) {
-                throw std::runtime_error("Invalid tag for sha256 input values.");
+                throw Sha256CompressionException("Invalid tag for sha256 input values.");
             }
         }
 
-        // Perform sha256 compression. Taken from `vm2/simulation/lib/sha256_compression.cpp` but using
+        // Perform sha256 compression. Taken from `crypto/sha256/sha256.cpp` but using
         // the bitwise operations and MemoryValues
         std::array<MemoryValue, 64> w;
 
@@ -4,14 +4,16 @@
 #include <gtest/gtest.h>
 
 #include "barretenberg/crypto/merkle_tree/memory_store.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/vm2/common/aztec_constants.hpp"
 #include "barretenberg/vm2/common/memory_types.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/events/memory_event.hpp"
 #include "barretenberg/vm2/simulation/gadgets/memory.hpp"
-#include "barretenberg/vm2/simulation/lib/sha256_compression.hpp"
 #include "barretenberg/vm2/simulation/standalone/pure_bitwise.hpp"
 #include "barretenberg/vm2/simulation/standalone/pure_gt.hpp"
 #include "barretenberg/vm2/simulation/standalone/pure_memory.hpp"
+#include "barretenberg/vm2/simulation/standalone/pure_sha256.hpp"
 #include "barretenberg/vm2/simulation/testing/mock_execution_id_manager.hpp"
 
 namespace bb::avm2::simulation {
@@ -50,7 +52,7 @@ TEST(Sha256CompressionSimulationTest, Sha256Compression)
 
     sha256.compression(mem, state_addr, input_addr, dst_addr);
 
-    auto result = sha256_block(state, input);
+    auto result = crypto::sha256_block(state, input);
 
     std::array<uint32_t, 8> result_from_memory;
     for (uint32_t i = 0; i < 8; ++i) {
@@ -60,5 +62,42 @@ TEST(Sha256CompressionSimulationTest, Sha256Compression)
     EXPECT_EQ(result_from_memory, result);
 }
 
+TEST(Sha256CompressionSimulationTest, PureSha256Compression)
+{
+    MemoryStore mem;
+    PureSha256 sha256;
+
+    std::array<uint32_t, 8> state = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                      0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+    MemoryAddress state_addr = 0;
+    for (uint32_t i = 0; i < 8; ++i) {
+        mem.set(state_addr + i, MemoryValue::from<uint32_t>(state[i]));
+    }
+
+    std::array<uint32_t, 16> input = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+    MemoryAddress input_addr = 8;
+    for (uint32_t i = 0; i < 16; ++i) {
+        mem.set(input_addr + i, MemoryValue::from<uint32_t>(input[i]));
+    }
+    MemoryAddress dst_addr = 25;
+
+    sha256.compression(mem, state_addr, input_addr, dst_addr);
+
+    auto result = crypto::sha256_block(state, input);
+
+    std::array<uint32_t, 8> result_from_memory;
+    for (uint32_t i = 0; i < 8; ++i) {
+        auto c = mem.get(dst_addr + i);
+        result_from_memory[i] = c.as<uint32_t>();
+    }
+    EXPECT_EQ(result_from_memory, result);
+
+    // Same errors as the gadget
+    mem.set(input_addr + 3, MemoryValue::from<uint64_t>(3));
+    EXPECT_THROW(sha256.compression(mem, state_addr, input_addr, dst_addr), Sha256CompressionException);
+    EXPECT_THROW(sha256.compression(mem, state_addr, input_addr, AVM_HIGHEST_MEM_ADDRESS - 6),
+                 Sha256CompressionException);
+}
+
 } // namespace
 } // namespace bb::avm2::simulation
@@ -0,0 +1,349 @@
+#include "barretenberg/vm2/simulation/lib/speculative_dbs.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/vm2/common/aztec_constants.hpp"
+#include "barretenberg/vm2/common/aztec_types.hpp"
+#include "barretenberg/vm2/simulation/lib/merkle.hpp"
+#include "barretenberg/vm2/simulation/interfaces/db.hpp"
+
+namespace bb::avm2::simulation {
+namespace {
+
+bool emits_nullifier(const Tx& tx, const FF& siloed_nullifier)
+{
+    const auto emits = [&](const std::vector<FF>& nullifiers) {
+        return std::ranges::find(nullifiers, siloed_nullifier) != nullifiers.end();
+    };
+    return emits(tx.non_revertible_accumulated_data.nullifiers) || emits(tx.revertible_accumulated_data.nullifiers);
+}
+
+// The deployment data carries every private log of the transaction, most of which are not deployments. A
+// ContractInstancePublished event is told apart by the nullifier the instance registry emits alongside it: the
+// instance address, the second field of the event, siloed with the registry address. This is the nullifier
+// ContractInstanceManager checks to decide whether an instance exists.
+bool publishes_contract_instance(const PrivateLog& log, const Tx& tx)
+{
+    if (log.fields.size() < 2) {
+        return false;
+    }
+    const FF instance_nullifier =
+        unconstrained_silo_nullifier(CONTRACT_INSTANCE_REGISTRY_CONTRACT_ADDRESS, /*nullifier=*/log.fields[1]);
+    return emits_nullifier(tx, instance_nullifier);
+}
+
+bool has_deployments(const ContractDeploymentData& contract_deployment_data, const Tx& tx)
+{
+    return !contract_deployment_data.contract_class_logs.empty() ||
+           std::ranges::any_of(contract_deployment_data.private_logs,
+                               [&](const PrivateLog& log) { return publishes_contract_instance(log, tx); });
+}
+
+} // namespace
+
+// StateAccesses starts.
+bool StateAccesses::conflicts_with(const StateAccesses& earlier) const
+{
+    if (requires_reexecution) {
+        return true;
+    }
+    if ((reads_pending_note_hashes && earlier.appends_note_hashes) ||
+        (reads_missing_contracts && earlier.adds_contracts)) {
+        return true;
+    }
+    for (const FF& slot : public_data_slots_read) {
+        if (earlier.public_data_slots_written.contains(slot)) {
+            return true;
+        }
+    }
+    for (const FF& nullifier : nullifiers_read) {
+        if (earlier.nullifiers_written.contains(nullifier)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void StateAccesses::add_writes(const StateAccesses& other)
+{
+    public_data_slots_written.insert(other.public_data_slots_written.begin(), other.public_data_slots_written.end());
+    nullifiers_written.insert(other.nullifiers_written.begin(), other.nullifiers_written.end());
+    appends_note_hashes = appends_note_hashes || other.appends_note_hashes;
+    adds_contracts = adds_contracts || other.adds_contracts;
+}
+
+// SpeculativeRawMerkleDB starts.
+SpeculativeRawMerkleDB::SpeculativeRawMerkleDB(const LowLevelMerkleDBInterface& db)
+    : db(db)
+    , starting_note_hash_tree_size(db.get_tree_roots().note_hash_tree.next_available_leaf_index)
+{}
+
+SiblingPath SpeculativeRawMerkleDB::get_sibling_path(MerkleTreeId tree_id, index_t leaf_index) const
+{
+    // The path would not reflect the writes of the transaction.
+    accesses.requires_reexecution = true;
+    return db.get_sibling_path(tree_id, leaf_index);
+}
+
+GetLowIndexedLeafResponse SpeculativeRawMerkleDB::get_low_indexed_leaf(MerkleTreeId tree_id, const FF& value) const
+{
+    const Overlay& overlay = overlays.top();
+    switch (tree_id) {
+    case MerkleTreeId::PUBLIC_DATA_TREE: {
+        auto it = overlay.public_data_slot_to_index.find(value);
+        if (it != overlay.public_data_slot_to_index.end()) {
+            return { true, SPECULATIVE_INDEX_OFFSET + it->second };
+        }
+        accesses.public_data_slots_read.insert(value);
+        break;
+    }
+    case MerkleTreeId::NULLIFIER_TREE: {
+        auto it = overlay.nullifier_to_index.find(value);
+        if (it != overlay.nullifier_to_index.end()) {
+            return { true, SPECULATIVE_INDEX_OFFSET + it->second };
+        }
+        accesses.nullifiers_read.insert(value);
+        break;
+    }
+    default:
+        break;
+    }
+    // Either the value or its low leaf in the underlying db. The low leaf of a value that is not present is only used
+    // for its position, which is not meaningful here but doesn't affect the outcome of the simulation.
+    return db.get_low_indexed_leaf(tree_id, value);
+}
+
+FF SpeculativeRawMerkleDB::get_leaf_value(MerkleTreeId tree_id, index_t leaf_index) const
+{
+    if (tree_id == MerkleTreeId::NOTE_HASH_TREE && leaf_index >= starting_note_hash_tree_size) {
+        accesses.reads_pending_note_hashes = true;
+        const std::vector<FF>& note_hashes = overlays.top().note_hashes;
+        if (leaf_index - starting_note_hash_tree_size < note_hashes.size()) {
+            return note_hashes[leaf_index - starting_note_hash_tree_size];
+        }
+    }
+    return db.get_leaf_value(tree_id, leaf_index);
+}
+
+IndexedLeaf<PublicDataLeafValue> SpeculativeRawMerkleDB::get_leaf_preimage_public_data_tree(index_t leaf_index) const
+{
+    if (leaf_index < SPECULATIVE_INDEX_OFFSET) {
+        return db.get_leaf_preimage_public_data_tree(leaf_index);
+    }
+    const std::vector<PublicDataLeafValue>& leaves = overlays.top().public_data_leaves;
+    if (leaf_index - SPECULATIVE_INDEX_OFFSET >= leaves.size()) {
+        throw std::runtime_error(format("Invalid get_leaf_preimage_public_data_tree request for index ", leaf_index));
+    }
+    // Only the leaf itself is tracked, not its position in the tree.
+    return IndexedLeaf<PublicDataLeafValue>(leaves[leaf_index - SPECULATIVE_INDEX_OFFSET], 0, 0);
+}
+
+IndexedLeaf<NullifierLeafValue> SpeculativeRawMerkleDB::get_leaf_preimage_nullifier_tree(index_t leaf_index) const
+{
+    if (leaf_index < SPECULATIVE_INDEX_OFFSET) {
+        return db.get_leaf_preimage_nullifier_tree(leaf_index);
+    }
+    const std::vector<FF>& nullifiers = overlays.top().nullifiers;
+    if (leaf_index - SPECULATIVE_INDEX_OFFSET >= nullifiers.size()) {
+        throw std::runtime_error(format("Invalid get_leaf_preimage_nullifier_tree request for index ", leaf_index));
+    }
+    return IndexedLeaf<NullifierLeafValue>(NullifierLeafValue(nullifiers[leaf_index - SPECULATIVE_INDEX_OFFSET]), 0, 0);
+}
+
+SequentialInsertionResult<PublicDataLeafValue> SpeculativeRawMerkleDB::insert_indexed_leaves_public_data_tree(
+    const PublicDataLeafValue& leaf_value)
+{
+    Overlay& overlay = overlays.top();
+    auto [it, inserted] = overlay.public_data_slot_to_index.try_emplace(leaf_value.slot,
+                                                                        overlay.public_data_leaves.size());
+    if (inserted) {
+        overlay.public_data_leaves.push_back(leaf_value);
+    } else {
+        overlay.public_data_leaves[it->second] = leaf_value;
+    }
+    accesses.public_data_slots_written.insert(leaf_value.slot);
+    writes.emplace_back(PublicDataWrite{ leaf_value });
+    return {};
+}
+
+SequentialInsertionResult<NullifierLeafValue> SpeculativeRawMerkleDB::insert_indexed_leaves_nullifier_tree(
+    const NullifierLeafValue& leaf_value)
+{
+    Overlay& overlay = overlays.top();
+    if (overlay.nullifier_to_index.try_emplace(leaf_value.nullifier, overlay.nullifiers.size()).second) {
+        overlay.nullifiers.push_back(leaf_value.nullifier);
+    }
+    accesses.nullifiers_written.insert(leaf_value.nullifier);
+    writes.emplace_back(NullifierWrite{ leaf_value });
+    return {};
+}
+
+std::vector<AppendLeafResult> SpeculativeRawMerkleDB::append_leaves(MerkleTreeId tree_id, std::span<const FF> leaves)
+{
+    if (tree_id == MerkleTreeId::NOTE_HASH_TREE) {
+        std::vector<FF>& note_hashes = overlays.top().note_hashes;
+        note_hashes.insert(note_hashes.end(), leaves.begin(), leaves.end());
+        accesses.appends_note_hashes = true;
+    } else {
+        // Reads of the other append-only trees don't reflect the transaction's writes.
+        accesses.requires_reexecution = true;
+    }
+    writes.emplace_back(AppendLeaves{ tree_id, std::vector<FF>(leaves.begin(), leaves.end()) });
+    return {};
+}
+
+void SpeculativeRawMerkleDB::pad_tree(MerkleTreeId tree_id, size_t num_leaves)
+{
+    switch (tree_id) {
+    case MerkleTreeId::NULLIFIER_TREE:
+        // Padding leaves are empty, they can't be found by value.
+        break;
+    case MerkleTreeId::NOTE_HASH_TREE: {
+        std::vector<FF>& note_hashes = overlays.top().note_hashes;
+        note_hashes.resize(note_hashes.size() + num_leaves, FF(0));
+        accesses.appends_note_hashes = accesses.appends_note_hashes || num_leaves > 0;
+        break;
+    }
+    default:
+        throw std::runtime_error("Padding not supported for tree " + std::to_string(static_cast<uint64_t>(tree_id)));
+    }
+    writes.emplace_back(PadTree{ tree_id, num_leaves });
+}
+
+void SpeculativeRawMerkleDB::create_checkpoint()
+{
+    overlays.push(overlays.top());
+    checkpoint_ids.push(checkpoint_ids.top() + 1);
+    writes.emplace_back(CheckpointOperation::CREATE);
+}
+
+void SpeculativeRawMerkleDB::commit_checkpoint()
+{
+    Overlay current = std::move(overlays.top());
+    overlays.pop();
+    overlays.top() = std::move(current);
+    checkpoint_ids.pop();
+    writes.emplace_back(CheckpointOperation::COMMIT);
+}
+
+void SpeculativeRawMerkleDB::revert_checkpoint()
+{
+    overlays.pop();
+    checkpoint_ids.pop();
+    writes.emplace_back(CheckpointOperation::REVERT);
+}
+
+void SpeculativeRawMerkleDB::replay(LowLevelMerkleDBInterface& target) const
+{
+    for (const Write& write : writes) {
+        std::visit(
+            [&target](const auto& op) {
+                using Op = std::decay_t<decltype(op)>;
+                if constexpr (std::is_same_v<Op, PublicDataWrite>) {
+                    target.insert_indexed_leaves_public_data_tree(op.leaf);
+                } else if constexpr (std::is_same_v<Op, NullifierWrite>) {
+                    target.insert_indexed_leaves_nullifier_tree(op.leaf);
+                } else if constexpr (std::is_same_v<Op, AppendLeaves>) {
+                    target.append_leaves(op.tree_id, op.leaves);
+                } else if constexpr (std::is_same_v<Op, PadTree>) {
+                    target.pad_tree(op.tree_id, op.num_leaves);
+                } else if (op == CheckpointOperation::CREATE) {
+                    target.create_checkpoint();
+                } else if (op == CheckpointOperation::COMMIT) {
+                    target.commit_checkpoint();
+                } else {
+                    target.revert_checkpoint();
+                }
+            },
+            write);
+    }
+}
+
+// WriteTrackingRawMerkleDB starts.
+SequentialInsertionResult<PublicDataLeafValue> WriteTrackingRawMerkleDB::insert_indexed_leaves_public_data_tree(
+    const PublicDataLeafValue& leaf_value)
+{
+    writes.public_data_slots_written.insert(leaf_value.slot);
+    return db.insert_indexed_leaves_public_data_tree(leaf_value);
+}
+
+SequentialInsertionResult<NullifierLeafValue> WriteTrackingRawMerkleDB::insert_indexed_leaves_nullifier_tree(
+    const NullifierLeafValue& leaf_value)
+{
+    writes.nullifiers_written.insert(leaf_value.nullifier);
+    return db.insert_indexed_leaves_nullifier_tree(leaf_value);
+}
+
+std::vector<AppendLeafResult> WriteTrackingRawMerkleDB::append_leaves(MerkleTreeId tree_id, std::span<const FF> leaves)
+{
+    writes.appends_note_hashes = writes.appends_note_hashes || tree_id == MerkleTreeId::NOTE_HASH_TREE;
+    return db.append_leaves(tree_id, leaves);
+}
+
+void WriteTrackingRawMerkleDB::pad_tree(MerkleTreeId tree_id, size_t num_leaves)
+{
+    writes.appends_note_hashes =
+        writes.appends_note_hashes || (tree_id == MerkleTreeId::NOTE_HASH_TREE && num_leaves > 0);
+    db.pad_tree(tree_id, num_leaves);
+}
+
+// SpeculativeContractDB starts.
+std::optional<ContractInstance> SpeculativeContractDB::get_contract_instance(const AztecAddress& address) const
+{
+    std::lock_guard<std::mutex> lock(db_mutex);
+    std::optional<ContractInstance> instance = db.get_contract_instance(address);
+    reads_missing_contracts = reads_missing_contracts || !instance.has_value();
+    return instance;
+}
+
+std::optional<ContractClass> SpeculativeContractDB::get_contract_class(const ContractClassId& class_id) const
+{
+    std::lock_guard<std::mutex> lock(db_mutex);
+    std::optional<ContractClass> klass = db.get_contract_class(class_id);
+    reads_missing_contracts = reads_missing_contracts || !klass.has_value();
+    return klass;
+}
+
+std::optional<FF> SpeculativeContractDB::get_bytecode_commitment(const ContractClassId& class_id) const
+{
+    std::lock_guard<std::mutex> lock(db_mutex);
+    std::optional<FF> commitment = db.get_bytecode_commitment(class_id);
+    reads_missing_contracts = reads_missing_contracts || !commitment.has_value();
+    return commitment;
+}
+
+std::optional<std::string> SpeculativeContractDB::get_debug_function_name(const AztecAddress& address,
+                                                                          const FunctionSelector& selector) const
+{
+    std::lock_guard<std::mutex> lock(db_mutex);
+    return db.get_debug_function_name(address, selector);
+}
+
+void SpeculativeContractDB::add_contracts(const ContractDeploymentData& contract_deployment_data)
+{
+    // The deployed contracts can't be made visible to the transaction without writing them to the shared db.
+    adds_contracts = adds_contracts || has_deployments(contract_deployment_data, tx);
+}
+
+void SpeculativeContractDB::add_accesses_to(StateAccesses& merkle_accesses) const
+{
+    merkle_accesses.reads_missing_contracts = merkle_accesses.reads_missing_contracts || reads_missing_contracts;
+    merkle_accesses.adds_contracts = merkle_accesses.adds_contracts || adds_contracts;
+    merkle_accesses.requires_reexecution = merkle_accesses.requires_reexecution || adds_contracts;
+}
+
+bool deploys_contracts(const Tx& tx)
+{
+    return has_deployments(tx.non_revertible_contract_deployment_data, tx) ||
+           has_deployments(tx.revertible_contract_deployment_data, tx);
+}
+
+} // namespace bb::avm2::simulation
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <stack>
+#include <variant>
+#include <vector>
+
+#include "barretenberg/vm2/common/avm_io.hpp"
+#include "barretenberg/vm2/common/aztec_types.hpp"
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/common/map.hpp"
+#include "barretenberg/vm2/common/set.hpp"
+#include "barretenberg/vm2/simulation/interfaces/db.hpp"
+
+namespace bb::avm2::simulation {
+
+// The state a transaction read from, and wrote to, the state it was speculatively simulated on.
+struct StateAccesses {
+    // Reads.
+    unordered_flat_set<FF> public_data_slots_read;
+    unordered_flat_set<FF> nullifiers_read;
+    // Whether a note hash appended after the start of the simulation was read (by leaf index).
+    bool reads_pending_note_hashes = false;
+    // Whether a contract instance or class was looked up and not found.
+    bool reads_missing_contracts = false;
+    // Whether a read was made that can't be answered speculatively the way the underlying db would answer it.
+    bool requires_reexecution = false;
+
+    // Writes.
+    unordered_flat_set<FF> public_data_slots_written;
+    unordered_flat_set<FF> nullifiers_written;
+    bool appends_note_hashes = false;
+    bool adds_contracts = false;
+
+    // Whether the reads could have had a different result had the writes of `earlier` been applied first.
+    bool conflicts_with(const StateAccesses& earlier) const;
+    void add_writes(const StateAccesses& other);
+};
+
+// A raw merkle db that simulates a transaction on top of another db without modifying it.
+// - Reads not served by the writes of the transaction itself are forwarded to the underlying db and recorded.
+// - Writes (and checkpoint operations) are logged, so that they can be applied to the underlying db later with
+//   replay(). Replaying them in block order results in the same state as simulating the transactions in order.
+// Only the queries made by fast (pure) simulation are supported: tree roots and sibling paths are those of the
+// underlying db, and insertions return no witness data.
+class SpeculativeRawMerkleDB final : public LowLevelMerkleDBInterface {
+  public:
+    SpeculativeRawMerkleDB(const LowLevelMerkleDBInterface& db);
+
+    TreeSnapshots get_tree_roots() const override { return db.get_tree_roots(); }
+
+    // Query methods.
+    SiblingPath get_sibling_path(MerkleTreeId tree_id, index_t leaf_index) const override;
+    GetLowIndexedLeafResponse get_low_indexed_leaf(MerkleTreeId tree_id, const FF& value) const override;
+    FF get_leaf_value(MerkleTreeId tree_id, index_t leaf_index) const override;
+    IndexedLeaf<PublicDataLeafValue> get_leaf_preimage_public_data_tree(index_t leaf_index) const override;
+    IndexedLeaf<NullifierLeafValue> get_leaf_preimage_nullifier_tree(index_t leaf_index) const override;
+
+    // State modification methods.
+    SequentialInsertionResult<PublicDataLeafValue> insert_indexed_leaves_public_data_tree(
+        const PublicDataLeafValue& leaf_value) override;
+    SequentialInsertionResult<NullifierLeafValue> insert_indexed_leaves_nullifier_tree(
+        const NullifierLeafValue& leaf_value) override;
+    std::vector<AppendLeafResult> append_leaves(MerkleTreeId tree_id, std::span<const FF> leaves) override;
+    void pad_tree(MerkleTreeId tree_id, size_t num_leaves) override;
+
+    void create_checkpoint() override;
+    void commit_checkpoint() override;
+    void revert_checkpoint() override;
+    uint32_t get_checkpoint_id() const override { return checkpoint_ids.top(); }
+
+    const StateAccesses& get_accesses() const { return accesses; }
+    // Applies the logged writes, in order, to the given db.
+    void replay(LowLevelMerkleDBInterface& target) const;
+
+  private:
+    struct PublicDataWrite {
+        PublicDataLeafValue leaf;
+    };
+    struct NullifierWrite {
+        NullifierLeafValue leaf;
+    };
+    struct AppendLeaves {
+        MerkleTreeId tree_id;
+        std::vector<FF> leaves;
+    };
+    struct PadTree {
+        MerkleTreeId tree_id;
+        size_t num_leaves;
+    };
+    enum class CheckpointOperation : uint8_t { CREATE, COMMIT, REVERT };
+    using Write = std::variant<PublicDataWrite, NullifierWrite, AppendLeaves, PadTree, CheckpointOperation>;
+
+    // The writes visible at a checkpoint. Leaves written by the transaction are given indices starting at
+    // SPECULATIVE_INDEX_OFFSET, which no tree reaches.
+    struct Overlay {
+        std::vector<PublicDataLeafValue> public_data_leaves;
+        unordered_flat_map<FF, index_t> public_data_slot_to_index;
+        std::vector<FF> nullifiers;
+        unordered_flat_map<FF, index_t> nullifier_to_index;
+        std::vector<FF> note_hashes;
+    };
+    static constexpr index_t SPECULATIVE_INDEX_OFFSET = index_t(1) << 62;
+
+    const LowLevelMerkleDBInterface& db;
+    index_t starting_note_hash_tree_size;
+
+    std::stack<Overlay> overlays{ { Overlay{} } };
+    std::stack<uint32_t> checkpoint_ids{ { 0 } };
+    std::vector<Write> writes;
+    mutable StateAccesses accesses;
+};
+
+// A raw merkle db forwarding everything to another db, recording the keys written.
+class WriteTrackingRawMerkleDB final : public LowLevelMerkleDBInterface {
+  public:
+    WriteTrackingRawMerkleDB(LowLevelMerkleDBInterface& db)
+        : db(db)
+    {}
+
+    TreeSnapshots get_tree_roots() const override { return db.get_tree_roots(); }
+
+    // Query methods.
+    SiblingPath get_sibling_path(MerkleTreeId tree_id, index_t leaf_index) const override
+    {
+        return db.get_sibling_path(tree_id, leaf_index);
+    }
+    GetLowIndexedLeafResponse get_low_indexed_leaf(MerkleTreeId tree_id, const FF& value) const override
+    {
+        return db.get_low_indexed_leaf(tree_id, value);
+    }
+    FF get_leaf_value(MerkleTreeId tree_id, index_t leaf_index) const override
+    {
+        return db.get_leaf_value(tree_id, leaf_index);
+    }
+    IndexedLeaf<PublicDataLeafValue> get_leaf_preimage_public_data_tree(index_t leaf_index) const override
+    {
+        return db.get_leaf_preimage_public_data_tree(leaf_index);
+    }
+    IndexedLeaf<NullifierLeafValue> get_leaf_preimage_nullifier_tree(index_t leaf_index) const override
+    {
+        return db.get_leaf_preimage_nullifier_tree(leaf_index);
+    }
+
+    // State modification methods.
+    SequentialInsertionResult<PublicDataLeafValue> insert_indexed_leaves_public_data_tree(
+        const PublicDataLeafValue& leaf_value) override;
+    SequentialInsertionResult<NullifierLeafValue> insert_indexed_leaves_nullifier_tree(
+        const NullifierLeafValue& leaf_value) override;
+    std::vector<AppendLeafResult> append_leaves(MerkleTreeId tree_id, std::span<const FF> leaves) override;
+    void pad_tree(MerkleTreeId tree_id, size_t num_leaves) override;
+
+    void create_checkpoint() override { db.create_checkpoint(); }
+    void commit_checkpoint() override { db.commit_checkpoint(); }
+    void revert_checkpoint() override { db.revert_checkpoint(); }
+    uint32_t get_checkpoint_id() const override { return db.get_checkpoint_id(); }
+
+    // Only the write fields are set.
+    const StateAccesses& get_writes() const { return writes; }
+
+  private:
+    LowLevelMerkleDBInterface& db;
+    StateAccesses writes;
+};
+
+// A contract db giving concurrent speculative simulations read-only access to a shared contract db.
+// Reads are serialised by a mutex shared by all the instances reading from the same db. Contract deployments are not
+// supported: transactions deploying contracts must be simulated against the shared db directly.
+class SpeculativeContractDB final : public ContractDBInterface {
+  public:
+    SpeculativeContractDB(const ContractDBInterface& db, std::mutex& db_mutex, const Tx& tx)
+        : db(db)
+        , db_mutex(db_mutex)
+        , tx(tx)
+    {}
+
+    std::optional<ContractInstance> get_contract_instance(const AztecAddress& address) const override;
+    std::optional<ContractClass> get_contract_class(const ContractClassId& class_id) const override;
+    std::optional<FF> get_bytecode_commitment(const ContractClassId& class_id) const override;
+    std::optional<std::string> get_debug_function_name(const AztecAddress& address,
+                                                       const FunctionSelector& selector) const override;
+
+    void add_contracts(const ContractDeploymentData& contract_deployment_data) override;
+
+    // Nothing is ever written to the shared db, so there is nothing to checkpoint.
+    void create_checkpoint() override {}
+    void commit_checkpoint() override {}
+    void revert_checkpoint() override {}
+
+    // Adds the contract db accesses to those of the merkle db.
+    void add_accesses_to(StateAccesses& merkle_accesses) const;
+
+  private:
+    const ContractDBInterface& db;
+    std::mutex& db_mutex;
+    // The transaction being simulated, to tell the private logs publishing contract instances apart.
+    const Tx& tx;
+    mutable bool reads_missing_contracts = false;
+    bool adds_contracts = false;
+};
+
+// Whether the transaction deploys any contract: it publishes a contract class or a contract instance.
+bool deploys_contracts(const Tx& tx);
+
+} // namespace bb::avm2::simulation
@@ -0,0 +1,217 @@
+#include "barretenberg/vm2/simulation/lib/speculative_dbs.hpp"
+#include "barretenberg/vm2/common/aztec_constants.hpp"
+#include "barretenberg/vm2/simulation/lib/merkle.hpp"
+#include "barretenberg/vm2/simulation/testing/mock_dbs.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace bb::avm2::simulation {
+namespace {
+
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Return;
+using ::testing::StrictMock;
+
+class SpeculativeRawMerkleDBTest : public ::testing::Test {
+  protected:
+    SpeculativeRawMerkleDBTest()
+    {
+        ON_CALL(mock_merkle_db, get_tree_roots())
+            .WillByDefault(Return(TreeSnapshots{ .note_hash_tree = { .root = 1, .next_available_leaf_index = 128 } }));
+        EXPECT_CALL(mock_merkle_db, get_tree_roots()).Times(::testing::AnyNumber());
+    }
+
+    StrictMock<MockLowLevelMerkleDB> mock_merkle_db;
+};
+
+TEST_F(SpeculativeRawMerkleDBTest, ForwardsAndRecordsReads)
+{
+    SpeculativeRawMerkleDB db(mock_merkle_db);
+
+    EXPECT_CALL(mock_merkle_db, get_low_indexed_leaf(MerkleTreeId::PUBLIC_DATA_TREE, FF(10)))
+        .WillOnce(Return(GetLowIndexedLeafResponse(true, 3)));
+    EXPECT_CALL(mock_merkle_db, get_leaf_preimage_public_data_tree(3))
+        .WillOnce(Return(IndexedLeaf<PublicDataLeafValue>(PublicDataLeafValue(10, 42), 0, 0)));
+    EXPECT_CALL(mock_merkle_db, get_low_indexed_leaf(MerkleTreeId::NULLIFIER_TREE, FF(20)))
+        .WillOnce(Return(GetLowIndexedLeafResponse(false, 5)));
+    EXPECT_CALL(mock_merkle_db, get_leaf_value(MerkleTreeId::NOTE_HASH_TREE, 7)).WillOnce(Return(FF(99)));
+
+    auto [present, index] = db.get_low_indexed_leaf(MerkleTreeId::PUBLIC_DATA_TREE, 10);
+    EXPECT_TRUE(present);
+    EXPECT_EQ(db.get_leaf_preimage_public_data_tree(index).leaf.value, 42);
+    EXPECT_FALSE(db.get_low_indexed_leaf(MerkleTreeId::NULLIFIER_TREE, 20).is_already_present);
+    EXPECT_EQ(db.get_leaf_value(MerkleTreeId::NOTE_HASH_TREE, 7), 99);
+
+    const StateAccesses& accesses = db.get_accesses();
+    EXPECT_TRUE(accesses.public_data_slots_read.contains(10));
+    EXPECT_TRUE(accesses.nullifiers_read.contains(20));
+    EXPECT_FALSE(accesses.reads_pending_note_hashes);
+    EXPECT_FALSE(accesses.requires_reexecution);
+}
+
+TEST_F(SpeculativeRawMerkleDBTest, ServesItsOwnWritesWithoutWritingThrough)
+{
+    SpeculativeRawMerkleDB db(mock_merkle_db);
+
+    db.insert_indexed_leaves_public_data_tree(PublicDataLeafValue(10, 42));
+    db.insert_indexed_leaves_public_data_tree(PublicDataLeafValue(10, 43));
+    db.insert_indexed_leaves_nullifier_tree(NullifierLeafValue(20));
+    db.append_leaves(MerkleTreeId::NOTE_HASH_TREE, std::vector<FF>{ 30, 31 });
+
+    auto [present, index] = db.get_low_indexed_leaf(MerkleTreeId::PUBLIC_DATA_TREE, 10);
+    EXPECT_TRUE(present);
+    EXPECT_EQ(db.get_leaf_preimage_public_data_tree(index).leaf.value, 43);
+    EXPECT_TRUE(db.get_low_indexed_leaf(MerkleTreeId::NULLIFIER_TREE, 20).is_already_present);
+    EXPECT_EQ(db.get_leaf_value(MerkleTreeId::NOTE_HASH_TREE, 129), 31);
+
+    const StateAccesses& accesses = db.get_accesses();
+    EXPECT_TRUE(accesses.public_data_slots_read.empty());
+    EXPECT_TRUE(accesses.nullifiers_read.empty());
+    EXPECT_TRUE(accesses.public_data_slots_written.contains(10));
+    EXPECT_TRUE(accesses.nullifiers_written.contains(20));
+    EXPECT_TRUE(accesses.appends_note_hashes);
+    EXPECT_TRUE(accesses.reads_pending_note_hashes);
+}
+
+TEST_F(SpeculativeRawMerkleDBTest, CheckpointsScopeWrites)
+{
+    SpeculativeRawMerkleDB db(mock_merkle_db);
+
+    db.create_checkpoint();
+    EXPECT_EQ(db.get_checkpoint_id(), 1);
+    db.insert_indexed_leaves_nullifier_tree(NullifierLeafValue(20));
+    db.revert_checkpoint();
+    EXPECT_EQ(db.get_checkpoint_id(), 0);
+
+    db.create_checkpoint();
+    db.insert_indexed_leaves_nullifier_tree(NullifierLeafValue(21));
+    db.commit_checkpoint();
+
+    EXPECT_CALL(mock_merkle_db, get_low_indexed_leaf(MerkleTreeId::NULLIFIER_TREE, FF(20)))
+        .WillOnce(Return(GetLowIndexedLeafResponse(false, 0)));
+    EXPECT_FALSE(db.get_low_indexed_leaf(MerkleTreeId::NULLIFIER_TREE, 20).is_already_present);
+    EXPECT_TRUE(db.get_low_indexed_leaf(MerkleTreeId::NULLIFIER_TREE, 21).is_already_present);
+}
+
+TEST_F(SpeculativeRawMerkleDBTest, ReplaysWritesInOrder)
+{
+    SpeculativeRawMerkleDB db(mock_merkle_db);
+
+    db.create_checkpoint();
+    db.insert_indexed_leaves_public_data_tree(PublicDataLeafValue(10, 42));
+    db.append_leaves(MerkleTreeId::NOTE_HASH_TREE, std::vector<FF>{ 30 });
+    db.revert_checkpoint();
+    db.create_checkpoint();
+    db.insert_indexed_leaves_nullifier_tree(NullifierLeafValue(20));
+    db.commit_checkpoint();
+    db.pad_tree(MerkleTreeId::NOTE_HASH_TREE, 63);
+
+    StrictMock<MockLowLevelMerkleDB> target;
+    {
+        InSequence seq;
+        EXPECT_CALL(target, create_checkpoint());
+        EXPECT_CALL(target, insert_indexed_leaves_public_data_tree(PublicDataLeafValue(10, 42)));
+        EXPECT_CALL(target, append_leaves(MerkleTreeId::NOTE_HASH_TREE, _));
+        EXPECT_CALL(target, revert_checkpoint());
+        EXPECT_CALL(target, create_checkpoint());
+        EXPECT_CALL(target, insert_indexed_leaves_nullifier_tree(NullifierLeafValue(20)));
+        EXPECT_CALL(target, commit_checkpoint());
+        EXPECT_CALL(target, pad_tree(MerkleTreeId::NOTE_HASH_TREE, 63));
+    }
+    db.replay(target);
+}
+
+TEST(StateAccessesTest, ConflictsWithEarlierWrites)
+{
+    StateAccesses earlier;
+    earlier.public_data_slots_written.insert(10);
+    earlier.nullifiers_written.insert(20);
+    earlier.appends_note_hashes = true;
+
+    StateAccesses independent;
+    independent.public_data_slots_read.insert(11);
+    independent.nullifiers_read.insert(21);
+    independent.reads_missing_contracts = true;
+    EXPECT_FALSE(independent.conflicts_with(earlier));
+
+    StateAccesses reads_slot;
+    reads_slot.public_data_slots_read.insert(10);
+    EXPECT_TRUE(reads_slot.conflicts_with(earlier));
+
+    StateAccesses reads_nullifier;
+    reads_nullifier.nullifiers_read.insert(20);
+    EXPECT_TRUE(reads_nullifier.conflicts_with(earlier));
+
+    StateAccesses reads_note_hashes;
+    reads_note_hashes.reads_pending_note_hashes = true;
+    EXPECT_TRUE(reads_note_hashes.conflicts_with(earlier));
+
+    earlier.adds_contracts = true;
+    EXPECT_TRUE(independent.conflicts_with(earlier));
+
+    StateAccesses unsupported;
+    unsupported.requires_reexecution = true;
+    EXPECT_TRUE(unsupported.conflicts_with(StateAccesses{}));
+}
+
+TEST(DeploysContractsTest, OrdinaryPrivateLogsAreNotDeployments)
+{
+    Tx tx;
+    tx.non_revertible_contract_deployment_data.private_logs.push_back(PrivateLog{ .fields = { 1, 2, 3 } });
+    tx.revertible_contract_deployment_data.private_logs.push_back(PrivateLog{ .fields = { 4, 5 } });
+    tx.revertible_contract_deployment_data.private_logs.push_back(PrivateLog{ .fields = { 6 } });
+    tx.revertible_accumulated_data.nullifiers = { 2, 5 };
+    EXPECT_FALSE(deploys_contracts(tx));
+
+    // A transaction with only ordinary private logs is simulated speculatively, and doesn't force the transactions
+    // after it to be simulated again.
+    StrictMock<MockContractDB> mock_contract_db;
+    std::mutex db_mutex;
+    SpeculativeContractDB contract_db(mock_contract_db, db_mutex, tx);
+    contract_db.add_contracts(tx.non_revertible_contract_deployment_data);
+    contract_db.add_contracts(tx.revertible_contract_deployment_data);
+    StateAccesses accesses;
+    contract_db.add_accesses_to(accesses);
+    EXPECT_FALSE(accesses.adds_contracts);
+    EXPECT_FALSE(accesses.requires_reexecution);
+}
+
+TEST(DeploysContractsTest, PublishedInstancesAreDeployments)
+{
+    const AztecAddress instance_address = 42;
+    Tx tx;
+    tx.revertible_contract_deployment_data.private_logs.push_back(PrivateLog{ .fields = { 1, 2, 3 } });
+    tx.revertible_contract_deployment_data.private_logs.push_back(
+        PrivateLog{ .fields = { 7, instance_address, 1, 8 } });
+    EXPECT_FALSE(deploys_contracts(tx));
+
+    tx.non_revertible_accumulated_data.nullifiers = {
+        1, unconstrained_silo_nullifier(CONTRACT_INSTANCE_REGISTRY_CONTRACT_ADDRESS, instance_address)
+    };
+    EXPECT_TRUE(deploys_contracts(tx));
+
+    StrictMock<MockContractDB> mock_contract_db;
+    std::mutex db_mutex;
+    SpeculativeContractDB contract_db(mock_contract_db, db_mutex, tx);
+    contract_db.add_contracts(tx.non_revertible_contract_deployment_data);
+    StateAccesses accesses;
+    contract_db.add_accesses_to(accesses);
+    EXPECT_FALSE(accesses.adds_contracts);
+    contract_db.add_contracts(tx.revertible_contract_deployment_data);
+    contract_db.add_accesses_to(accesses);
+    EXPECT_TRUE(accesses.adds_contracts);
+    EXPECT_TRUE(accesses.requires_reexecution);
+}
+
+TEST(DeploysContractsTest, ContractClassLogsAreDeployments)
+{
+    Tx tx;
+    tx.non_revertible_contract_deployment_data.contract_class_logs.push_back(
+        ContractClassLog{ .contract_address = 3, .emitted_length = 1 });
+    EXPECT_TRUE(deploys_contracts(tx));
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
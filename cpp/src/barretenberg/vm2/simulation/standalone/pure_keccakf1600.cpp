@@ -0,0 +1,45 @@
+#include "barretenberg/vm2/simulation/standalone/pure_keccakf1600.hpp"
+
+#include <array>
+#include <cstdint>
+
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/crypto/keccak/keccak.hpp"
+#include "barretenberg/vm2/common/aztec_constants.hpp"
+#include "barretenberg/vm2/simulation/events/keccakf1600_event.hpp"
+#include "barretenberg/vm2/simulation/interfaces/memory.hpp"
+
+namespace bb::avm2::simulation {
+
+// Same checks as the KeccakF1600 gadget, with the permutation done natively.
+void PureKeccakF1600::permutation(MemoryInterface& memory, MemoryAddress dst_addr, MemoryAddress src_addr)
+{
+    constexpr MemoryAddress HIGHEST_SLICE_ADDRESS = AVM_HIGHEST_MEM_ADDRESS - AVM_KECCAKF1600_STATE_SIZE + 1;
+    if (src_addr > HIGHEST_SLICE_ADDRESS) {
+        throw KeccakF1600Exception(format("Read slice out of range: ", src_addr));
+    }
+    if (dst_addr > HIGHEST_SLICE_ADDRESS) {
+        throw KeccakF1600Exception(format("Write slice out of range: ", dst_addr));
+    }
+
+    // Memory and ethash_keccakf1600 both lay the state out as A[x][y] at index (y * 5) + x
+    std::array<uint64_t, AVM_KECCAKF1600_STATE_SIZE> state;
+    for (size_t k = 0; k < AVM_KECCAKF1600_STATE_SIZE; k++) {
+        const auto addr = src_addr + static_cast<MemoryAddress>(k);
+        const MemoryValue& mem_val = memory.get(addr);
+        const MemoryTag tag = mem_val.get_tag();
+        if (tag != MemoryTag::U64) {
+            throw KeccakF1600Exception(
+                format("Read slice tag invalid - addr: ", addr, " tag: ", static_cast<uint32_t>(tag)));
+        }
+        state[k] = mem_val.as<uint64_t>();
+    }
+
+    ethash_keccakf1600(state.data());
+
+    for (size_t k = 0; k < AVM_KECCAKF1600_STATE_SIZE; k++) {
+        memory.set(dst_addr + static_cast<MemoryAddress>(k), MemoryValue::from<uint64_t>(state[k]));
+    }
+}
+
+} // namespace bb::avm2::simulation
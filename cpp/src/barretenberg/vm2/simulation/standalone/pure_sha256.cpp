@@ -0,0 +1,52 @@
+#include "barretenberg/vm2/simulation/standalone/pure_sha256.hpp"
+
+#include <array>
+#include <cstdint>
+
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/vm2/common/aztec_constants.hpp"
+#include "barretenberg/vm2/simulation/events/sha256_event.hpp"
+#include "barretenberg/vm2/simulation/interfaces/memory.hpp"
+
+namespace bb::avm2::simulation {
+
+// Same checks as the Sha256 gadget, with the compression done natively.
+void PureSha256::compression(MemoryInterface& memory,
+                             MemoryAddress state_addr,
+                             MemoryAddress input_addr,
+                             MemoryAddress output_addr)
+{
+    if (static_cast<uint64_t>(state_addr) + 7 > AVM_HIGHEST_MEM_ADDRESS ||
+        static_cast<uint64_t>(input_addr) + 15 > AVM_HIGHEST_MEM_ADDRESS ||
+        static_cast<uint64_t>(output_addr) + 7 > AVM_HIGHEST_MEM_ADDRESS) {
+        throw Sha256CompressionException("Memory address out of range for sha256 compression.");
+    }
+
+    std::array<MemoryValue, 8> state_values;
+    for (uint32_t i = 0; i < 8; ++i) {
+        state_values[i] = memory.get(state_addr + i);
+    }
+    std::array<uint32_t, 8> state;
+    for (uint32_t i = 0; i < 8; ++i) {
+        if (state_values[i].get_tag() != MemoryTag::U32) {
+            throw Sha256CompressionException("Invalid tag for sha256 state values.");
+        }
+        state[i] = state_values[i].as<uint32_t>();
+    }
+
+    std::array<uint32_t, 16> input;
+    for (uint32_t i = 0; i < 16; ++i) {
+        const MemoryValue& value = memory.get(input_addr + i);
+        if (value.get_tag() != MemoryTag::U32) {
+            throw Sha256CompressionException("Invalid tag for sha256 input values.");
+        }
+        input[i] = value.as<uint32_t>();
+    }
+
+    const std::array<uint32_t, 8> output = crypto::sha256_block(state, input);
+    for (uint32_t i = 0; i < 8; ++i) {
+        memory.set(output_addr + i, MemoryValue::from<uint32_t>(output[i]));
+    }
+}
+
+} // namespace bb::avm2::simulation
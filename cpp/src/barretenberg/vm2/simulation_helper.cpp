@@ -1,9 +1,14 @@
 #include "barretenberg/vm2/simulation_helper.hpp"
 
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
 
 #include "barretenberg/common/bb_bench.hpp"
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/vm2/common/avm_io.hpp"
 #include "barretenberg/vm2/common/aztec_types.hpp"
 #include "barretenberg/vm2/common/field.hpp"
@@ -18,6 +23,7 @@
 #include "barretenberg/vm2/simulation/lib/raw_data_dbs.hpp"
 #include "barretenberg/vm2/simulation/lib/side_effect_tracker.hpp"
 #include "barretenberg/vm2/simulation/lib/side_effect_tracking_db.hpp"
+#include "barretenberg/vm2/simulation/lib/speculative_dbs.hpp"
 
 // Events.
 #include "barretenberg/vm2/simulation/events/address_derivation_event.hpp"
@@ -81,8 +87,10 @@
 #include "barretenberg/vm2/simulation/standalone/pure_bytecode_manager.hpp"
 #include "barretenberg/vm2/simulation/standalone/pure_execution_components.hpp"
 #include "barretenberg/vm2/simulation/standalone/pure_gt.hpp"
+#include "barretenberg/vm2/simulation/standalone/pure_keccakf1600.hpp"
 #include "barretenberg/vm2/simulation/standalone/pure_memory.hpp"
 #include "barretenberg/vm2/simulation/standalone/pure_poseidon2.hpp"
+#include "barretenberg/vm2/simulation/standalone/pure_sha256.hpp"
 #include "barretenberg/vm2/simulation/standalone/pure_to_radix.hpp"
 #include "barretenberg/vm2/simulation/standalone/written_public_data_slots_tree_check.hpp"
 
@@ -317,13 +325,30 @@ TxSimulationResult AvmSimulationHelper::simulate_fast(ContractDBInterface& raw_c
 {
     BB_BENCH_NAME("AvmSimulationHelper::simulate_fast");
 
+    PublicInputsBuilder public_inputs_builder;
+    public_inputs_builder.extract_inputs(tx, global_variables, protocol_contracts, config.prover_id, raw_merkle_db);
+
+    // This triggers all the work.
+    FastExecutionResult execution_result =
+        execute_fast(raw_contract_db, raw_merkle_db, config, tx, global_variables, protocol_contracts);
+
+    return build_fast_result(std::move(execution_result), public_inputs_builder, raw_merkle_db);
+}
+
+AvmSimulationHelper::FastExecutionResult AvmSimulationHelper::execute_fast(
+    ContractDBInterface& raw_contract_db,
+    LowLevelMerkleDBInterface& raw_merkle_db,
+    const PublicSimulatorConfig& config,
+    const Tx& tx,
+    const GlobalVariables& global_variables,
+    const ProtocolContracts& protocol_contracts)
+{
+
     NoopEventEmitter<ExecutionEvent> execution_emitter;
     NoopEventEmitter<DataCopyEvent> data_copy_emitter;
-    NoopEventEmitter<Sha256CompressionEvent> sha256_compression_emitter;
     NoopEventEmitter<EccAddEvent> ecc_add_emitter;
     NoopEventEmitter<ScalarMulEvent> scalar_mul_emitter;
     NoopEventEmitter<EccAddMemoryEvent> ecc_add_memory_emitter;
-    NoopEventEmitter<KeccakF1600Event> keccakf1600_emitter;
     NoopEventEmitter<FieldGreaterThanEvent> field_gt_emitter;
     NoopEventEmitter<MerkleCheckEvent> merkle_check_emitter;
     NoopEventEmitter<RangeCheckEvent> range_check_emitter;
@@ -350,8 +375,8 @@ TxSimulationResult AvmSimulationHelper::simulate_fast(ContractDBInterface& raw_c
     EmitUnencryptedLog emit_unencrypted_log_component(execution_id_manager, greater_than, emit_unencrypted_log_emitter);
     PureAlu alu;
     PureBitwise bitwise;
-    Sha256 sha256(execution_id_manager, bitwise, greater_than, sha256_compression_emitter);
-    KeccakF1600 keccakf1600(execution_id_manager, keccakf1600_emitter, bitwise, range_check, greater_than);
+    PureSha256 sha256;
+    PureKeccakF1600 keccakf1600;
 
     Ecc ecc(execution_id_manager, greater_than, to_radix, ecc_add_emitter, scalar_mul_emitter, ecc_add_memory_emitter);
 
@@ -437,26 +462,34 @@ TxSimulationResult AvmSimulationHelper::simulate_fast(ContractDBInterface& raw_c
                              config.skip_fee_enforcement,
                              config.collect_call_metadata);
 
-    PublicInputsBuilder public_inputs_builder;
-    public_inputs_builder.extract_inputs(tx, global_variables, protocol_contracts, config.prover_id, raw_merkle_db);
-
-    // This triggers all the work.
     TxExecutionResult tx_execution_result = tx_execution.simulate(tx);
 
+    return {
+        .tx_execution_result = std::move(tx_execution_result),
+        .side_effects = side_effect_tracker.get_side_effects(),
+        .logs = debug_log_component->dump_logs(),
+    };
+}
+
+TxSimulationResult AvmSimulationHelper::build_fast_result(FastExecutionResult&& execution_result,
+                                                          PublicInputsBuilder& public_inputs_builder,
+                                                          const LowLevelMerkleDBInterface& raw_merkle_db)
+{
+    TxExecutionResult& tx_execution_result = execution_result.tx_execution_result;
     public_inputs_builder.extract_outputs(raw_merkle_db,
                                           // TODO(MW): Use of billed_gas is a bit misleading - we want public + private
                                           // - teardown, which is stored as billed gas here/in ts:
                                           tx_execution_result.gas_used.billed_gas,
                                           tx_execution_result.transaction_fee,
                                           tx_execution_result.revert_code != RevertCode::OK,
-                                          side_effect_tracker.get_side_effects());
+                                          execution_result.side_effects);
 
     return {
         // Simulation.
         .gas_used = tx_execution_result.gas_used,
         .revert_code = tx_execution_result.revert_code,
         .app_logic_return_values = std::move(tx_execution_result.app_logic_return_values),
-        .logs = debug_log_component->dump_logs(),
+        .logs = std::move(execution_result.logs),
         // Proving request data.
         .public_inputs = public_inputs_builder.build(),
         .hints = std::nullopt, // NOTE: hints are injected by the caller.
@@ -496,6 +529,87 @@ TxSimulationResult AvmSimulationHelper::simulate_fast_with_existing_ws(
     return simulate_fast(raw_contract_db, raw_merkle_db, config, tx, global_variables, protocol_contracts);
 }
 
+std::vector<TxSimulationResult> AvmSimulationHelper::simulate_block_fast_with_existing_ws(
+    simulation::ContractDBInterface& raw_contract_db,
+    const world_state::WorldStateRevision& world_state_revision,
+    world_state::WorldState& ws,
+    const PublicSimulatorConfig& config,
+    std::span<const Tx> txs,
+    const GlobalVariables& global_variables,
+    const ProtocolContracts& protocol_contracts)
+{
+    BB_BENCH_NAME("AvmSimulationHelper::simulate_block_fast_with_existing_ws");
+
+    std::vector<TxSimulationResult> results;
+    results.reserve(txs.size());
+
+    // Hints describe the exact state a transaction was simulated against, they are only collected sequentially.
+    if (config.collect_hints) {
+        for (const Tx& tx : txs) {
+            results.push_back(simulate_fast_with_existing_ws(
+                raw_contract_db, world_state_revision, ws, config, tx, global_variables, protocol_contracts));
+        }
+        return results;
+    }
+
+    PureRawMerkleDB raw_merkle_db(world_state_revision, ws);
+
+    // Simulate every transaction in parallel against the starting state, without writing to the world state.
+    std::vector<std::unique_ptr<SpeculativeRawMerkleDB>> speculative_dbs(txs.size());
+    std::vector<std::optional<FastExecutionResult>> speculative_results(txs.size());
+    std::vector<StateAccesses> accesses(txs.size());
+    std::mutex contract_db_mutex;
+    parallel_for(txs.size(), [&](size_t i) {
+        // Transactions deploying contracts are simulated against the contract db itself, below.
+        if (deploys_contracts(txs[i])) {
+            return;
+        }
+        auto merkle_db = std::make_unique<SpeculativeRawMerkleDB>(raw_merkle_db);
+        SpeculativeContractDB contract_db(raw_contract_db, contract_db_mutex, txs[i]);
+        try {
+            speculative_results[i] =
+                execute_fast(contract_db, *merkle_db, config, txs[i], global_variables, protocol_contracts);
+        } catch (const std::exception& e) {
+            // Possibly caused by the missing writes of earlier transactions, the transaction is simulated again below.
+            vinfo("Speculative simulation of transaction ", i, " failed: ", e.what());
+            return;
+        }
+        accesses[i] = merkle_db->get_accesses();
+        contract_db.add_accesses_to(accesses[i]);
+        speculative_dbs[i] = std::move(merkle_db);
+    });
+
+    // Then apply them in order. A transaction whose reads may have been affected by the writes of an earlier one is
+    // simulated again, on top of the state left by the earlier ones, exactly as if the block was simulated
+    // sequentially.
+    StateAccesses block_writes;
+    size_t num_reexecuted = 0;
+    for (size_t i = 0; i < txs.size(); ++i) {
+        if (speculative_results[i].has_value() && !accesses[i].conflicts_with(block_writes)) {
+            PublicInputsBuilder public_inputs_builder;
+            public_inputs_builder.extract_inputs(
+                txs[i], global_variables, protocol_contracts, config.prover_id, raw_merkle_db);
+            speculative_dbs[i]->replay(raw_merkle_db);
+            speculative_dbs[i].reset();
+            block_writes.add_writes(accesses[i]);
+            results.push_back(
+                build_fast_result(std::move(speculative_results[i].value()), public_inputs_builder, raw_merkle_db));
+            continue;
+        }
+
+        num_reexecuted++;
+        WriteTrackingRawMerkleDB merkle_db(raw_merkle_db);
+        results.push_back(
+            simulate_fast(raw_contract_db, merkle_db, config, txs[i], global_variables, protocol_contracts));
+        StateAccesses writes = merkle_db.get_writes();
+        writes.adds_contracts = deploys_contracts(txs[i]);
+        block_writes.add_writes(writes);
+    }
+    vinfo("Simulated ", txs.size(), " transactions, ", num_reexecuted, " of which sequentially");
+
+    return results;
+}
+
 TxSimulationResult AvmSimulationHelper::simulate_fast_with_hinted_dbs(const ExecutionHints& hints)
 {
     // TODO(fcarreiro): decide if we want to pass a config here.
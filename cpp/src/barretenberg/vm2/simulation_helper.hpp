@@ -3,8 +3,14 @@
 #include "barretenberg/vm2/common/avm_io.hpp"
 #include "barretenberg/vm2/common/aztec_types.hpp"
 #include "barretenberg/vm2/simulation/events/events_container.hpp"
+#include "barretenberg/vm2/simulation/gadgets/tx_execution.hpp"
 #include "barretenberg/vm2/simulation/interfaces/db.hpp"
 #include "barretenberg/vm2/simulation/interfaces/execution.hpp"
+#include "barretenberg/vm2/simulation/lib/public_inputs_builder.hpp"
+#include "barretenberg/vm2/simulation/lib/side_effect_tracker.hpp"
+
+#include <span>
+#include <vector>
 
 namespace bb::avm2 {
 
@@ -24,6 +30,19 @@ class AvmSimulationHelper {
 
     TxSimulationResult simulate_fast_with_hinted_dbs(const ExecutionHints& hints);
 
+    // Fast simulation of the transactions of a block, in order, on top of the given world state revision.
+    // The transactions are simulated speculatively in parallel and only those whose reads conflict with the writes of
+    // an earlier transaction are simulated again, so the results and the resulting world state are the same as when
+    // simulating the transactions one by one with simulate_fast_with_existing_ws.
+    std::vector<TxSimulationResult> simulate_block_fast_with_existing_ws(
+        simulation::ContractDBInterface& raw_contract_db,
+        const world_state::WorldStateRevision& world_state_revision,
+        world_state::WorldState& ws,
+        const PublicSimulatorConfig& config,
+        std::span<const Tx> txs,
+        const GlobalVariables& global_variables,
+        const ProtocolContracts& protocol_contracts);
+
   protected:
     // Helper called by simulate_fast* functions.
     TxSimulationResult simulate_fast(simulation::ContractDBInterface& raw_contract_db,
@@ -32,6 +51,23 @@ class AvmSimulationHelper {
                                      const Tx& tx,
                                      const GlobalVariables& global_variables,
                                      const ProtocolContracts& protocol_contracts);
+
+    // The outcome of a simulation that doesn't depend on the position of the transaction in the trees.
+    struct FastExecutionResult {
+        simulation::TxExecutionResult tx_execution_result;
+        simulation::TrackedSideEffects side_effects;
+        std::vector<DebugLog> logs;
+    };
+    FastExecutionResult execute_fast(simulation::ContractDBInterface& raw_contract_db,
+                                     simulation::LowLevelMerkleDBInterface& raw_merkle_db,
+                                     const PublicSimulatorConfig& config,
+                                     const Tx& tx,
+                                     const GlobalVariables& global_variables,
+                                     const ProtocolContracts& protocol_contracts);
+    // Completes the public inputs of an execution with the state of the db after it.
+    static TxSimulationResult build_fast_result(FastExecutionResult&& execution_result,
+                                                simulation::PublicInputsBuilder& public_inputs_builder,
+                                                const simulation::LowLevelMerkleDBInterface& raw_merkle_db);
 };
 
 } // namespace bb::avm2
@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -197,9 +198,23 @@ uint64_t WorldState::create_fork(const std::optional<block_number_t>& blockNumbe
     block_number_t blockNumberForFork = 0;
     if (!blockNumber.has_value()) {
         // we are forking at latest
-        WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
-        TreeMetaResponse archiveMeta = get_tree_info(revision, MerkleTreeId::ARCHIVE);
-        blockNumberForFork = archiveMeta.meta.unfinalizedBlockHeight;
+        std::optional<block_number_t> latest;
+        uint64_t generation = 0;
+        {
+            std::unique_lock lock(mtx);
+            latest = _latestBlockNumber;
+            generation = _forkSnapshotsGeneration;
+        }
+        if (!latest.has_value()) {
+            WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
+            TreeMetaResponse archiveMeta = get_tree_info(revision, MerkleTreeId::ARCHIVE);
+            latest = archiveMeta.meta.unfinalizedBlockHeight;
+            std::unique_lock lock(mtx);
+            if (generation == _forkSnapshotsGeneration) {
+                _latestBlockNumber = latest;
+            }
+        }
+        blockNumberForFork = latest.value();
     } else {
         blockNumberForFork = blockNumber.value();
     }
@@ -245,50 +260,78 @@ void WorldState::delete_fork(const uint64_t& forkId)
 
 Fork::SharedPtr WorldState::create_new_fork(const block_number_t& blockNumber)
 {
+    // Forks from a block we have already forked from are created from the snapshots taken then, without reading the
+    // stores again
+    std::shared_ptr<const ForkSnapshots> cached;
+    uint64_t generation = 0;
+    {
+        std::unique_lock lock(mtx);
+        generation = _forkSnapshotsGeneration;
+        auto it = _forkSnapshots.find(blockNumber);
+        if (it != _forkSnapshots.end()) {
+            cached = it->second;
+        }
+    }
+    ForkSnapshots snapshots;
+
     Fork::SharedPtr fork = std::make_shared<Fork>();
     fork->_blockNumber = blockNumber;
     {
-        uint32_t levels = _tree_heights.at(MerkleTreeId::NULLIFIER_TREE);
         index_t initial_size = _initial_tree_size.at(MerkleTreeId::NULLIFIER_TREE);
-        auto store = std::make_unique<NullifierStore>(
-            getMerkleTreeName(MerkleTreeId::NULLIFIER_TREE), levels, blockNumber, _persistentStores->nullifierStore);
+        auto store = create_fork_store<NullifierStore>(
+            MerkleTreeId::NULLIFIER_TREE, blockNumber, _persistentStores->nullifierStore, cached.get(), snapshots);
         auto tree = std::make_unique<NullifierTree>(std::move(store), _workers, initial_size);
         fork->_trees.insert({ MerkleTreeId::NULLIFIER_TREE, TreeWithStore(std::move(tree)) });
     }
     {
-        uint32_t levels = _tree_heights.at(MerkleTreeId::NOTE_HASH_TREE);
-        auto store = std::make_unique<FrStore>(
-            getMerkleTreeName(MerkleTreeId::NOTE_HASH_TREE), levels, blockNumber, _persistentStores->noteHashStore);
+        auto store = create_fork_store<FrStore>(
+            MerkleTreeId::NOTE_HASH_TREE, blockNumber, _persistentStores->noteHashStore, cached.get(), snapshots);
         auto tree = std::make_unique<FrTree>(std::move(store), _workers);
         fork->_trees.insert({ MerkleTreeId::NOTE_HASH_TREE, TreeWithStore(std::move(tree)) });
     }
     {
-        uint32_t levels = _tree_heights.at(MerkleTreeId::PUBLIC_DATA_TREE);
         index_t initial_size = _initial_tree_size.at(MerkleTreeId::PUBLIC_DATA_TREE);
-        auto store = std::make_unique<PublicDataStore>(
-            getMerkleTreeName(MerkleTreeId::PUBLIC_DATA_TREE), levels, blockNumber, _persistentStores->publicDataStore);
+        auto store = create_fork_store<PublicDataStore>(
+            MerkleTreeId::PUBLIC_DATA_TREE, blockNumber, _persistentStores->publicDataStore, cached.get(), snapshots);
         auto tree = std::make_unique<PublicDataTree>(std::move(store), _workers, initial_size);
         fork->_trees.insert({ MerkleTreeId::PUBLIC_DATA_TREE, TreeWithStore(std::move(tree)) });
     }
     {
-        uint32_t levels = _tree_heights.at(MerkleTreeId::L1_TO_L2_MESSAGE_TREE);
-        auto store = std::make_unique<FrStore>(getMerkleTreeName(MerkleTreeId::L1_TO_L2_MESSAGE_TREE),
-                                               levels,
-                                               blockNumber,
-                                               _persistentStores->messageStore);
+        auto store = create_fork_store<FrStore>(
+            MerkleTreeId::L1_TO_L2_MESSAGE_TREE, blockNumber, _persistentStores->messageStore, cached.get(), snapshots);
         auto tree = std::make_unique<FrTree>(std::move(store), _workers);
         fork->_trees.insert({ MerkleTreeId::L1_TO_L2_MESSAGE_TREE, TreeWithStore(std::move(tree)) });
     }
     {
-        uint32_t levels = _tree_heights.at(MerkleTreeId::ARCHIVE);
-        auto store = std::make_unique<FrStore>(
-            getMerkleTreeName(MerkleTreeId::ARCHIVE), levels, blockNumber, _persistentStores->archiveStore);
+        auto store = create_fork_store<FrStore>(
+            MerkleTreeId::ARCHIVE, blockNumber, _persistentStores->archiveStore, cached.get(), snapshots);
         auto tree = std::make_unique<FrTree>(std::move(store), _workers);
         fork->_trees.insert({ MerkleTreeId::ARCHIVE, TreeWithStore(std::move(tree)) });
     }
+
+    if (!cached) {
+        std::unique_lock lock(mtx);
+        // The canonical state changed while the stores were read, what was read may already be stale
+        if (generation != _forkSnapshotsGeneration) {
+            return fork;
+        }
+        // Forks are normally created from a handful of recent blocks, bound the cache for the unusual cases
+        if (_forkSnapshots.size() >= MAX_FORK_SNAPSHOTS) {
+            _forkSnapshots.clear();
+        }
+        _forkSnapshots.insert_or_assign(blockNumber, std::make_shared<const ForkSnapshots>(std::move(snapshots)));
+    }
     return fork;
 }
 
+void WorldState::clear_fork_snapshots()
+{
+    std::unique_lock lock(mtx);
+    _forkSnapshots.clear();
+    _latestBlockNumber.reset();
+    _forkSnapshotsGeneration++;
+}
+
 TreeMetaResponse WorldState::get_tree_info(const WorldStateRevision& revision, MerkleTreeId tree_id) const
 {
     Fork::SharedPtr fork = retrieve_fork(revision.forkId);
@@ -526,6 +569,14 @@ std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
     std::atomic_bool success = true;
     std::string message;
     Signal signal(static_cast<uint32_t>(fork->_trees.size()));
+    clear_fork_snapshots();
+
+    const bool groupCommit = _groupCommit;
+    if (groupCommit) {
+        for (const auto& store : *_persistentStores) {
+            store->set_sync_on_commit(false);
+        }
+    }
 
     {
         auto& wrapper = std::get<TreeWithStore<NullifierTree>>(fork->_trees.at(MerkleTreeId::NULLIFIER_TREE));
@@ -561,9 +612,47 @@ std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
     }
 
     signal.wait_for_level(0);
+    if (groupCommit) {
+        // The one sync barrier of the block, whether or not every tree committed
+        sync_persistent_stores(success, message);
+    }
+    clear_fork_snapshots();
     return std::make_pair(success.load(), message);
 }
 
+void WorldState::sync_persistent_stores(std::atomic_bool& success, std::string& message)
+{
+    std::mutex message_mutex;
+    auto set_failure = [&](const std::string& failure) {
+        std::lock_guard<std::mutex> lock(message_mutex);
+        bool expected = true;
+        if (success.compare_exchange_strong(expected, false)) {
+            message = failure;
+        }
+    };
+
+    // MDB_NOSYNC applies to the whole environment of a store, so it also covers any other write transaction
+    // committed to it while group commit is in progress. Syncing is restored before flushing: everything committed
+    // while it was disabled is made durable by the flush below, and anything committed after it flushes itself.
+    Signal signal(static_cast<uint32_t>(std::distance(_persistentStores->begin(), _persistentStores->end())));
+    for (const auto& store : *_persistentStores) {
+        _workers->enqueue([&, store]() {
+            try {
+                store->set_sync_on_commit(true);
+            } catch (std::exception& e) {
+                set_failure(format("Failed to restore world state sync mode: ", e.what()));
+            }
+            try {
+                store->sync();
+            } catch (std::exception& e) {
+                set_failure(format("Failed to sync world state to disk: ", e.what()));
+            }
+            signal.signal_decrement();
+        });
+    }
+    signal.wait_for_level(0);
+}
+
 void WorldState::rollback()
 {
     // NOTE: the calling code is expected to ensure no other reads or writes happen during rollback
@@ -796,6 +885,7 @@ bool WorldState::set_finalized_block(const block_number_t& blockNumber)
     Signal signal(static_cast<uint32_t>(fork->_trees.size()));
     std::array<Response, NUM_TREES> local;
     std::mutex mtx;
+    clear_fork_snapshots();
     for (auto& [id, tree] : fork->_trees) {
         std::visit(
             [&signal, &local, blockNumber, id, &mtx](auto&& wrapper) {
@@ -810,6 +900,7 @@ bool WorldState::set_finalized_block(const block_number_t& blockNumber)
             tree);
     }
     signal.wait_for_level();
+    clear_fork_snapshots();
     for (auto& m : local) {
         if (!m.success) {
             throw std::runtime_error(m.message);
@@ -823,6 +914,7 @@ bool WorldState::unwind_block(const block_number_t& blockNumber, WorldStateStatu
     std::string message;
     Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
     Signal signal(static_cast<uint32_t>(fork->_trees.size()));
+    clear_fork_snapshots();
     {
         auto& wrapper = std::get<TreeWithStore<NullifierTree>>(fork->_trees.at(MerkleTreeId::NULLIFIER_TREE));
         unwind_tree(status.dbStats.nullifierTreeStats,
@@ -877,6 +969,7 @@ bool WorldState::unwind_block(const block_number_t& blockNumber, WorldStateStatu
                     blockNumber);
     }
     signal.wait_for_level();
+    clear_fork_snapshots();
     if (!success) {
         throw std::runtime_error(message);
     }
@@ -889,6 +982,7 @@ bool WorldState::remove_historical_block(const block_number_t& blockNumber, Worl
     std::string message;
     Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
     Signal signal(static_cast<uint32_t>(fork->_trees.size()));
+    clear_fork_snapshots();
     {
         auto& wrapper = std::get<TreeWithStore<NullifierTree>>(fork->_trees.at(MerkleTreeId::NULLIFIER_TREE));
         remove_historic_block_for_tree(status.dbStats.nullifierTreeStats,
@@ -943,6 +1037,7 @@ bool WorldState::remove_historical_block(const block_number_t& blockNumber, Worl
                                        blockNumber);
     }
     signal.wait_for_level();
+    clear_fork_snapshots();
     if (!success) {
         throw std::runtime_error(message);
     }
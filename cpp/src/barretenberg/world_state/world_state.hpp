@@ -264,9 +264,28 @@ class WorldState {
 
     /**
      * @brief Commits the current state of the world state.
+     * In group commit mode the trees commit without flushing to disk and are then made durable together, see
+     * set_group_commit.
      */
     std::pair<bool, std::string> commit(WorldStateStatusFull& status);
 
+    /**
+     * @brief Enables or disables group commit
+     *
+     * By default each tree's commit flushes its store to disk twice (data then meta pages). In group commit mode the
+     * trees commit with flushing disabled and a single barrier then flushes all stores in parallel before commit()
+     * returns, so a block costs one flush per store. A crash before the barrier has completed can lose the latest
+     * block in some trees but not others, which is reconciled on start-up by attempt_tree_resync() using the block
+     * data of each tree. LMDB only retains integrity for unflushed commits on file systems that preserve write
+     * order, which is why this mode is opt-in.
+     *
+     * Flushing is disabled per LMDB environment, i.e. for every writer of a tree's store and not only for commit().
+     * It is only disabled for the duration of commit() and re-enabled before the barrier's flush, so a write
+     * transaction from elsewhere that lands in that window is made durable by the barrier before commit() returns.
+     * Exposed to node through the group commit argument of the WorldStateWrapper constructor.
+     */
+    void set_group_commit(bool enabled) { _groupCommit = enabled; }
+
     /**
      * @brief Rolls back any uncommitted changes made to the world state.
      */
@@ -303,6 +322,17 @@ class WorldState {
     std::unordered_map<uint64_t, Fork::SharedPtr> _forks;
     uint64_t _forkId = 0;
     uint32_t _initial_header_generator_point;
+    bool _groupCommit = false;
+
+    // The state of each tree at the blocks forks have recently been created from, along with the latest block number,
+    // so that creating further forks doesn't need to read the stores. Cleared whenever the canonical state changes.
+    using ForkSnapshots = std::array<std::optional<crypto::merkle_tree::ForkSnapshot>, NUM_TREES>;
+    static constexpr size_t MAX_FORK_SNAPSHOTS = 16;
+    std::unordered_map<block_number_t, std::shared_ptr<const ForkSnapshots>> _forkSnapshots;
+    std::optional<block_number_t> _latestBlockNumber;
+    // Bumped by clear_fork_snapshots. Forks read the stores without holding mtx, so what they read is only cached if
+    // the generation is still the one seen before the read
+    uint64_t _forkSnapshotsGeneration = 0;
 
     TreeStateReference get_tree_snapshot(MerkleTreeId id);
     void create_canonical_fork(const std::string& dataDir,
@@ -312,8 +342,18 @@ class WorldState {
 
     Fork::SharedPtr retrieve_fork(const uint64_t& forkId) const;
     Fork::SharedPtr create_new_fork(const block_number_t& blockNumber);
+    void clear_fork_snapshots();
+
+    template <typename StoreType>
+    std::unique_ptr<StoreType> create_fork_store(MerkleTreeId id,
+                                                 const block_number_t& blockNumber,
+                                                 const LMDBTreeStore::SharedPtr& persistentStore,
+                                                 const ForkSnapshots* cached,
+                                                 ForkSnapshots& captured) const;
     void remove_forks_for_block(const block_number_t& blockNumber);
 
+    void sync_persistent_stores(std::atomic_bool& success, std::string& message);
+
     bool unwind_block(const block_number_t& blockNumber, WorldStateStatusFull& status);
     bool remove_historical_block(const block_number_t& blockNumber, WorldStateStatusFull& status);
     bool set_finalized_block(const block_number_t& blockNumber);
@@ -370,6 +410,23 @@ class WorldState {
                                         const block_number_t& blockNumber);
 };
 
+template <typename StoreType>
+std::unique_ptr<StoreType> WorldState::create_fork_store(MerkleTreeId id,
+                                                         const block_number_t& blockNumber,
+                                                         const LMDBTreeStore::SharedPtr& persistentStore,
+                                                         const ForkSnapshots* cached,
+                                                         ForkSnapshots& captured) const
+{
+    if (cached != nullptr && (*cached)[id].has_value()) {
+        return std::make_unique<StoreType>((*cached)[id].value(), persistentStore);
+    }
+    auto store =
+        std::make_unique<StoreType>(getMerkleTreeName(id), _tree_heights.at(id), blockNumber, persistentStore);
+    // Taken before the store is handed to a tree, while it only holds what it read from the persisted store
+    captured[id] = store->get_fork_snapshot();
+    return store;
+}
+
 template <typename TreeType>
 void WorldState::commit_tree(TreeDBStats& dbStats,
                              Signal& signal,
@@ -583,6 +583,44 @@ TEST_F(WorldStateTest, CommitsAndRollsBackAllTrees)
         ws, WorldStateRevision::committed(), MerkleTreeId::PUBLIC_DATA_TREE, PublicDataLeafValue(143, 1), false);
 }
 
+TEST_F(WorldStateTest, GroupCommitPersistsAllTrees)
+{
+    {
+        WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        ws.set_group_commit(true);
+
+        for (uint32_t i = 0; i < 2; i++) {
+            ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(42 + i) });
+            ws.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, { fr(42 + i) });
+            ws.append_leaves<fr>(MerkleTreeId::ARCHIVE, { fr(42 + i) });
+            ws.append_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { NullifierLeafValue(142 + i) });
+            ws.append_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, { PublicDataLeafValue(142 + i, 1) });
+
+            WorldStateStatusFull status;
+            auto [success, message] = ws.commit(status);
+            EXPECT_TRUE(success) << message;
+        }
+    }
+
+    // Re-open the stores and check that both blocks are there
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    for (uint32_t i = 0; i < 2; i++) {
+        assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, i, fr(42 + i));
+        assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::L1_TO_L2_MESSAGE_TREE, i, fr(42 + i));
+        assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, i + 1, fr(42 + i));
+        assert_leaf_value(ws,
+                          WorldStateRevision::committed(),
+                          MerkleTreeId::NULLIFIER_TREE,
+                          128 + i,
+                          NullifierLeafValue(142 + i));
+        assert_leaf_value(ws,
+                          WorldStateRevision::committed(),
+                          MerkleTreeId::PUBLIC_DATA_TREE,
+                          128 + i,
+                          PublicDataLeafValue(142 + i, 1));
+    }
+}
+
 TEST_F(WorldStateTest, SyncExternalBlockFromEmpty)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -873,6 +911,48 @@ TEST_F(WorldStateTest, ForkingAtBlock0AndAdvancingCanonicalState)
         ws, WorldStateRevision{ .forkId = fork_id, .includeUncommitted = true }, MerkleTreeId::ARCHIVE, 1, 2);
 }
 
+TEST_F(WorldStateTest, RepeatedForksStartFromTheSameState)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    auto committed_state_ref = ws.get_state_reference(WorldStateRevision::committed());
+
+    auto first_fork = ws.create_fork(std::nullopt);
+    ws.append_leaves<bb::fr>(MerkleTreeId::NOTE_HASH_TREE, { 42 }, first_fork);
+    ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, { { 129 } }, 0, first_fork);
+
+    // The second fork is created from the state captured by the first, it must not see the first fork's changes
+    auto second_fork = ws.create_fork(std::nullopt);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision{ .forkId = second_fork, .includeUncommitted = true }),
+              committed_state_ref);
+    assert_fork_state_unchanged(ws, second_fork, true);
+    assert_leaf_exists(ws,
+                       WorldStateRevision{ .forkId = first_fork, .includeUncommitted = true },
+                       MerkleTreeId::NULLIFIER_TREE,
+                       NullifierLeafValue(129),
+                       true);
+    assert_leaf_exists(ws,
+                       WorldStateRevision{ .forkId = second_fork, .includeUncommitted = true },
+                       MerkleTreeId::NULLIFIER_TREE,
+                       NullifierLeafValue(129),
+                       false);
+
+    // Advancing the canonical state invalidates the captured state, a fork at latest must see the new block
+    ws.append_leaves<bb::fr>(MerkleTreeId::NOTE_HASH_TREE, { 43 });
+    ws.update_archive(ws.get_state_reference(WorldStateRevision::uncommitted()), { 1 });
+    WorldStateStatusFull status;
+    ws.commit(status);
+    auto third_fork = ws.create_fork(std::nullopt);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision{ .forkId = third_fork, .includeUncommitted = true }),
+              ws.get_state_reference(WorldStateRevision::committed()));
+    EXPECT_NE(ws.get_state_reference(WorldStateRevision{ .forkId = third_fork, .includeUncommitted = true }),
+              committed_state_ref);
+
+    // While a fork at the earlier block still starts from the earlier state
+    auto fourth_fork = ws.create_fork(0);
+    EXPECT_EQ(ws.get_state_reference(WorldStateRevision{ .forkId = fourth_fork, .includeUncommitted = true }),
+              committed_state_ref);
+}
+
 TEST_F(WorldStateTest, BuildsABlockInAFork)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -1,6 +1,6 @@
 import { Barretenberg } from './index.js';
 import { ProofData, uint8ArrayToHex, hexToUint8Array } from '../proof/index.js';
-import { fromChonkProof, toChonkProof } from '../cbind/generated/api_types.js';
+import { BlobRef, fromChonkProof, toChonkProof } from '../cbind/generated/api_types.js';
 import { ungzip } from 'pako';
 import { Decoder, Encoder } from 'msgpackr';
 
@@ -93,13 +93,16 @@ export class UltraHonkBackend {
   }
 
   async generateProof(compressedWitness: Uint8Array, options?: UltraHonkBackendOptions): Promise<ProofData> {
-    const witness = ungzip(compressedWitness);
+    const [witness, witnessBlob] = passByBlob(this.api, ungzip(compressedWitness));
+    const [bytecode, bytecodeBlob] = passByBlob(this.api, this.acirUncompressedBytecode);
     const { proof, publicInputs } = await this.api.circuitProve({
       witness,
+      witnessBlob,
       circuit: {
         name: 'circuit',
-        bytecode: this.acirUncompressedBytecode,
+        bytecode,
         verificationKey: new Uint8Array(0), // Empty VK - lower performance.
+        bytecodeBlob,
       },
       settings: getProofSettingsFromOptions(options),
     });
@@ -225,8 +228,8 @@ export class AztecClientBackend {
 
     // Queue load and accumulate for each circuit
     for (let i = 0; i < this.acirBuf.length; i++) {
-      const bytecode = this.acirBuf[i];
-      const witness = witnessBuf[i] || new Uint8Array(0);
+      const [bytecode, bytecodeBlob] = passByBlob(this.api, this.acirBuf[i]);
+      const [witness, witnessBlob] = passByBlob(this.api, witnessBuf[i] || new Uint8Array(0));
       const vk = vksBuf[i] || new Uint8Array(0);
       const functionName = `unknown_wasm_${i}`;
 
@@ -236,12 +239,14 @@ export class AztecClientBackend {
           name: functionName,
           bytecode: bytecode,
           verificationKey: vk,
+          bytecodeBlob,
         },
       });
 
       // Accumulate with witness
       this.api.chonkAccumulate({
         witness,
+        witnessBlob,
       });
     }
 
@@ -296,6 +301,15 @@ export class AztecClientBackend {
   }
 }
 
+/**
+ * Pass `data` through the backend's blob arena if it has one. Returns the bytes to send inline (empty if the blob is
+ * used) and the blob reference to set alongside them.
+ */
+function passByBlob(api: Barretenberg, data: Uint8Array): [Uint8Array, BlobRef | undefined] {
+  const blob = api.writeBlob(data);
+  return blob ? [new Uint8Array(0), blob] : [data, undefined];
+}
+
 // Converts bytecode from a base64 string to a Uint8Array
 function acirToUint8Array(base64EncodedBytecode: string): Uint8Array {
   const compressedByteCode = base64Decode(base64EncodedBytecode);
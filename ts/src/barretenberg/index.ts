@@ -1,6 +1,7 @@
 import { Crs, GrumpkinCrs } from '../crs/index.js';
 import { AsyncApi } from '../cbind/generated/async.js';
 import { SyncApi } from '../cbind/generated/sync.js';
+import { BlobRef } from '../cbind/generated/api_types.js';
 import { IMsgpackBackendSync, IMsgpackBackendAsync } from '../bb_backends/interface.js';
 import { BackendOptions, BackendType } from '../bb_backends/index.js';
 import { createAsyncBackend, createSyncBackend } from '../bb_backends/node/index.js';
@@ -25,6 +26,15 @@ export class Barretenberg extends AsyncApi {
     this.options = options;
   }
 
+  /**
+   * Pass a large payload by reference through the backend's shared-memory blob arena, if it has one.
+   * The request referring to the payload must be issued before yielding to the event loop.
+   * @returns The reference to set in the request, or undefined if the payload has to be sent inline.
+   */
+  writeBlob(data: Uint8Array): BlobRef | undefined {
+    return this.backend.writeBlob?.(data);
+  }
+
   /**
    * Constructs an instance of Barretenberg.
    *
@@ -1,3 +1,5 @@
+import { BlobRef } from '../cbind/generated/api_types.js';
+
 /**
  * Generic interface for msgpack backend implementations.
  * Both WASM and native binary backends implement this interface.
@@ -10,6 +12,15 @@ export interface IMsgpackBackend {
    */
   call(inputBuffer: Uint8Array): Uint8Array | Promise<Uint8Array>;
 
+  /**
+   * Copy a large payload (bytecode, witness) into the backend's shared-memory blob arena, so that a request can refer
+   * to it with a BlobRef instead of carrying it inline. Only implemented by shared memory backends.
+   * The request referring to the payload must be issued before yielding to the event loop: the arena is freed as soon
+   * as no request is in flight.
+   * @returns The reference to the payload, or undefined if it has to be sent inline (e.g. the arena is full)
+   */
+  writeBlob?(data: Uint8Array): BlobRef | undefined;
+
   /**
    * Clean up resources.
    */
@@ -2,6 +2,7 @@ import { createRequire } from 'module';
 import { spawn, ChildProcess } from 'child_process';
 import { openSync, closeSync } from 'fs';
 import { IMsgpackBackendSync } from '../interface.js';
+import { BlobRef } from '../../cbind/generated/api_types.js';
 import { findNapiBinary, findPackageRoot } from './platform.js';
 
 // Import the NAPI module
@@ -21,6 +22,10 @@ try {
 
 let instanceCounter = 0;
 
+// Size of the shared memory arena that large payloads are passed through. It is sparse: only the payloads of requests
+// in flight are backed by memory.
+const BLOB_ARENA_SIZE = 1024 * 1024 * 1024;
+
 /**
  * Synchronous shared memory backend that communicates with bb binary via shared memory.
  * Uses NAPI module to interface with shared memory IPC.
@@ -75,7 +80,16 @@ export class BarretenbergNativeShmSyncBackend implements IMsgpackBackendSync {
     }
 
     // Spawn bb process with shared memory mode (SPSC-only, no max-clients needed)
-    const args = ['msgpack', 'run', '--input', `${shmName}.shm`, '--request-ring-size', `${1024 * 1024 * 4}`];
+    const args = [
+      'msgpack',
+      'run',
+      '--input',
+      `${shmName}.shm`,
+      '--request-ring-size',
+      `${1024 * 1024 * 4}`,
+      '--blob-arena-size',
+      `${BLOB_ARENA_SIZE}`,
+    ];
     const bbProcess = spawn(bbBinaryPath, args, {
       stdio: ['ignore', logFd ?? 'ignore', logFd ?? 'ignore'],
       env,
@@ -166,9 +180,17 @@ export class BarretenbergNativeShmSyncBackend implements IMsgpackBackendSync {
       return new Uint8Array(responseBuffer);
     } catch (err: any) {
       throw new Error(`Shared memory call failed: ${err.message}`);
+    } finally {
+      // Calls are synchronous, so no request refers to the blob arena any more
+      this.client.resetBlobs();
     }
   }
 
+  writeBlob(data: Uint8Array): BlobRef | undefined {
+    const offset: number | null = this.client.writeBlob(Buffer.from(data.buffer, data.byteOffset, data.byteLength));
+    return offset === null ? undefined : { offset, size: data.byteLength };
+  }
+
   private cleanup(): void {
     if (this.client) {
       try {
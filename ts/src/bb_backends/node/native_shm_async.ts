@@ -2,6 +2,7 @@ import { createRequire } from 'module';
 import { spawn, ChildProcess } from 'child_process';
 import { openSync, closeSync } from 'fs';
 import { IMsgpackBackendAsync } from '../interface.js';
+import { BlobRef } from '../../cbind/generated/api_types.js';
 import { findNapiBinary, findPackageRoot } from './platform.js';
 
 // Import the NAPI module
@@ -21,6 +22,10 @@ try {
 
 let instanceCounter = 0;
 
+// Size of the shared memory arena that large payloads are passed through. It is sparse: only the payloads of requests
+// in flight are backed by memory.
+const BLOB_ARENA_SIZE = 1024 * 1024 * 1024;
+
 /**
  * Asynchronous shared memory backend that communicates with bb binary via shared memory.
  * Uses NAPI module with background thread polling for async operations.
@@ -72,8 +77,10 @@ export class BarretenbergNativeShmAsyncBackend implements IMsgpackBackendAsync {
       console.warn('Received response but no pending callback');
     }
 
-    // If no more pending callbacks, release ref to allow process to exit
+    // If no more pending callbacks, no request refers to the blob arena any more
+    // and we release ref to allow process to exit
     if (this.pendingCallbacks.length === 0) {
+      this.client.resetBlobs();
       this.client.release();
     }
   }
@@ -121,6 +128,8 @@ export class BarretenbergNativeShmAsyncBackend implements IMsgpackBackendAsync {
       `${1024 * 1024 * 4}`,
       '--response-ring-size',
       `${1024 * 1024 * 4}`,
+      '--blob-arena-size',
+      `${BLOB_ARENA_SIZE}`,
     ];
     const bbProcess = spawn(bbBinaryPath, args, {
       stdio: ['ignore', logFd ?? 'ignore', logFd ?? 'ignore'],
@@ -238,8 +247,9 @@ export class BarretenbergNativeShmAsyncBackend implements IMsgpackBackendAsync {
         // Send failed - dequeue the callback we just added and reject
         this.pendingCallbacks.pop();
 
-        // If queue is now empty, release ref to allow exit
+        // If queue is now empty, free the blob arena and release ref to allow exit
         if (this.pendingCallbacks.length === 0) {
+          this.client.resetBlobs();
           this.client.release();
         }
 
@@ -248,6 +258,11 @@ export class BarretenbergNativeShmAsyncBackend implements IMsgpackBackendAsync {
     });
   }
 
+  writeBlob(data: Uint8Array): BlobRef | undefined {
+    const offset: number | null = this.client.writeBlob(Buffer.from(data.buffer, data.byteOffset, data.byteLength));
+    return offset === null ? undefined : { offset, size: data.byteLength };
+  }
+
   async destroy(): Promise<void> {
     // Kill the bb process
     // Background thread and callbacks will be cleaned up by OS on process exit
@@ -24,6 +24,8 @@ export interface TypeInfo {
   declaration?: string;
   toMethod?: string;
   fromMethod?: string;
+  // Set for std::optional fields: the type of the value when present
+  optionalOf?: TypeInfo;
 }
 
 export interface FunctionMetadata {
@@ -371,6 +373,17 @@ export class SchemaCompiler {
         };
       }
 
+      case 'optional': {
+        // Omitted (undefined) in TypeScript, nil on the wire
+        const [subtype] = args[0];
+        const subtypeInfo = this.processSchema(subtype);
+        return {
+          typeName: subtypeInfo.typeName,
+          msgpackTypeName: `${subtypeInfo.msgpackTypeName || subtypeInfo.typeName} | null`,
+          optionalOf: subtypeInfo,
+        };
+      }
+
       case 'shared_ptr': {
         const [subtype] = args[0];
         return this.processSchema(subtype);
@@ -468,7 +481,7 @@ export class SchemaCompiler {
       // Track type usage
       this.trackTypeUsage(typeInfo.typeName);
 
-      result += `  ${camelCase(key)}: ${typeInfo.typeName};\n`;
+      result += `  ${camelCase(key)}${typeInfo.optionalOf ? '?' : ''}: ${typeInfo.typeName};\n`;
     }
     result += '}';
     return result;
@@ -493,6 +506,7 @@ export class SchemaCompiler {
     }
 
     const checks = fields
+      .filter(([, value]) => !this.processSchema(value).optionalOf)
       .map(
         ([key]) => `  if (o.${key} === undefined) { throw new Error("Expected ${key} in ${name} deserialization"); }`,
       )
@@ -501,6 +515,10 @@ export class SchemaCompiler {
     const conversions = fields
       .map(([key, value]) => {
         const typeInfo = this.processSchema(value);
+        if (typeInfo.optionalOf) {
+          const converter = this.generateConverter(typeInfo.optionalOf, `o.${key}`, 'to');
+          return `    ${camelCase(key)}: o.${key} === null || o.${key} === undefined ? undefined : ${converter},`;
+        }
         const converter = this.generateConverter(typeInfo, `o.${key}`, 'to');
         return `    ${camelCase(key)}: ${converter},`;
       })
@@ -522,6 +540,7 @@ ${conversions}
     }
 
     const checks = fields
+      .filter(([, value]) => !this.processSchema(value).optionalOf)
       .map(
         ([key]) =>
           `  if (o.${camelCase(key)} === undefined) { throw new Error("Expected ${camelCase(key)} in ${name} serialization"); }`,
@@ -531,6 +550,10 @@ ${conversions}
     const conversions = fields
       .map(([key, value]) => {
         const typeInfo = this.processSchema(value);
+        if (typeInfo.optionalOf) {
+          const converter = this.generateConverter(typeInfo.optionalOf, `o.${camelCase(key)}`, 'from');
+          return `  ${key}: o.${camelCase(key)} === undefined ? null : ${converter},`;
+        }
         const converter = this.generateConverter(typeInfo, `o.${camelCase(key)}`, 'from');
         return `  ${key}: ${converter},`;
       })